@@ -30,8 +30,11 @@
 #pragma once
 
 #include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/Utilities/CoRoutineFramePool.hpp>
 #include <discordcoreapi/Utilities/CoRoutineThreadPool.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <condition_variable>
+#include <semaphore>
 
 namespace discord_core_api {
 
@@ -73,30 +76,162 @@ namespace discord_core_api {
 			return sentYet.load(std::memory_order_acquire);
 		}
 
+		/// @brief Takes over another holder's result, for when the co_routine that owns it is moved.
+		inline void takeResult(result_holder& other) {
+			result = std::move(other.result);
+			sentYet.store(other.sentYet.exchange(false, std::memory_order_acq_rel), std::memory_order_release);
+		}
+
 	  protected:
 		unique_ptr<value_type> result{};
 		std::atomic_bool sentYet{};
 	};
 
+	/// @brief The completion state shared by both kinds of co_routine promise - who to resume once the co_routine finishes, and a futex-backed
+	/// semaphore for blocking callers to wait on.
+	class co_routine_promise_base {
+	  public:
+		/// @brief Takes the co_routine's frame from the frame pool, rather than the global heap.
+		inline static void* operator new(std::size_t size) {
+			return discord_core_internal::co_routine_frame_pool::allocate(size);
+		}
+
+		inline static void operator delete(void* ptr, std::size_t size) noexcept {
+			discord_core_internal::co_routine_frame_pool::deallocate(ptr, size);
+		}
+
+		/// @brief Resumes the awaiting co_routine, if there is one, directly from the final suspension point via symmetric transfer.
+		class final_awaiter {
+		  public:
+			inline bool await_ready() const noexcept {
+				return false;
+			}
+
+			inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> coroHandleNew) noexcept {
+				return promise->complete(coroHandleNew);
+			}
+
+			inline void await_resume() noexcept {
+			}
+
+			co_routine_promise_base* promise{};
+		};
+
+		/// @brief Registers a co_routine to resume once this one completes.
+		/// @param continuationNew the awaiting co_routine.
+		/// @return false if this co_routine has already completed, in which case the awaiting co_routine should simply carry on.
+		inline bool setContinuation(std::coroutine_handle<> continuationNew) {
+			void* expected{};
+			return continuation.compare_exchange_strong(expected, continuationNew.address(), std::memory_order_acq_rel, std::memory_order_acquire);
+		}
+
+		inline void requestStop() {
+			std::unique_lock lock{ stopMutex };
+			areWeStoppedBool.store(true, std::memory_order_release);
+			auto callback = std::move(stopCallback);
+			stopCallback  = nullptr;
+			if (!callback) {
+				return;
+			}
+			// Run unlocked, so that it can take its own locks - clearStopCallback() waits for it instead.
+			stopCallbackRunning = true;
+			lock.unlock();
+			callback();
+			lock.lock();
+			stopCallbackRunning = false;
+			stopCondition.notify_all();
+		}
+
+		inline bool stopRequested() {
+			return areWeStoppedBool.load(std::memory_order_acquire);
+		}
+
+		/// @brief Registers a function to run once if a stop is requested while the co_routine is suspended - so that an awaitable can wake it early.
+		/// @param callbackNew the function to run, on the thread that requests the stop.
+		/// @return false if a stop has already been requested, in which case the function isn't registered.
+		inline bool setStopCallback(std::function<void()> callbackNew) {
+			std::unique_lock lock{ stopMutex };
+			if (areWeStoppedBool.load(std::memory_order_acquire)) {
+				return false;
+			}
+			stopCallback = std::move(callbackNew);
+			return true;
+		}
+
+		/// @brief Unregisters the function registered by setStopCallback(), waiting for it to finish if a stop request is running it - so that nothing it
+		/// uses goes away underneath it. Mustn't be called while holding a lock that the function takes.
+		inline void clearStopCallback() {
+			std::unique_lock lock{ stopMutex };
+			stopCallback = nullptr;
+			stopCondition.wait(lock, [this] {
+				return !stopCallbackRunning;
+			});
+		}
+
+		/// @brief Blocks until the co_routine completes.
+		/// @param timeout how long to wait, or a zero duration to wait indefinitely.
+		/// @return false if the time ran out first.
+		inline bool waitForCompletion(milliseconds timeout = milliseconds{}) {
+			if (timeout.count() > 0) {
+				if (!completionSemaphore.try_acquire_for(timeout)) {
+					return false;
+				}
+			} else {
+				completionSemaphore.acquire();
+			}
+			// Hands the permit straight back, so that later waits see the completion too.
+			completionSemaphore.release();
+			return true;
+		}
+
+	  protected:
+		std::binary_semaphore completionSemaphore{ 0 };
+		std::function<void()> stopCallback{};
+		/// The frame is owned by both the co_routine object and its own execution - whichever lets go last destroys it.
+		std::atomic<uint8_t> frameReferences{ 2 };
+		std::atomic<void*> continuation{};
+		std::condition_variable stopCondition{};
+		std::atomic_bool areWeStoppedBool{};
+		bool stopCallbackRunning{};
+		std::mutex stopMutex{};
+		/// Guards the promise's pointers into its co_routine, which can be moved while the co_routine is still running.
+		std::mutex bufferMutex{};
+
+		/// The promise's own address marks completion, since no coroutine frame can share it.
+		inline void* completedState() {
+			return static_cast<void*>(this);
+		}
+
+		/// Must be the last use of the promise by its caller, since it can destroy the frame.
+		inline void releaseFrame(std::coroutine_handle<> coroHandleNew) noexcept {
+			if (frameReferences.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				coroHandleNew.destroy();
+			}
+		}
+
+		inline std::coroutine_handle<> complete(std::coroutine_handle<> coroHandleNew) noexcept {
+			void* continuationNew{ continuation.exchange(completedState(), std::memory_order_acq_rel) };
+			completionSemaphore.release();
+			releaseFrame(coroHandleNew);
+			if (continuationNew) {
+				return std::coroutine_handle<>::from_address(continuationNew);
+			}
+			return std::noop_coroutine();
+		}
+	};
+
 	/// @brief A co_routine - representing a potentially asynchronous operation/function.
 	/// \tparam return_type the type of parameter that is returned by the co_routine.
 	template<typename return_type_new, bool timeOut> class co_routine {
 	  public:
 		using return_type = return_type_new;///< The return type of this co_routine.
 
-		class promise_type {
+		class promise_type : public co_routine_promise_base {
 		  public:
 			template<typename return_type02, bool timeOut02> friend class co_routine;
 
-			inline void requestStop() {
-				areWeStoppedBool.store(true, std::memory_order_release);
-			}
-
-			inline bool stopRequested() {
-				return areWeStoppedBool.load(std::memory_order_acquire);
-			}
-
 			template<typename return_type_newer> inline void return_value(return_type_newer&& returnValue) {
+				std::unique_lock lock{ bufferMutex };
 				if (resultBuffer) {
 					resultBuffer->setResult(std::forward<return_type_newer>(returnValue));
 				}
@@ -107,17 +242,15 @@ namespace discord_core_api {
 			}
 
 			inline std::suspend_never initial_suspend() {
-				while (!resultBuffer) {
-					std::this_thread::sleep_for(1ms);
-				}
 				return {};
 			}
 
-			inline std::suspend_always final_suspend() noexcept {
-				return {};
+			inline final_awaiter final_suspend() noexcept {
+				return final_awaiter{ this };
 			}
 
 			inline void unhandled_exception() {
+				std::unique_lock lock{ bufferMutex };
 				if (exceptionBuffer) {
 					exceptionBuffer->setResult(std::current_exception());
 				}
@@ -131,17 +264,22 @@ namespace discord_core_api {
 		  protected:
 			result_holder<std::exception_ptr>* exceptionBuffer{};
 			result_holder<return_type>* resultBuffer{};
-			std::atomic_bool areWeStoppedBool{};
 		};
 
 		inline co_routine() = default;
 
 		inline co_routine& operator=(co_routine<return_type, timeOut>&& other) noexcept {
 			if (this != &other) {
-				coroutineHandle							  = other.coroutineHandle;
-				other.coroutineHandle					  = nullptr;
-				coroutineHandle.promise().exceptionBuffer = &exceptionBuffer;
-				coroutineHandle.promise().resultBuffer	  = &resultBuffer;
+				releaseFrame();
+				coroutineHandle		  = other.coroutineHandle;
+				other.coroutineHandle = nullptr;
+				if (coroutineHandle) {
+					std::unique_lock lock{ coroutineHandle.promise().bufferMutex };
+					exceptionBuffer.takeResult(other.exceptionBuffer);
+					resultBuffer.takeResult(other.resultBuffer);
+					coroutineHandle.promise().exceptionBuffer = &exceptionBuffer;
+					coroutineHandle.promise().resultBuffer	  = &resultBuffer;
+				}
 				currentStatus.store(other.currentStatus.load(std::memory_order_acquire), std::memory_order_release);
 				other.currentStatus.store(co_routine_status::cancelled, std::memory_order_release);
 			}
@@ -156,7 +294,8 @@ namespace discord_core_api {
 		inline co_routine(const co_routine<return_type, timeOut>& other)			= delete;
 
 		inline co_routine& operator=(std::coroutine_handle<promise_type> coroutineHandleNew) {
-			coroutineHandle							  = coroutineHandleNew;
+			coroutineHandle = coroutineHandleNew;
+			std::unique_lock lock{ coroutineHandle.promise().bufferMutex };
 			coroutineHandle.promise().exceptionBuffer = &exceptionBuffer;
 			coroutineHandle.promise().resultBuffer	  = &resultBuffer;
 			return *this;
@@ -167,10 +306,7 @@ namespace discord_core_api {
 		};
 
 		inline ~co_routine() {
-			if (coroutineHandle) {
-				coroutineHandle.promise().exceptionBuffer = nullptr;
-				coroutineHandle.promise().resultBuffer	  = nullptr;
-			}
+			releaseFrame();
 		}
 
 		/// @brief Collects the status of the co_routine.
@@ -190,18 +326,8 @@ namespace discord_core_api {
 		/// @return the final value resulting from the co_routine's execution.
 		inline return_type get() {
 			if (coroutineHandle) {
-				if (!coroutineHandle.done()) {
-					stop_watch<milliseconds> stopWatch{ 15000 };
-					stopWatch.reset();
-					while (!resultBuffer.checkForResult()) {
-						checkForExceptions();
-						if constexpr (timeOut) {
-							if (stopWatch.hasTimeElapsed()) {
-								return resultBuffer.getResult();
-							}
-						}
-						std::this_thread::sleep_for(1ms);
-					}
+				if (!waitForCompletion()) {
+					return resultBuffer.getResult();
 				}
 				checkForExceptions();
 				currentStatus.store(co_routine_status::complete, std::memory_order_release);
@@ -218,17 +344,9 @@ namespace discord_core_api {
 			if (coroutineHandle) {
 				if (!coroutineHandle.done()) {
 					coroutineHandle.promise().requestStop();
-					stop_watch<milliseconds> stopWatch{ 15000 };
-					stopWatch.reset();
-					while (!resultBuffer.checkForResult()) {
-						checkForExceptions();
-						if constexpr (timeOut) {
-							if (stopWatch.hasTimeElapsed()) {
-								return resultBuffer.getResult();
-							}
-						}
-						std::this_thread::sleep_for(1ms);
-					}
+				}
+				if (!waitForCompletion()) {
+					return resultBuffer.getResult();
 				}
 				checkForExceptions();
 				currentStatus.store(co_routine_status::cancelled, std::memory_order_release);
@@ -239,6 +357,13 @@ namespace discord_core_api {
 			}
 		}
 
+		/// @brief Asks the co_routine to stop, without waiting for it or collecting its result.
+		inline void requestStop() {
+			if (coroutineHandle) {
+				coroutineHandle.promise().requestStop();
+			}
+		}
+
 		/// @brief Cancels the currently executing co_routine and returns the current result.
 		/// @return the final value resulting from the co_routine's execution.
 		inline return_type cancel() {
@@ -255,17 +380,69 @@ namespace discord_core_api {
 			}
 		}
 
+		/// @brief Awaits the co_routine from another one - the awaiting co_routine is suspended, and resumed directly from this one's final
+		/// suspension point, instead of a thread blocking in get().
+		class awaiter {
+		  public:
+			inline bool await_ready() const {
+				return false;
+			}
+
+			inline bool await_suspend(std::coroutine_handle<> coroHandleNew) {
+				return parent->coroutineHandle.promise().setContinuation(coroHandleNew);
+			}
+
+			inline return_type await_resume() {
+				parent->checkForExceptions();
+				parent->currentStatus.store(co_routine_status::complete, std::memory_order_release);
+				return parent->resultBuffer.getResult();
+			}
+
+			co_routine* parent{};
+		};
+
+		/// @brief Makes the co_routine awaitable - co_await someFunctionAsync().
+		/// @return awaiter an awaitable for the co_routine's result.
+		inline awaiter operator co_await() {
+			if (!coroutineHandle) {
+				throw co_routine_error{ "co_routine::operator co_await(), you awaited a co_routine that is "
+										"not in a valid state." };
+			}
+			return awaiter{ this };
+		}
+
 	  protected:
 		std::atomic<co_routine_status> currentStatus{ co_routine_status::idle };
 		std::coroutine_handle<promise_type> coroutineHandle{};
 		result_holder<std::exception_ptr> exceptionBuffer{};
 		result_holder<return_type> resultBuffer{};
 
+		/// Detaches from the frame, destroying it if the co_routine has already finished.
+		inline void releaseFrame() {
+			if (coroutineHandle) {
+				std::unique_lock lock{ coroutineHandle.promise().bufferMutex };
+				coroutineHandle.promise().exceptionBuffer = nullptr;
+				coroutineHandle.promise().resultBuffer	  = nullptr;
+				lock.unlock();
+				coroutineHandle.promise().releaseFrame(coroutineHandle);
+				coroutineHandle = nullptr;
+			}
+		}
+
 		inline void checkForExceptions() {
 			if (exceptionBuffer.checkForResult()) {
 				std::rethrow_exception(exceptionBuffer.getResult());
 			}
 		}
+
+		/// Waits on the promise's semaphore rather than polling - bounded at 15 seconds, like before, when timeOut is set.
+		inline bool waitForCompletion() {
+			if constexpr (timeOut) {
+				return coroutineHandle.promise().waitForCompletion(milliseconds{ 15000 });
+			} else {
+				return coroutineHandle.promise().waitForCompletion();
+			}
+		}
 	};
 
 	/// @brief A co_routine - representing a potentially asynchronous operation/function.
@@ -274,18 +451,10 @@ namespace discord_core_api {
 	  public:
 		using return_type = return_type_new;///< The return type of this co_routine.
 
-		class promise_type {
+		class promise_type : public co_routine_promise_base {
 		  public:
 			template<typename return_type02, bool timeOut02> friend class co_routine;
 
-			inline void requestStop() {
-				areWeStoppedBool.store(true, std::memory_order_release);
-			}
-
-			inline bool stopRequested() {
-				return areWeStoppedBool.load(std::memory_order_acquire);
-			}
-
 			inline void return_void() {
 				return;
 			};
@@ -295,20 +464,19 @@ namespace discord_core_api {
 			}
 
 			inline std::suspend_never initial_suspend() {
-				while (!resultBuffer) {
-					std::this_thread::sleep_for(1ms);
-				}
 				return {};
 			}
 
-			inline std::suspend_always final_suspend() noexcept {
+			inline final_awaiter final_suspend() noexcept {
+				std::unique_lock lock{ bufferMutex };
 				if (resultBuffer) {
 					resultBuffer->store(true);
 				}
-				return {};
+				return final_awaiter{ this };
 			}
 
 			inline void unhandled_exception() {
+				std::unique_lock lock{ bufferMutex };
 				if (exceptionBuffer) {
 					exceptionBuffer->setResult(std::current_exception());
 				}
@@ -321,7 +489,6 @@ namespace discord_core_api {
 
 		  protected:
 			result_holder<std::exception_ptr>* exceptionBuffer{};
-			std::atomic_bool areWeStoppedBool{};
 			std::atomic_bool* resultBuffer{};
 		};
 
@@ -329,10 +496,16 @@ namespace discord_core_api {
 
 		inline co_routine& operator=(co_routine<return_type, timeOut>&& other) noexcept {
 			if (this != &other) {
-				coroutineHandle							  = other.coroutineHandle;
-				other.coroutineHandle					  = nullptr;
-				coroutineHandle.promise().exceptionBuffer = &exceptionBuffer;
-				coroutineHandle.promise().resultBuffer	  = &resultBuffer;
+				releaseFrame();
+				coroutineHandle		  = other.coroutineHandle;
+				other.coroutineHandle = nullptr;
+				if (coroutineHandle) {
+					std::unique_lock lock{ coroutineHandle.promise().bufferMutex };
+					exceptionBuffer.takeResult(other.exceptionBuffer);
+					resultBuffer.store(other.resultBuffer.exchange(false, std::memory_order_acq_rel), std::memory_order_release);
+					coroutineHandle.promise().exceptionBuffer = &exceptionBuffer;
+					coroutineHandle.promise().resultBuffer	  = &resultBuffer;
+				}
 				currentStatus.store(other.currentStatus.load(std::memory_order_acquire), std::memory_order_release);
 				other.currentStatus.store(co_routine_status::cancelled, std::memory_order_release);
 			}
@@ -347,7 +520,8 @@ namespace discord_core_api {
 		inline co_routine(const co_routine<return_type, timeOut>& other)			= delete;
 
 		inline co_routine& operator=(std::coroutine_handle<promise_type> coroutineHandleNew) {
-			coroutineHandle							  = coroutineHandleNew;
+			coroutineHandle = coroutineHandleNew;
+			std::unique_lock lock{ coroutineHandle.promise().bufferMutex };
 			coroutineHandle.promise().exceptionBuffer = &exceptionBuffer;
 			coroutineHandle.promise().resultBuffer	  = &resultBuffer;
 			return *this;
@@ -358,10 +532,7 @@ namespace discord_core_api {
 		};
 
 		inline ~co_routine() {
-			if (coroutineHandle) {
-				coroutineHandle.promise().exceptionBuffer = nullptr;
-				coroutineHandle.promise().resultBuffer	  = nullptr;
-			}
+			releaseFrame();
 		}
 
 		/// @brief Collects the status of the co_routine.
@@ -380,18 +551,8 @@ namespace discord_core_api {
 		/// @brief Gets the resulting value of the co_routine.
 		inline void get() {
 			if (coroutineHandle) {
-				if (!coroutineHandle.done()) {
-					stop_watch<milliseconds> stopWatch{ 15000 };
-					stopWatch.reset();
-					while (!resultBuffer.load()) {
-						checkForExceptions();
-						if constexpr (timeOut) {
-							if (stopWatch.hasTimeElapsed()) {
-								return;
-							}
-						}
-						std::this_thread::sleep_for(1ms);
-					}
+				if (!waitForCompletion()) {
+					return;
 				}
 				checkForExceptions();
 				currentStatus.store(co_routine_status::complete, std::memory_order_release);
@@ -407,17 +568,9 @@ namespace discord_core_api {
 			if (coroutineHandle) {
 				if (!coroutineHandle.done()) {
 					coroutineHandle.promise().requestStop();
-					stop_watch<milliseconds> stopWatch{ 15000 };
-					stopWatch.reset();
-					while (!resultBuffer.load()) {
-						checkForExceptions();
-						if constexpr (timeOut) {
-							if (stopWatch.hasTimeElapsed()) {
-								return;
-							}
-						}
-						std::this_thread::sleep_for(1ms);
-					}
+				}
+				if (!waitForCompletion()) {
+					return;
 				}
 				checkForExceptions();
 				currentStatus.store(co_routine_status::cancelled, std::memory_order_release);
@@ -428,6 +581,13 @@ namespace discord_core_api {
 			}
 		}
 
+		/// @brief Asks the co_routine to stop, without waiting for it or collecting its result.
+		inline void requestStop() {
+			if (coroutineHandle) {
+				coroutineHandle.promise().requestStop();
+			}
+		}
+
 		/// @brief Cancels the currently executing co_routine and returns the current result.
 		inline void cancel() {
 			if (coroutineHandle) {
@@ -443,17 +603,68 @@ namespace discord_core_api {
 			}
 		}
 
+		/// @brief Awaits the co_routine from another one - the awaiting co_routine is suspended, and resumed directly from this one's final
+		/// suspension point, instead of a thread blocking in get().
+		class awaiter {
+		  public:
+			inline bool await_ready() const {
+				return false;
+			}
+
+			inline bool await_suspend(std::coroutine_handle<> coroHandleNew) {
+				return parent->coroutineHandle.promise().setContinuation(coroHandleNew);
+			}
+
+			inline void await_resume() {
+				parent->checkForExceptions();
+				parent->currentStatus.store(co_routine_status::complete, std::memory_order_release);
+			}
+
+			co_routine* parent{};
+		};
+
+		/// @brief Makes the co_routine awaitable - co_await someFunctionAsync().
+		/// @return awaiter an awaitable for the co_routine's result.
+		inline awaiter operator co_await() {
+			if (!coroutineHandle) {
+				throw co_routine_error{ "co_routine::operator co_await(), you awaited a co_routine that is "
+										"not in a valid state." };
+			}
+			return awaiter{ this };
+		}
+
 	  protected:
 		std::atomic<co_routine_status> currentStatus{ co_routine_status::idle };
 		std::coroutine_handle<promise_type> coroutineHandle{};
 		result_holder<std::exception_ptr> exceptionBuffer{};
 		std::atomic_bool resultBuffer{};
 
+		/// Detaches from the frame, destroying it if the co_routine has already finished.
+		inline void releaseFrame() {
+			if (coroutineHandle) {
+				std::unique_lock lock{ coroutineHandle.promise().bufferMutex };
+				coroutineHandle.promise().exceptionBuffer = nullptr;
+				coroutineHandle.promise().resultBuffer	  = nullptr;
+				lock.unlock();
+				coroutineHandle.promise().releaseFrame(coroutineHandle);
+				coroutineHandle = nullptr;
+			}
+		}
+
 		inline void checkForExceptions() {
 			if (exceptionBuffer.checkForResult()) {
 				std::rethrow_exception(exceptionBuffer.getResult());
 			}
 		}
+
+		/// Waits on the promise's semaphore rather than polling - bounded at 15 seconds, like before, when timeOut is set.
+		inline bool waitForCompletion() {
+			if constexpr (timeOut) {
+				return coroutineHandle.promise().waitForCompletion(milliseconds{ 15000 });
+			} else {
+				return coroutineHandle.promise().waitForCompletion();
+			}
+		}
 	};
 
 	class new_thread_awaiter_base {
@@ -470,8 +681,9 @@ namespace discord_core_api {
 		}
 
 		inline void await_suspend(std::coroutine_handle<typename co_routine<return_type, timeOut>::promise_type> coroHandleNew) {
-			new_thread_awaiter_base::threadPool.submitTask(coroHandleNew);
+			// Stored first, since the pool may resume the co_routine, and read it back, before submitTask() returns.
 			coroHandle = coroHandleNew;
+			new_thread_awaiter_base::threadPool.submitTask(coroHandleNew);
 		}
 
 		inline auto await_resume() {
@@ -46,6 +46,12 @@ namespace discord_core_api {
 		/// @return a map containing the function names as well as unique_ptrs to the functions.
 		unordered_map<jsonifier::vector<jsonifier::string>, unique_ptr<base_function>>& getFunctions();
 
+		/// @brief Collects the registered command names and aliases that start with a prefix, ignoring case.
+		/// @param prefix the prefix to match.
+		/// @param limit the maximum number of names to collect.
+		/// @return the matching names, lowercased and in alphabetical order.
+		jsonifier::vector<jsonifier::string> getCommandNamesByPrefix(jsonifier::string_view prefix, uint64_t limit = 25);
+
 		co_routine<void> checkForAndRunCommand(command_data&& commandData);
 
 	  protected:
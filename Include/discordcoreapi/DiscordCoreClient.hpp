@@ -51,9 +51,14 @@
 #include <discordcoreapi/StickerEntities.hpp>
 #include <discordcoreapi/ThreadEntities.hpp>
 #include <discordcoreapi/UserEntities.hpp>
+#include <discordcoreapi/Utilities/ClusterCoordinator.hpp>
+#include <discordcoreapi/Utilities/GuildMemberChunkRequester.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <discordcoreapi/Utilities/InteractionEndpoint.hpp>
 #include <discordcoreapi/Utilities/TCPConnection.hpp>
+#include <discordcoreapi/Utilities/TaskGroup.hpp>
+#include <discordcoreapi/Utilities/TimerWheel.hpp>
 #include <discordcoreapi/Utilities/WebSocketClient.hpp>
 #include <discordcoreapi/VoiceConnection.hpp>
 #include <discordcoreapi/WebHookEntities.hpp>
@@ -104,14 +109,11 @@ namespace discord_core_api {
 	template<typename... arg_types>
 	inline static co_routine<void, false> threadFunction(time_elapsed_handler<arg_types...> timeElapsedHandler, bool repeated, int64_t timeInterval, arg_types... args) {
 		auto threadHandle = co_await newThreadAwaitable<void, false>();
-		stop_watch<milliseconds> stopWatch{ milliseconds{ timeInterval } };
-		stopWatch.reset();
+		auto nextTime	  = hrclock::now();
 		do {
-			std::this_thread::sleep_for(milliseconds{ static_cast<int64_t>(std::ceil(static_cast<float>(timeInterval) * 10.0f / 100.0f)) });
-			while (!stopWatch.hasTimeElapsed() && !threadHandle.promise().stopRequested()) {
-				std::this_thread::sleep_for(1ms);
-			}
-			stopWatch.reset();
+			// Waiting on the timer wheel leaves the pool thread free, and aiming at a fixed schedule keeps repeated calls from drifting.
+			nextTime += milliseconds{ timeInterval };
+			co_await after(std::chrono::duration_cast<milliseconds>(nextTime - hrclock::now()));
 			if (threadHandle.promise().stopRequested()) {
 				co_return;
 			}
@@ -123,7 +125,6 @@ namespace discord_core_api {
 			if (threadHandle.promise().stopRequested()) {
 				co_return;
 			}
-			std::this_thread::sleep_for(1ms);
 		} while (repeated);
 		co_return;
 	};
@@ -148,6 +149,7 @@ namespace discord_core_api {
 		friend class discord_core_internal::websocket_core;
 		friend class voice_connection;
 		friend class guild_data;
+		friend class guild_members;
 		friend class bot_user;
 		friend class guilds;
 
@@ -186,6 +188,34 @@ namespace discord_core_api {
 		/// @return event_manager& a reference to the event_manager.
 		event_manager& getEventManager();
 
+		/// @brief For collecting the queue metrics of the gateway event lanes.
+		/// @return jsonifier::vector<gateway_lane_metrics> the metrics of each lane.
+		jsonifier::vector<gateway_lane_metrics> getGatewayLaneMetrics();
+
+		/// @brief For collecting the latency metrics of interaction responses, from gateway receipt to acknowledgement.
+		/// @return interaction_response_metrics the metrics of the interaction response lane.
+		interaction_response_metrics getInteractionResponseMetrics();
+
+		/// @brief For running a query on the cluster process that owns a guild's shard, or on this one if it's ours - see cluster_options.
+		/// @param name the query's name - "guild", and "guild_member" with the member's id as the argument, are built in and answer in json.
+		/// @param guildId the guild, whose shard picks the process.
+		/// @param argument the query's argument, without any line breaks.
+		/// @return jsonifier::string the answer - empty if there wasn't one, or if the bot isn't part of a cluster.
+		jsonifier::string queryCluster(jsonifier::string_view name, snowflake guildId, jsonifier::string_view argument = jsonifier::string_view{});
+
+		/// @brief For answering queries from the cluster's other processes.
+		/// @param name the query's name, without any spaces.
+		/// @param handler called with the guild and the argument, on the cluster's own thread - its answer mustn't contain any line breaks.
+		void registerClusterQueryHandler(jsonifier::string_view name, discord_core_internal::cluster_client::query_handler handler);
+
+		/// @brief For collecting the host's cpus and their numa nodes, to choose the cpus in thread_placement_options from.
+		/// @return jsonifier::vector<cpu_core_data> the cpus, in order.
+		static jsonifier::vector<cpu_core_data> getCpuTopology();
+
+		/// @brief For collecting the shards' progress through startup.
+		/// @return shard_startup_progress the number of shards queued, connecting and ready.
+		shard_startup_progress getShardStartupProgress();
+
 		/// @brief For collecting, the total time in milliseconds that this bot has been up for.
 		/// @return milliseconds a size, in milliseconds, since the bot has come online.
 		milliseconds getTotalUpTime();
@@ -209,27 +239,42 @@ namespace discord_core_api {
 		discord_core_client& operator=(const discord_core_client&) = delete;
 		discord_core_client(const discord_core_client&)			   = delete;
 
+		// Declared ahead of the socket agents, so that they outlive their threads.
+		unique_ptr<discord_core_internal::cluster_coordinator> clusterCoordinator{};
+		unique_ptr<discord_core_internal::cluster_client> clusterClient{};
+		unique_ptr<discord_core_internal::guild_member_chunk_requester> guildMemberChunkRequester{};
+		unique_ptr<discord_core_internal::shard_startup_scheduler> shardStartupScheduler{};
 		unordered_map<uint64_t, unique_ptr<discord_core_internal::base_socket_agent>> baseSocketAgentsMap{};
 		std::deque<create_application_command_data> commandsToRegister{};
 		unique_ptr<discord_core_internal::https_client> httpsClient{};
-		stop_watch<milliseconds> connectionStopWatch01{ 5000ms };
 #if defined(_WIN32)
 		discord_core_internal::wsadata_wrapper theWSAData{};
 #endif
-		std::atomic_uint64_t currentlyConnectingShard{};
 		std::atomic_bool areWeReadyToConnect{ false };
 		command_controller commandController{};
 		milliseconds startupTimeSinceEpoch{};
 		config_manager configManager{};
 		event_manager eventManager{};///< An event-manager, for hooking into discord-api-events sent over the websockets.
+		unique_ptr<discord_core_internal::gateway_event_executor> gatewayEventExecutor{};
+		unique_ptr<discord_core_internal::interaction_endpoint> interactionEndpoint{};
+
+		/// @brief Marks the shards whose sessions were saved by the last process to resume them, rather than identify.
+		void loadSessionState();
 
-		bool areWeFullyConnected();
+		/// @brief Closes the shards without ending their sessions, and saves the sessions for the next process to resume.
+		void saveSessionState();
+
+		/// @brief Starts the cluster's coordinator if this process hosts it, and collects this process's shards from it.
+		/// @param gatewayData the gateway's details, filled in from the coordinator if this process didn't collect them itself.
+		bool joinCluster(gateway_bot_data& gatewayData);
 
 		void registerFunctionsInternal();
 
 		gateway_bot_data getGateWayBot();
 
 		bool instantiateWebSockets();
+
+		void startFunctionsToExecute();
 	};
 	/**@}*/
 }// namespace discord_core_api
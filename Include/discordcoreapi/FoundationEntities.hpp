@@ -49,6 +49,19 @@ namespace discord_core_api {
 			operator discord_core_internal::etf_serializer();
 		};
 
+		/// @brief A shard's session, as saved for the next process to resume.
+		struct shard_session_data {
+			jsonifier::string resumeUrl{};
+			jsonifier::string sessionId{};
+			uint64_t lastNumberReceived{};
+			uint64_t shardCount{};
+			uint64_t shardId{};
+		};
+
+		struct session_state_data {
+			jsonifier::vector<shard_session_data> shards{};
+		};
+
 		struct connect_properties {
 			static constexpr jsonifier::string_view browser{ "DiscordCoreAPI" };
 			static constexpr jsonifier::string_view device{ "DiscordCoreAPI" };
@@ -1152,6 +1165,7 @@ namespace discord_core_api {
 		jsonifier::string topic{};///< channel_data topic.
 		jsonifier::string name{};///< Name of the channel_data.
 		uint32_t memberCount{};///< count of members active in the channel_data.
+		uint32_t bitrate{};///< The bitrate (in bits) of the voice channel_data.
 		snowflake parentId{};///< snowflake of the channel_data's parent channel_data/category.
 		channel_flags flags{};///< Flags combined as a bitmask.
 		uint32_t position{};///< The position of the channel_data, in the guild's channel_data list.
@@ -1388,6 +1402,19 @@ namespace discord_core_api {
 		operator discord_core_internal::etf_serializer();
 	};
 
+	/// @brief The payload of a request guild members gateway command.
+	struct request_guild_members_payload {
+		unordered_set<jsonifier::string> jsonifierExcludedKeys{};
+		jsonifier::vector<snowflake> userIds{};///< Specific members to send - when set, the query and limit are left out.
+		jsonifier::string query{};///< Only members whose username starts with this.
+		jsonifier::string nonce{};///< Sent back on each of the request's chunks.
+		snowflake guildId{};///< The guild to send the members of.
+		uint32_t limit{};///< The most members to send - 0 for every member, when the query is empty.
+		bool presences{};///< Whether to send the members' presences too.
+
+		operator discord_core_internal::etf_serializer();
+	};
+
 	/// @brief Team object data.
 	class team_object_data {
 	  public:
@@ -2387,9 +2414,10 @@ namespace discord_core_api {
 		/// @param selfDeaf whether or not to self-deafen the bot.
 		/// @param selfMute whether or not to self-mute the bot.
 		/// @param streamInfoNew for usage with the vc-to-vc audio streaming option.
+		/// @param encoderSettings the settings for the connection's opus encoder.
 		/// @return voice_connection* a pointer to the currently held voice connection, or nullptr if it failed to connect.
 		inline voice_connection& connectToVoice(const snowflake guildMemberId, const snowflake channelId = 0, bool selfDeaf = false, bool selfMute = false,
-			stream_info streamInfoNew = stream_info{}) {
+			stream_info streamInfoNew = stream_info{}, const audio_encoder_settings& encoderSettings = audio_encoder_settings{}) {
 			if (static_cast<discord_core_client_t*>(static_cast<value_type*>(this)->getDiscordCoreClient())
 					->getVoiceConnection(static_cast<value_type*>(this)->id)
 					.areWeConnected()) {
@@ -2413,13 +2441,14 @@ namespace discord_core_api {
 				int32_t theShardId{ static_cast<int32_t>((static_cast<value_type*>(this)->id.operator const uint64_t&() >> 22) %
 					static_cast<discord_core_client_t*>(static_cast<value_type*>(this)->getDiscordCoreClient())->getConfigManager().getTotalShardCount()) };
 				voice_connect_init_data voiceConnectInitData{};
-				voiceConnectInitData.currentShard = theShardId;
-				voiceConnectInitData.streamInfo	  = streamInfoNew;
-				voiceConnectInitData.channelId	  = channelIdNew;
-				voiceConnectInitData.guildId	  = static_cast<value_type*>(this)->id;
-				voiceConnectInitData.userId		  = static_cast<discord_core_client_t*>(static_cast<value_type*>(this)->getDiscordCoreClient())->getBotUser().id;
-				voiceConnectInitData.selfDeaf	  = selfDeaf;
-				voiceConnectInitData.selfMute	  = selfMute;
+				voiceConnectInitData.encoderSettings = encoderSettings;
+				voiceConnectInitData.currentShard	 = theShardId;
+				voiceConnectInitData.streamInfo		 = streamInfoNew;
+				voiceConnectInitData.channelId		 = channelIdNew;
+				voiceConnectInitData.guildId		 = static_cast<value_type*>(this)->id;
+				voiceConnectInitData.userId			 = static_cast<discord_core_client_t*>(static_cast<value_type*>(this)->getDiscordCoreClient())->getBotUser().id;
+				voiceConnectInitData.selfDeaf		 = selfDeaf;
+				voiceConnectInitData.selfMute		 = selfMute;
 				auto& voiceConnectionNew =
 					static_cast<discord_core_client_t*>(static_cast<value_type*>(this)->getDiscordCoreClient())->getVoiceConnection(static_cast<value_type*>(this)->id);
 				stop_watch<milliseconds> stopWatch{ milliseconds{ 10000 } };
@@ -2981,7 +3010,8 @@ namespace discord_core_api {
 	enum class song_type : uint8_t {
 		Neutral	   = 0,///< For either type.
 		YouTube	   = 1,///< You_tube.
-		SoundCloud = 2///< Sound_cloud.
+		SoundCloud = 2,///< Sound_cloud.
+		Local	   = 3///< A pre-encoded .opus, .ogg or .webm file on disk.
 	};
 
 	/// @brief Represents a download url.
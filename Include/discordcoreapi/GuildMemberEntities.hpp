@@ -55,6 +55,25 @@ namespace discord_core_api {
 		int32_t limit{};///< Max number of members to return (1 - 1000).
 	};
 
+	/// @brief For requesting a guild's members over the gateway, to be cached as their chunks arrive.
+	struct request_guild_members_data {
+		jsonifier::vector<snowflake> userIds{};///< Specific members to request - leave it empty to request by the query.
+		jsonifier::string query{};///< Only members whose username starts with this - leave it empty with a limit of 0 for every member.
+		snowflake guildId{};///< The guild to request the members of.
+		uint32_t maxTimeInMs{ 60000 };///< The longest to wait for the request's last chunk, including its time in the queue.
+		uint32_t limit{};///< The most members to send.
+		bool presences{};///< Whether to request the members' presences too - requires the guild presences intent.
+	};
+
+	/// @brief The outcome of a request_guild_members_data.
+	struct request_guild_members_result {
+		jsonifier::vector<jsonifier::string> notFound{};///< The requested user ids that weren't members of the guild.
+		uint64_t memberCount{};///< The members that were received, and cached.
+		uint64_t chunkCount{};///< The chunks that were received.
+		snowflake guildId{};///< The guild that was requested.
+		bool completed{};///< Whether the last chunk arrived in time.
+	};
+
 	/// @brief For searching for one or more guild_members within a chosen guild.
 	struct search_guild_members_data {
 		snowflake guildId{};///< Guild within which to search for the guild_members.
@@ -172,6 +191,13 @@ namespace discord_core_api {
 		/// @return a co_routine containing guild_member_data.
 		static co_routine<guild_member_data> timeoutGuildMemberAsync(timeout_guild_member_data dataPackage);
 
+		/// @brief Requests the members of one or more guilds over the gateway, caching them as their chunks arrive - each request is queued on its guild's
+		/// shard, and the shards send their requests within a share of the gateway's rate limit, so that large batches can be submitted at once. The guilds
+		/// have to be on this process's shards.
+		/// @param dataPackages a request_guild_members_data structure for each guild.
+		/// @return a co_routine containing a request_guild_members_result for each request, in the same order.
+		static co_routine<jsonifier::vector<request_guild_members_result>> requestGuildMembersAsync(jsonifier::vector<request_guild_members_data> dataPackages);
+
 		template<typename voice_state_type> inline static void insertVoiceState(voice_state_type&& voiceState) {
 			if (doWeCacheVoiceStatesBool) {
 				if (voiceState.userId == 0) {
@@ -190,6 +216,33 @@ namespace discord_core_api {
 			}
 		}
 
+		/// @brief Caches a batch of a guild's members, under a single lock of the cache.
+		/// @param guildId the guild that the members belong to.
+		/// @param guildMembers the members, whose guild ids are set to the guild's - members without a user id are dropped.
+		inline static void insertGuildMembers(snowflake guildId, jsonifier::vector<guild_member_data>& guildMembers) {
+			if (doWeCacheGuildMembersBool) {
+				if (guildId == 0) {
+					throw dca_exception{ "Sorry, but there was no id set for that guild." };
+				}
+				uint64_t validCount{};
+				for (uint64_t x = 0; x < guildMembers.size(); ++x) {
+					if (guildMembers[x].user.id == 0) {
+						continue;
+					}
+					if (x != validCount) {
+						guildMembers[validCount] = std::move(guildMembers[x]);
+					}
+					guildMembers[validCount].guildId = guildId;
+					++validCount;
+				}
+				if (validCount < guildMembers.size()) {
+					message_printer::printError<print_message_type::general>("Sorry, but there was no id set for some of those guildmembers.");
+					guildMembers.resize(validCount);
+				}
+				cache.emplaceRange(guildMembers, std::identity{});
+			}
+		}
+
 		/// @brief Collect a given guild_member's voice state data.
 		/// @param voiceState A two-id-key representing their user-id and guild-id.
 		/// @return voice_state_data_light The guild_member's voice_state_data.
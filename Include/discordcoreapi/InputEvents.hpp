@@ -54,13 +54,13 @@ namespace discord_core_api {
 		static co_routine<void> deleteInputEventResponseAsync(input_event_data dataPackage, uint32_t timeDelayNew = 0);
 
 	  protected:
-		static input_event_data respondToInputEvent(create_ephemeral_interaction_response_data dataPackage);
+		static co_routine<input_event_data> respondToInputEventAsync(create_ephemeral_interaction_response_data dataPackage);
 
-		static input_event_data respondToInputEvent(create_deferred_interaction_response_data dataPackage);
+		static co_routine<input_event_data> respondToInputEventAsync(create_deferred_interaction_response_data dataPackage);
 
-		static input_event_data respondToInputEvent(create_ephemeral_follow_up_message_data dataPackage);
+		static co_routine<input_event_data> respondToInputEventAsync(create_interaction_response_data dataPackage);
 
-		static input_event_data respondToInputEvent(create_interaction_response_data dataPackage);
+		static input_event_data respondToInputEvent(create_ephemeral_follow_up_message_data dataPackage);
 
 		static input_event_data respondToInputEvent(edit_interaction_response_data dataPackage);
 
@@ -29,6 +29,7 @@
 /// \file InteractionEntities.hpp
 #pragma once
 
+#include <discordcoreapi/Utilities/EventEntities.hpp>
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/MessageEntities.hpp>
 #include <discordcoreapi/WebHookEntities.hpp>
@@ -413,7 +414,7 @@ namespace discord_core_api {
 	  public:
 		friend class discord_core_client;
 
-		static unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> selectMenuInteractionBuffersMap;
+		static discord_core_internal::collector_registry<interaction_data> selectMenuInteractionRegistry;
 		static discord_core_internal::trigger_event<void, interaction_data> selectMenuInteractionEventsMap;
 
 		/// @brief Constructor.
@@ -438,14 +439,13 @@ namespace discord_core_api {
 		~select_menu_collector();
 
 	  protected:
-		unbounded_message_block<interaction_data> selectMenuIncomingInteractionBuffer{};
+		discord_core_internal::collector_channel_ptr<interaction_data> selectMenuIncomingInteractionBuffer{ discord_core_internal::makeCollectorChannel<interaction_data>() };
 		unique_ptr<interaction_data> interactionData{ makeUnique<interaction_data>() };
 		jsonifier::vector<select_menu_response_data> responseVector{};
 		create_interaction_response_data errorMessageData{};
 		jsonifier::vector<jsonifier::string> values{};
 		uint32_t currentCollectedSelectMenuCount{};
 		uint32_t maxCollectedSelectMenuCount{};
-		jsonifier::string buffersMapKey{};
 		jsonifier::string selectMenuId{};
 		bool getSelectMenuDataForAll{};
 		uint32_t maxTimeInMs{};
@@ -454,7 +454,9 @@ namespace discord_core_api {
 		snowflake userId{};
 		bool doWeQuit{};
 
-		void run();
+		void processInteraction(const interaction_data& selectMenuInteractionData);
+
+		void processTimeout();
 	};
 
 	/// @brief Button response data.
@@ -510,7 +512,7 @@ namespace discord_core_api {
 	  public:
 		friend class discord_core_client;
 
-		static unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> buttonInteractionBuffersMap;
+		static discord_core_internal::collector_registry<interaction_data> buttonInteractionRegistry;
 		static discord_core_internal::trigger_event<void, interaction_data> buttonInteractionEventsMap;
 
 		/// @brief Constructor.
@@ -535,14 +537,13 @@ namespace discord_core_api {
 		~button_collector();
 
 	  protected:
+		discord_core_internal::collector_channel_ptr<interaction_data> buttonIncomingInteractionBuffer{ discord_core_internal::makeCollectorChannel<interaction_data>() };
 		unique_ptr<interaction_data> interactionData{ makeUnique<interaction_data>() };
-		unbounded_message_block<interaction_data> buttonIncomingInteractionBuffer{};
 		jsonifier::vector<button_response_data> responseVector{};
 		create_interaction_response_data errorMessageData{};
 		jsonifier::vector<jsonifier::string> values{};
 		uint32_t currentCollectedButtonCount{};
 		uint32_t maxCollectedButtonCount{};
-		jsonifier::string buffersMapKey{};
 		bool getButtonDataForAll{};
 		uint32_t maxTimeInMs{};
 		jsonifier::string buttonId{};
@@ -551,7 +552,9 @@ namespace discord_core_api {
 		snowflake userId{};
 		bool doWeQuit{};
 
-		void run();
+		void processInteraction(const interaction_data& buttonInteractionData);
+
+		void processTimeout();
 	};
 
 	/// @brief Button response data.
@@ -591,7 +594,7 @@ namespace discord_core_api {
 	  public:
 		friend class discord_core_client;
 
-		static unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> modalInteractionBuffersMap;
+		static discord_core_internal::collector_registry<interaction_data> modalInteractionRegistry;
 		static discord_core_internal::trigger_event<void, interaction_data> modalInteractionEventsMap;
 
 		/// @brief Constructor.
@@ -611,15 +614,12 @@ namespace discord_core_api {
 		~modal_collector();
 
 	  protected:
-		unbounded_message_block<interaction_data> modalIncomingInteractionBuffer{};
+		discord_core_internal::collector_channel_ptr<interaction_data> modalIncomingInteractionBuffer{ discord_core_internal::makeCollectorChannel<interaction_data>() };
 		create_interaction_response_data errorMessageData{};
 		uint32_t currentCollectedButtonCount{};
 		modal_response_data responseData{};
 		uint32_t maxTimeInMs{};
 		snowflake channelId{};
-		bool doWeQuit{};
-
-		void run();
 	};
 
 	/**@}*/
@@ -274,6 +274,12 @@ namespace jsonifier {
 			createValue("channel_id", &value_type::channelId, "guild_id", &value_type::guildId, "self_deaf", &value_type::selfDeaf, "self_mute", &value_type::selfMute);
 	};
 
+	template<> struct core<discord_core_api::request_guild_members_payload> {
+		using value_type				 = discord_core_api::request_guild_members_payload;
+		static constexpr auto parseValue = createValue("guild_id", &value_type::guildId, "user_ids", &value_type::userIds, "query", &value_type::query, "limit",
+			&value_type::limit, "presences", &value_type::presences, "nonce", &value_type::nonce);
+	};
+
 	template<> struct core<discord_core_api::guild_widget_data> {
 		using value_type				 = discord_core_api::guild_widget_data;
 		static constexpr auto parseValue = createValue("channel_id", &value_type::channelId, "enabled", &value_type::enabled);
@@ -739,6 +745,17 @@ namespace jsonifier {
 		static constexpr auto parseValue = createValue("token", &value_type::botToken, "session_id", &value_type::sessionId, "seq", &value_type::lastNumberReceived);
 	};
 
+	template<> struct core<discord_core_api::discord_core_internal::shard_session_data> {
+		using value_type				 = discord_core_api::discord_core_internal::shard_session_data;
+		static constexpr auto parseValue = createValue("resume_url", &value_type::resumeUrl, "session_id", &value_type::sessionId, "seq", &value_type::lastNumberReceived,
+			"shard_count", &value_type::shardCount, "shard_id", &value_type::shardId);
+	};
+
+	template<> struct core<discord_core_api::discord_core_internal::session_state_data> {
+		using value_type				 = discord_core_api::discord_core_internal::session_state_data;
+		static constexpr auto parseValue = createValue("shards", &value_type::shards);
+	};
+
 	template<> struct core<discord_core_api::discord_core_internal::voice_socket_protocol_payload_data_data> {
 		using value_type				 = discord_core_api::discord_core_internal::voice_socket_protocol_payload_data_data;
 		static constexpr auto parseValue = createValue("address", &value_type::address, "mode", &value_type::mode, "port", &value_type::port);
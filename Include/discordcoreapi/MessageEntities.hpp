@@ -31,6 +31,7 @@
 
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <discordcoreapi/Utilities/CollectorRegistry.hpp>
 #include <discordcoreapi/CoRoutine.hpp>
 
 namespace discord_core_api {
@@ -51,9 +52,11 @@ namespace discord_core_api {
 			jsonifier::vector<value_type> objects{};///< A vector of collected objects.
 		};
 
-		static unordered_map<jsonifier::string, unbounded_message_block<value_type>*> objectsBuffersMap;
+		static discord_core_internal::collector_registry<value_type> objectsRegistry;
 
-		object_collector();
+		/// @brief Constructor.
+		/// @param channelIdNew the channel to collect objects from, or 0 to collect them from every channel.
+		object_collector(snowflake channelIdNew = snowflake{});
 
 		/// @brief Begin waiting for objects.
 		/// @param quantityToCollect maximum quantity of objects to collect before returning the results.
@@ -62,18 +65,15 @@ namespace discord_core_api {
 		/// @return A object_collector_return_data structure.
 		co_routine<object_collector_return_data, false> collectObjects(int32_t quantityToCollect, int32_t msToCollectForNew, object_filter<value_type> filteringFunctionNew);
 
-		void run(std::coroutine_handle<
-			typename discord_core_api::co_routine<typename discord_core_api::object_collector<value_type>::object_collector_return_data, false>::promise_type>& coroHandle);
-
 		~object_collector();
 
 	  protected:
-		unbounded_message_block<value_type> objectsBuffer{};
+		discord_core_internal::collector_channel_ptr<value_type> objectsBuffer{ discord_core_internal::makeCollectorChannel<value_type>() };
 		object_collector_return_data objectReturnData{};
 		object_filter<value_type> filteringFunction{};
 		int32_t quantityOfObjectsToCollect{};
-		jsonifier::string collectorId{};
 		int32_t msToCollectFor{};
+		snowflake channelId{};
 	};
 
 	using message_collector = object_collector<message_data>;
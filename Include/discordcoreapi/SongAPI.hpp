@@ -31,16 +31,81 @@
 
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
+#include <discordcoreapi/Utilities/DownloadEngine.hpp>
+#include <discordcoreapi/Utilities/AudioSources.hpp>
 #include <discordcoreapi/GuildMemberEntities.hpp>
 #include <discordcoreapi/VoiceConnection.hpp>
 
 namespace discord_core_api {
 
+	namespace discord_core_internal {
+
+		/// @brief Where a song's download delivers its frames - straight into the guild's audio buffer, or into a staging buffer while the song is prefetched.
+		class DiscordCoreAPI_Dll song_stream_sink {
+		  public:
+			/// @brief Creates a sink that delivers straight into the guild's audio buffer.
+			/// @param guildIdNew the guild that the song is playing in.
+			song_stream_sink(snowflake guildIdNew);
+
+			/// @brief Creates a sink that stages its frames until goLive() is called.
+			/// @param guildIdNew the guild that the song will play in.
+			/// @param maxStagedDurationNew the most audio to stage.
+			/// @param maxStagedBytesNew the most memory to stage.
+			song_stream_sink(snowflake guildIdNew, milliseconds maxStagedDurationNew, uint64_t maxStagedBytesNew);
+
+			/// @brief Delivers a frame, waiting while the staging buffer is full.
+			/// @param frame the frame to deliver.
+			/// @param threadHandle the handle of the downloading co_routine, checked for cancellation while waiting.
+			/// @return false if the download was cancelled while waiting.
+			bool sendFrame(audio_frame_data&& frame, std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle);
+
+			/// @brief Signals that the whole song has been delivered.
+			void finish();
+
+			/// @brief Signals that the song could not be downloaded.
+			void fail();
+
+			/// @brief Moves the staged frames into the guild's audio buffer, and delivers every later frame there directly.
+			/// @return false if the download had already failed.
+			bool goLive();
+
+			/// @return how much audio is buffered ahead of playback, whether staged or live.
+			milliseconds getBufferedDuration();
+
+			bool isItLive();
+
+		  protected:
+			std::deque<audio_frame_data> stagedFrames{};
+			std::condition_variable stagingCondition{};
+			milliseconds maxStagedDuration{};
+			uint64_t maxStagedBytes{};
+			std::mutex accessMutex{};
+			uint64_t stagedBytes{};
+			snowflake guildId{};
+			bool didWeFinish{};
+			bool didWeFail{};
+			bool live{};
+
+			void sendCompletion();
+
+			/// Expects accessMutex to be held.
+			bool isStagingFull();
+		};
+
+	}
+
 	/**
 	 * \addtogroup voice_connection
 	 * @{
 	 */
 
+	/// @brief Settings for prefetching the upcoming songs of a queue.
+	struct song_prefetch_settings {
+		milliseconds bufferDuration{ 15000 };///< How much of the start of each upcoming song to buffer.
+		uint64_t maxBytes{ 4ULL * 1024ULL * 1024ULL };///< The memory cap, shared by all of the prefetched songs.
+		uint64_t depth{ 1 };///< How many upcoming songs to prefetch - 0 disables prefetching.
+	};
+
 	/// @brief A class representing the song apis.
 	class DiscordCoreAPI_Dll song_api {
 	  public:
@@ -92,11 +157,52 @@ namespace discord_core_api {
 		/// @return a bool suggesting the success or failure of the stop command.
 		bool stop();
 
+		/// @brief Resolves and buffers the start of the next songs in the queue in the background, so that playing them starts without a gap.
+		/// @param upcomingSongs the upcoming songs, in queue order - only the first prefetch-depth of them are prefetched.
+		void prefetch(const jsonifier::vector<song>& upcomingSongs);
+
+		/// @brief Sets the prefetch depth and memory cap.
+		/// @param settings the new settings.
+		void setPrefetchSettings(const song_prefetch_settings& settings);
+
+		/// @brief Collects the buffer-health metrics of the current song's download.
+		/// @return a download_health_metrics structure.
+		download_health_metrics getBufferHealth();
+
+		/// @brief Creates a song that plays a pre-encoded .opus, .ogg or .webm file from disk.
+		/// @param filePath the path of the file.
+		/// @return a song of type song_type::Local.
+		static song collectLocalSong(jsonifier::string_view filePath);
+
+		/// @brief Sets how many bytes of encoded audio the shared track cache may hold.
+		/// @param byteCount the new capacity - 0 disables the cache.
+		static void setTrackCacheCapacity(uint64_t byteCount);
+
 	  protected:
+		struct prefetched_song {
+			std::shared_ptr<discord_core_internal::song_stream_sink> sink{};
+			co_routine<void, false> task{};
+			song songVal{};
+		};
+
+		jsonifier::vector<unique_ptr<prefetched_song>> prefetchedSongs{};
+		song_prefetch_settings prefetchSettings{};
 		co_routine<void, false> taskThread{};
+		download_health_metrics bufferHealth{};
 		std::recursive_mutex accessMutex{};
+		std::mutex bufferHealthMutex{};
 		snowflake guildId{};
 
+		void updateBufferHealth(const download_health_metrics& metrics);
+
+		co_routine<void, false> streamCachedTrack(std::shared_ptr<const discord_core_internal::cached_track> track);
+
+		co_routine<void, false> streamLocalFile(const song songNew);
+
+		co_routine<void, false> prefetchSong(const song songNew, std::shared_ptr<discord_core_internal::song_stream_sink> sink);
+
+		void cancelPrefetches();
+
 		void disconnect();
 	};
 	/**@}*/
@@ -64,18 +64,19 @@ namespace discord_core_api {
 		  public:
 			sound_cloud_api(config_manager* configManagerNew, const snowflake guildId);
 
-			co_routine<void, false> downloadAndStreamAudio(const song songNew,
+			co_routine<void, false> downloadAndStreamAudio(const song songNew, std::shared_ptr<song_stream_sink> sink,
 				std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle = std::coroutine_handle<co_routine<void, false>::promise_type>{},
 				uint64_t currentReconnectTries											  = 0);
 
-			void weFailedToDownloadOrDecode(const song& songNew, std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle, uint64_t recursionDepth);
+			void weFailedToDownloadOrDecode(const song& songNew, std::shared_ptr<song_stream_sink> sink,
+				std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle, uint64_t recursionDepth);
 
 			jsonifier::vector<song> searchForSong(jsonifier::string_view searchQuery, uint64_t limit);
 
 			bool areWeWorking();
 
 		  protected:
-			std::atomic_bool areWeWorkingBool{ false };
+			std::atomic_uint64_t activeDownloads{};
 			snowflake guildId{};
 		};
 
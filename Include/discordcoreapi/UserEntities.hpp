@@ -149,6 +149,15 @@ namespace discord_core_api {
 		/// @return A co_routine containing an authorization_info_data.
 		static co_routine<authorization_info_data> getCurrentUserAuthorizationInfoAsync();
 
+		/// @brief Caches a batch of users, under a single lock of the cache.
+		/// @param values the values that hold the users.
+		/// @param projection picks the user out of each value.
+		template<typename range_type, typename projection_type> inline static void insertUsers(range_type&& values, projection_type&& projection) {
+			if (doWeCacheUsersBool) {
+				cache.emplaceRange(values, std::forward<projection_type>(projection));
+			}
+		}
+
 		template<typename user_type> inline static void insertUser(user_type&& user) {
 			if (doWeCacheUsersBool) {
 				if (user.id == 0) {
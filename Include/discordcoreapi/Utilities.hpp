@@ -90,6 +90,7 @@ namespace discord_core_api {
 		class you_tube_request_builder;
 		class websocket_client;
 		class base_socket_agent;
+		class song_stream_sink;
 		class sound_cloud_api;
 		class you_tube_api;
 
@@ -211,6 +212,13 @@ namespace discord_core_api {
 		uint32_t startingShard{};///< The first shard to start on this process.
 	};
 
+	/// @brief Options for splitting the shards between several processes on the same host, which meet at a local coordinator.
+	struct cluster_options {
+		jsonifier::string socketPath{};///< The unix domain socket that the processes meet at - empty to run without a cluster.
+		uint32_t processCount{ 1 };///< The number of processes to split the shards between.
+		bool hostCoordinator{};///< Whether this process runs the coordinator - exactly one of the processes should.
+	};
+
 	/// @brief Loggin options for the library.
 	struct logging_options {
 		std::ostream* outputStream{ &std::cout };
@@ -233,6 +241,23 @@ namespace discord_core_api {
 		bool cacheUsers{ true };///< Do we cache users?
 	};
 
+	/// @brief Options for receiving interactions over http, at the application's interactions endpoint url, instead of over the gateway.
+	struct interaction_endpoint_options {
+		jsonifier::string bindAddress{ "0.0.0.0" };///< The address to listen on - tls is expected to be terminated in front of it.
+		jsonifier::string publicKey{};///< The application's public key, in hex, for verifying the requests' signatures.
+		uint32_t workerThreads{};///< Threads that requests are handled on - 0 for one per hardware thread.
+		bool disableGateway{};///< Only receive interactions over http, without connecting to the gateway.
+		uint16_t port{};///< The port to listen on - 0 leaves the endpoint disabled.
+	};
+
+	/// @brief Options for pinning the library's threads to cpus - discord_core_client::getCpuTopology() lists the host's cpus, with their numa nodes.
+	struct thread_placement_options {
+		jsonifier::vector<uint32_t> shardCores{};///< Cpus for the websocket agents, one agent on each, with its share of the gateway event lanes beside it.
+		jsonifier::vector<uint32_t> httpsCores{};///< Cpus for the rest threads - the interaction response lane's, and the http/2 connections'.
+		jsonifier::vector<uint32_t> voiceCores{};///< Cpus for the voice connections' threads.
+		bool autoPlaceShards{};///< With no shardCores, pin the agents to the cpus outside of httpsCores and voiceCores, spread across the numa nodes.
+	};
+
 	/// @brief Configuration data for the library's main class, discord_core_client.
 	struct discord_core_client_config {
 		update_presence_data presenceData{ presence_update_state::online };///< Presence data to initialize your bot with.
@@ -240,10 +265,16 @@ namespace discord_core_api {
 		gateway_intents intents{ gateway_intents::All_Intents };///< The gateway intents to be used for this instance.
 		text_format textFormat{ text_format::etf };///< Use etf or json format for websocket transfer?
 		jsonifier::string connectionAddress{};///< A potentially alternative connection address for the websocket.
+		jsonifier::string sessionStateFile{};///< A file to save each shard's session to on SIGINT/SIGTERM, for the next process to resume - empty to disable.
+		interaction_endpoint_options interactionEndpoint{};///< Options for receiving interactions over http.
+		thread_placement_options threadPlacement{};///< Options for pinning the library's threads to cpus.
 		sharding_options shardOptions{};///< Options for the sharding of your bot.
+		cluster_options clusterOptions{};///< Options for splitting the shards between processes, which override shardOptions.
 		jsonifier::string botToken{};///< Your bot's token.
 		logging_options logOptions{};///< Options for the output/logging of the library.
 		cache_options cacheOptions{};///< Options for the cache of the library.
+		uint32_t gatewayEventLanes{};///< Threads that gateway events are processed on, ordered per guild - 0 for one per hardware thread.
+		uint32_t http2Connections{};///< Http/2 connections that rest requests share, many at once on each - 0 for http/1.1, one connection per route.
 		uint16_t connectionPort{};///< A potentially alternative connection port for the websocket.
 	};
 
@@ -296,6 +327,26 @@ namespace discord_core_api {
 
 		uint64_t getShardCountForThisProcess() const;
 
+		uint64_t getGatewayEventLaneCount() const;
+
+		uint64_t getHttp2ConnectionCount() const;
+
+		jsonifier::string getSessionStateFile() const;
+
+		const cluster_options& getClusterOptions() const;
+
+		const thread_placement_options& getThreadPlacementOptions() const;
+
+		jsonifier::vector<uint32_t> getShardCores() const;
+
+		void setShardingOptions(const sharding_options& shardOptionsNew);
+
+		const interaction_endpoint_options& getInteractionEndpointOptions() const;
+
+		uint64_t getInteractionEndpointThreadCount() const;
+
+		bool doWeConnectToTheGateway() const;
+
 		jsonifier::string getConnectionAddress() const;
 
 		void setConnectionAddress(jsonifier::string_view connectionAddressNew);
@@ -398,9 +449,20 @@ namespace discord_core_api {
 		void clearData();
 	};
 
+	/// @brief Settings for the opus encoder of a voice connection.
+	struct audio_encoder_settings {
+		int32_t bitrate{};///< The target bitrate, in bits per second - 0 selects the voice channel's bitrate.
+		int32_t complexity{ 10 };///< The encoder's computational complexity, from 0 to 10.
+		int32_t packetLossPercent{};///< The expected packet loss percentage, used to tune forward error correction.
+		bool forwardErrorCorrection{};///< Whether or not to enable in-band forward error correction.
+		bool discontinuousTransmission{};///< Whether or not to stop sending packets during silence.
+		bool voiceSignal{};///< Whether or not to tune the encoder for voice rather than music.
+	};
+
 	/// for connecting to a voice-channel. "streamInfo" is used when a SOCKET is created to connect this bot to another bot, for transmitting audio back and forth.
 	/// @brief For connecting to a voice-channel. "streamInfo" is used when a SOCKET is created to connect this bot to another bot, for transmitting audio back and forth.
 	struct voice_connect_init_data {
+		audio_encoder_settings encoderSettings{};///< The settings for the connection's opus encoder.
 		stream_info streamInfo{};///< The info for the stream-SOCKET, if applicable.
 		int32_t currentShard{};///< The current websocket shard, if applicable.
 		snowflake channelId{};///< The channel id to connect to.
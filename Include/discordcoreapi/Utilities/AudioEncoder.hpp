@@ -62,21 +62,27 @@ namespace discord_core_api {
 			};
 
 			/// @brief Constructor for opus_encoder_wrapper. initializes and configures the opus encoder.
-			inline opus_encoder_wrapper() {
+			/// @param settings the settings to configure the encoder with.
+			inline opus_encoder_wrapper(const audio_encoder_settings& settings = audio_encoder_settings{}) {
 				int32_t error{};
 				ptr.reset(opus_encoder_create(sampleRate, nChannels, OPUS_APPLICATION_AUDIO, &error));
-
-				// set opus signal type to music
-				auto result = opus_encoder_ctl(ptr.get(), OPUS_SET_SIGNAL(OPUS_SIGNAL_MUSIC));
-				if (result != OPUS_OK) {
-					throw dca_exception{ "Failed to set the opus signal type, reason: " + jsonifier::string{ opus_strerror(result) } };
+				if (error != OPUS_OK) {
+					throw dca_exception{ "Failed to create the opus encoder, reason: " + jsonifier::string{ opus_strerror(error) } };
 				}
+				configure(settings);
+			}
 
-				// set opus bitrate to maximum
-				result = opus_encoder_ctl(ptr.get(), OPUS_SET_BITRATE(OPUS_BITRATE_MAX));
-				if (result != OPUS_OK) {
-					throw dca_exception{ "Failed to set the opus bitrate, reason: " + jsonifier::string{ opus_strerror(result) } };
-				}
+			/// @brief Reconfigures the encoder, resetting its internal state so that it can be reused for a new stream.
+			/// @param settings the settings to configure the encoder with.
+			/// @throws dca_exception if any of the settings fail to apply.
+			inline void configure(const audio_encoder_settings& settings) {
+				checkResult(opus_encoder_ctl(ptr.get(), OPUS_RESET_STATE), "reset the encoder state");
+				checkResult(opus_encoder_ctl(ptr.get(), OPUS_SET_SIGNAL(settings.voiceSignal ? OPUS_SIGNAL_VOICE : OPUS_SIGNAL_MUSIC)), "set the opus signal type");
+				checkResult(opus_encoder_ctl(ptr.get(), OPUS_SET_BITRATE(settings.bitrate > 0 ? settings.bitrate : OPUS_BITRATE_MAX)), "set the opus bitrate");
+				checkResult(opus_encoder_ctl(ptr.get(), OPUS_SET_COMPLEXITY(std::clamp(settings.complexity, 0, 10))), "set the opus complexity");
+				checkResult(opus_encoder_ctl(ptr.get(), OPUS_SET_INBAND_FEC(settings.forwardErrorCorrection ? 1 : 0)), "set the opus fec");
+				checkResult(opus_encoder_ctl(ptr.get(), OPUS_SET_PACKET_LOSS_PERC(std::clamp(settings.packetLossPercent, 0, 100))), "set the opus packet loss percentage");
+				checkResult(opus_encoder_ctl(ptr.get(), OPUS_SET_DTX(settings.discontinuousTransmission ? 1 : 0)), "set the opus dtx");
 			}
 
 			/// @brief Encode opus audio data.
@@ -103,7 +109,7 @@ namespace discord_core_api {
 
 				encoder_return_data returnData{};
 				returnData.sampleCount = sampleCount;
-				returnData.data		   = jsonifier::string_view_base<uint8_t>{ encodedData.data(), encodedData.size() };
+				returnData.data		   = jsonifier::string_view_base<uint8_t>{ encodedData.data(), static_cast<uint64_t>(count) };
 				return returnData;
 			}
 
@@ -114,6 +120,49 @@ namespace discord_core_api {
 			static constexpr uint64_t maxBufferSize{ 1276 };///< Maximum size of the encoded data buffer.
 			static constexpr int64_t sampleRate{ 48000 };///< Sample rate of the audio data.
 			static constexpr int64_t nChannels{ 2 };///< Number of audio channels.
+
+			inline static void checkResult(int32_t result, jsonifier::string_view action) {
+				if (result != OPUS_OK) {
+					throw dca_exception{ "Failed to " + jsonifier::string{ action } + ", reason: " + jsonifier::string{ opus_strerror(result) } };
+				}
+			}
+		};
+
+		/// @brief A pool of opus encoders shared between voice connections, so that encoders are created once and reconfigured on reuse.
+		class opus_encoder_pool {
+		  public:
+			/// @brief Collects an encoder from the pool, creating a new one if none are free.
+			/// @param settings the settings to configure the encoder with.
+			/// @return unique_ptr<opus_encoder_wrapper> the configured encoder.
+			inline static unique_ptr<opus_encoder_wrapper> acquire(const audio_encoder_settings& settings) {
+				unique_ptr<opus_encoder_wrapper> returnValue{};
+				{
+					std::unique_lock lock{ accessMutex };
+					if (encoders.size() > 0) {
+						returnValue = std::move(encoders.back());
+						encoders.pop_back();
+					}
+				}
+				if (returnValue) {
+					returnValue->configure(settings);
+				} else {
+					returnValue = makeUnique<opus_encoder_wrapper>(settings);
+				}
+				return returnValue;
+			}
+
+			/// @brief Returns an encoder to the pool.
+			/// @param encoder the encoder to return.
+			inline static void release(unique_ptr<opus_encoder_wrapper>&& encoder) {
+				if (encoder) {
+					std::unique_lock lock{ accessMutex };
+					encoders.emplace_back(std::move(encoder));
+				}
+			}
+
+		  protected:
+			inline static std::vector<unique_ptr<opus_encoder_wrapper>> encoders{};
+			inline static std::mutex accessMutex{};
 		};
 
 		/**@}*/
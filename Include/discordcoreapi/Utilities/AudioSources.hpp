@@ -0,0 +1,252 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// AudioSources.hpp - Header file for the local file and in-memory audio sources.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file AudioSources.hpp
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/Utilities.hpp>
+#include <memory>
+#include <list>
+
+#if defined _WIN32
+	#include <Windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#include <fcntl.h>
+#endif
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// @brief A read-only memory mapping of a file.
+		class memory_mapped_file {
+		  public:
+			inline memory_mapped_file() = default;
+
+			inline memory_mapped_file& operator=(const memory_mapped_file&) = delete;
+			inline memory_mapped_file(const memory_mapped_file&)			= delete;
+
+			/// @brief Maps the file at the given path.
+			/// @param filePath the path of the file to map.
+			inline memory_mapped_file(const jsonifier::string& filePath) {
+#if defined _WIN32
+				fileHandle = CreateFileA(filePath.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				if (fileHandle == INVALID_HANDLE_VALUE) {
+					return;
+				}
+				LARGE_INTEGER fileSize{};
+				if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+					return;
+				}
+				mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (!mappingHandle) {
+					return;
+				}
+				if (auto newData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0); newData) {
+					data = static_cast<uint8_t*>(newData);
+					size = static_cast<uint64_t>(fileSize.QuadPart);
+				}
+#else
+				fileDescriptor = ::open(filePath.data(), O_RDONLY);
+				if (fileDescriptor < 0) {
+					return;
+				}
+				struct stat fileStats {};
+				if (fstat(fileDescriptor, &fileStats) != 0 || fileStats.st_size <= 0) {
+					return;
+				}
+				if (auto newData = mmap(nullptr, static_cast<size_t>(fileStats.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0); newData != MAP_FAILED) {
+					data = static_cast<uint8_t*>(newData);
+					size = static_cast<uint64_t>(fileStats.st_size);
+					// The demuxers walk the file front to back exactly once.
+					madvise(newData, static_cast<size_t>(fileStats.st_size), MADV_SEQUENTIAL);
+				}
+#endif
+			}
+
+			/// @return true if the file was mapped successfully.
+			inline bool isItMapped() const {
+				return data != nullptr;
+			}
+
+			/// @return a view of the whole file.
+			inline jsonifier::string_view_base<uint8_t> getView() const {
+				return { data, size };
+			}
+
+			inline ~memory_mapped_file() {
+#if defined _WIN32
+				if (data) {
+					UnmapViewOfFile(data);
+				}
+				if (mappingHandle) {
+					CloseHandle(mappingHandle);
+				}
+				if (fileHandle != INVALID_HANDLE_VALUE) {
+					CloseHandle(fileHandle);
+				}
+#else
+				if (data) {
+					munmap(data, static_cast<size_t>(size));
+				}
+				if (fileDescriptor >= 0) {
+					::close(fileDescriptor);
+				}
+#endif
+			}
+
+		  protected:
+#if defined _WIN32
+			HANDLE fileHandle{ INVALID_HANDLE_VALUE };
+			HANDLE mappingHandle{};
+#else
+			int32_t fileDescriptor{ -1 };
+#endif
+			uint8_t* data{};
+			uint64_t size{};
+		};
+
+		/// @brief The demuxed, still-encoded frames of a whole track.
+		struct cached_track {
+			jsonifier::vector<audio_frame_data> frames{};
+			uint64_t byteSize{};
+		};
+
+		/// @brief A process-wide lru cache of encoded tracks, keyed by song type and id, so that replaying a track skips the download.
+		class encoded_track_cache {
+		  public:
+			/// @brief Collects a cached track, marking it as the most recently used.
+			/// @param songType the platform the song came from.
+			/// @param songId the id of the song.
+			/// @return the cached track, or nullptr if it isn't cached.
+			inline static std::shared_ptr<const cached_track> getTrack(song_type songType, const jsonifier::string& songId) {
+				std::unique_lock lock{ accessMutex };
+				if (auto iterator = entries.find(makeKey(songType, songId)); iterator != entries.end()) {
+					recentTracks.splice(recentTracks.begin(), recentTracks, iterator->second);
+					return iterator->second->second;
+				}
+				return nullptr;
+			}
+
+			/// @brief Inserts a track, evicting the least recently used ones until it fits.
+			/// @param songType the platform the song came from.
+			/// @param songId the id of the song.
+			/// @param track the track to cache.
+			inline static void insertTrack(song_type songType, const jsonifier::string& songId, std::shared_ptr<const cached_track> track) {
+				std::unique_lock lock{ accessMutex };
+				if (songId.empty() || !track || track->byteSize > capacity) {
+					return;
+				}
+				jsonifier::string key{ makeKey(songType, songId) };
+				if (auto iterator = entries.find(key); iterator != entries.end()) {
+					usedBytes -= iterator->second->second->byteSize;
+					recentTracks.erase(iterator->second);
+					entries.erase(key);
+				}
+				usedBytes += track->byteSize;
+				recentTracks.emplace_front(key, std::move(track));
+				entries[key] = recentTracks.begin();
+				evict();
+			}
+
+			/// @brief Sets the maximum number of bytes of encoded audio to hold, evicting tracks if needed.
+			/// @param capacityNew the new capacity, in bytes.
+			inline static void setCapacity(uint64_t capacityNew) {
+				std::unique_lock lock{ accessMutex };
+				capacity = capacityNew;
+				evict();
+			}
+
+			/// @return the maximum number of bytes of encoded audio to hold.
+			inline static uint64_t getCapacity() {
+				std::unique_lock lock{ accessMutex };
+				return capacity;
+			}
+
+		  protected:
+			using track_list = std::list<std::pair<jsonifier::string, std::shared_ptr<const cached_track>>>;
+
+			inline static unordered_map<jsonifier::string, track_list::iterator> entries{};
+			inline static uint64_t capacity{ 256ULL * 1024ULL * 1024ULL };
+			inline static track_list recentTracks{};
+			inline static std::mutex accessMutex{};
+			inline static uint64_t usedBytes{};
+
+			/// Ids are only unique per platform, so the type is part of the key.
+			inline static jsonifier::string makeKey(song_type songType, const jsonifier::string& songId) {
+				return jsonifier::toString(static_cast<uint64_t>(songType)) + ":" + songId;
+			}
+
+			inline static void evict() {
+				while (usedBytes > capacity && recentTracks.size() > 0) {
+					usedBytes -= recentTracks.back().second->byteSize;
+					entries.erase(recentTracks.back().first);
+					recentTracks.pop_back();
+				}
+			}
+		};
+
+		/// @brief Copies the frames of a track as it streams, and caches them once the whole track has been seen.
+		class encoded_track_recorder {
+		  public:
+			inline encoded_track_recorder() : track{ std::make_shared<cached_track>() }, capacity{ encoded_track_cache::getCapacity() } {};
+
+			/// @brief Records a frame, giving up on the track once it could no longer fit in the cache.
+			/// @param frame the frame to record.
+			inline void recordFrame(const audio_frame_data& frame) {
+				if (!track || frame.currentSize <= 0) {
+					return;
+				}
+				track->byteSize += static_cast<uint64_t>(frame.currentSize);
+				if (track->byteSize > capacity) {
+					track.reset();
+					return;
+				}
+				track->frames.emplace_back(frame);
+			}
+
+			/// @brief Caches the recorded track.
+			/// @param songType the platform the song came from.
+			/// @param songId the id of the song.
+			inline void commit(song_type songType, const jsonifier::string& songId) {
+				if (track && track->frames.size() > 0) {
+					encoded_track_cache::insertTrack(songType, songId, std::move(track));
+				}
+				track.reset();
+			}
+
+		  protected:
+			std::shared_ptr<cached_track> track{};
+			uint64_t capacity{};
+		};
+	}
+}
@@ -0,0 +1,216 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ClusterCoordinator.hpp - Header file for the multi-process shard cluster.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file ClusterCoordinator.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/TCPConnection.hpp>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		/// @brief The slice of the cluster's shards that's been handed to one of its processes.
+		struct cluster_assignment {
+			jsonifier::string gatewayUrl{};
+			uint64_t maxConcurrency{};
+			uint64_t startingShard{};
+			uint64_t totalShards{};
+			uint64_t shardCount{};
+		};
+
+		/// @brief The cluster's coordinator, run by one of its processes. It listens on a unix domain socket, and each process that connects to it is handed
+		/// the first free slice of the shards - a slice is freed when its process disconnects, so a restarted process picks its shards back up. Identifies
+		/// are released one per concurrency bucket every five seconds across the whole cluster, and queries are routed to the process that owns a guild's
+		/// shard. Everything runs on a single thread, polling the listener and every connection.
+		///
+		/// The protocol is line based, each line being a command, a request id, and the command's arguments, separated by spaces:
+		///	hello <id>								-> assign <id> <starting shard> <shard count> <total shards> <max concurrency> <gateway url>
+		///	identify <id> <shard>					-> identify <id> <1 if the shard may identify now, otherwise 0>
+		///	query <id> <guild> <name> <argument>	-> result <id> <the owning process's answer, empty if there's none>
+		class DiscordCoreAPI_Dll cluster_coordinator {
+		  public:
+			static constexpr milliseconds identifyInterval{ 5000 };
+			static constexpr uint64_t maxLineSize{ 1024 * 1024 };
+
+			/// @brief Starts listening.
+			/// @param socketPathNew the path of the unix domain socket - any stale socket file at the path is replaced.
+			/// @param processCountNew the number of processes to split the shards between.
+			/// @param totalShardsNew the number of shards across the whole cluster.
+			/// @param maxConcurrencyNew the session start limit's max_concurrency.
+			/// @param gatewayUrlNew the gateway url, for the processes to connect to.
+			cluster_coordinator(jsonifier::string_view socketPathNew, uint64_t processCountNew, uint64_t totalShardsNew, uint64_t maxConcurrencyNew,
+				jsonifier::string_view gatewayUrlNew);
+
+			cluster_coordinator& operator=(const cluster_coordinator&) = delete;
+			cluster_coordinator(const cluster_coordinator&)			   = delete;
+
+			/// @return true if the coordinator is listening.
+			bool isListening();
+
+			~cluster_coordinator();
+
+		  protected:
+			struct process_connection {
+				jsonifier::string inputBuffer{};
+				socket_wrapper socket{};
+				uint64_t slot{ std::numeric_limits<uint64_t>::max() };
+			};
+
+			/// @brief A query that's been forwarded to the owning process, and the request that it's answering.
+			struct routed_query {
+				uint64_t connectionId{};
+				uint64_t requestId{};
+				uint64_t ownerId{};
+			};
+
+			unordered_map<uint64_t, process_connection> connections{};
+			std::vector<hrclock::time_point> nextIdentifyTimes{};
+			unordered_map<uint64_t, routed_query> routedQueries{};
+			std::vector<uint64_t> slotOwners{};
+			jsonifier::string socketPath{};
+			jsonifier::string gatewayUrl{};
+			uint64_t nextConnectionId{ 1 };
+			socket_wrapper listener{};
+			uint64_t maxConcurrency{};
+			uint64_t nextQueryId{ 1 };
+			uint64_t totalShards{};
+			std::jthread worker{};
+
+			bool startListening();
+
+			void run(std::stop_token token);
+
+			bool readConnection(uint64_t connectionId);
+
+			void handleLine(uint64_t connectionId, jsonifier::string_view line);
+
+			void sendLine(uint64_t connectionId, jsonifier::string_view line);
+
+			void dropConnection(uint64_t connectionId);
+
+			uint64_t getSlotStart(uint64_t slot);
+		};
+
+		/// @brief A process's connection to the cluster's coordinator. Queries from other processes are answered on a thread of their own, so that a
+		/// handler that's slow, or that queries the cluster itself, doesn't hold up the connection.
+		class DiscordCoreAPI_Dll cluster_client {
+		  public:
+			using query_handler = std::function<jsonifier::string(snowflake, jsonifier::string_view)>;
+
+			static constexpr milliseconds requestTimeout{ 5000 };
+
+			/// @brief Registers the built-in "guild" and "guild_member" queries - connecting is left to connect().
+			/// @param socketPathNew the path of the coordinator's unix domain socket.
+			cluster_client(jsonifier::string_view socketPathNew);
+
+			cluster_client& operator=(const cluster_client&) = delete;
+			cluster_client(const cluster_client&)			 = delete;
+
+			/// @brief Connects to the coordinator, retrying until it's up.
+			/// @param timeout the longest to keep retrying for.
+			/// @return true if the connection was made.
+			bool connect(milliseconds timeout);
+
+			/// @brief Collects this process's slice of the shards.
+			/// @param assignment set to the slice.
+			/// @return false if the coordinator didn't answer, or had no slice left to hand out.
+			bool requestAssignment(cluster_assignment& assignment);
+
+			/// @brief Asks whether a shard may identify now, across the whole cluster - claiming its bucket if so. This never waits on the coordinator: the
+			/// first call sends the request and returns false, and a later call collects the answer once it's arrived. A request that goes unanswered for
+			/// requestTimeout is sent again, and once the coordinator is lost every shard may identify - the local buckets still pace this process.
+			/// @param shardId the shard.
+			/// @return true if the shard may identify.
+			bool tryAcquireIdentify(uint64_t shardId);
+
+			/// @brief Runs a query on the process that owns a guild's shard - or right here, if that's this process.
+			/// @param name the name of the query's handler.
+			/// @param guildId the guild, which picks the process.
+			/// @param argument the query's argument, without any line breaks.
+			/// @return jsonifier::string the handler's answer, or an empty string if there wasn't one.
+			jsonifier::string query(jsonifier::string_view name, snowflake guildId, jsonifier::string_view argument);
+
+			/// @brief Registers a handler for queries from the other processes.
+			/// @param name the query's name, without any spaces.
+			/// @param handler called with the guild and the argument, returns the answer - which mustn't contain any line breaks.
+			void registerQueryHandler(jsonifier::string_view name, query_handler handler);
+
+			~cluster_client();
+
+		  protected:
+			struct pending_request {
+				jsonifier::string response{};
+				bool completed{};
+			};
+
+			/// @brief An identify request that's been sent for a shard, and is waiting for its answer.
+			struct identify_request {
+				hrclock::time_point sentAt{};
+				uint64_t requestId{};
+			};
+
+			unordered_map<jsonifier::string, query_handler> queryHandlers{};
+			unordered_map<uint64_t, identify_request> identifyRequests{};
+			unordered_map<uint64_t, pending_request> pendingRequests{};
+			std::condition_variable_any queryCondition{};
+			std::condition_variable responseCondition{};
+			std::deque<jsonifier::string> queries{};
+			cluster_assignment assignment{};
+			std::atomic<uint64_t> nextRequestId{ 1 };
+			jsonifier::string socketPath{};
+			std::jthread queryHandlerThread{};
+			std::mutex handlersMutex{};
+			std::mutex accessMutex{};
+			std::atomic_bool areWeConnected{};
+			std::mutex sendMutex{};
+			socket_wrapper socket{};
+			std::jthread readerThread{};
+
+			jsonifier::string sendRequest(jsonifier::string_view command, jsonifier::string_view arguments);
+
+			bool sendLine(jsonifier::string_view line);
+
+			void runReader(std::stop_token token);
+
+			void runQueryHandlers(std::stop_token token);
+
+			jsonifier::string runQuery(jsonifier::string_view name, snowflake guildId, jsonifier::string_view argument);
+		};
+
+		/**@}*/
+	}
+}
@@ -0,0 +1,269 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// CoRoutineFramePool.hpp - Header file for the co_routine frame allocator.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file CoRoutineFramePool.hpp
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <mutex>
+#include <vector>
+#include <bit>
+#include <new>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		/// @brief A snapshot of the co_routine frame allocator's counters, summed over every thread.
+		struct co_routine_frame_stats {
+			uint64_t remoteDeallocations{};///< Frames freed on a thread other than the one that allocated them.
+			uint64_t systemAllocations{};///< Frames that had to come from the global operator new.
+			uint64_t poolAllocations{};///< Frames reused from a free list.
+			uint64_t deallocations{};///< Frames freed in total.
+		};
+
+		/// @brief Allocates co_routine frames from per-thread free lists, split into power-of-two size classes. A frame freed on another thread is pushed
+		/// onto its owning thread's lock-free return list, which the owner drains the next time its own list runs dry.
+		class co_routine_frame_pool {
+		  public:
+			static constexpr uint64_t headerSize{ __STDCPP_DEFAULT_NEW_ALIGNMENT__ };
+			static constexpr uint64_t minimumClassSize{ 64 };
+			static constexpr uint64_t maxCachedPerClass{ 256 };
+			static constexpr uint64_t sizeClassCount{ 8 };
+			static constexpr uint64_t maximumClassSize{ minimumClassSize << (sizeClassCount - 1) };
+
+			/// @brief Allocates a frame - frames too large for the biggest class go straight to the global operator new.
+			/// @param size the size of the frame.
+			/// @return void* the frame's storage.
+			inline static void* allocate(uint64_t size) {
+				frame_cache* cache{ getCache() };
+				if (size + headerSize > maximumClassSize) {
+					countSystemAllocation(cache);
+					return ::operator new(size);
+				}
+				uint64_t index{ getClassIndex(size) };
+				frame_block* block{};
+				if (cache) {
+					block = cache->pop(index);
+				}
+				void* rawData{};
+				if (block) {
+					increment(cache->poolAllocations);
+					rawData = static_cast<void*>(block);
+				} else {
+					countSystemAllocation(cache);
+					rawData = ::operator new(minimumClassSize << index);
+				}
+				new (rawData) frame_header{ cache };
+				return static_cast<void*>(static_cast<uint8_t*>(rawData) + headerSize);
+			}
+
+			/// @brief Returns a frame to the free list of the thread that allocated it.
+			/// @param ptr the frame's storage.
+			/// @param size the size of the frame, as passed to allocate().
+			inline static void deallocate(void* ptr, uint64_t size) noexcept {
+				frame_cache* cache{ getCache() };
+				if (cache) {
+					increment(cache->deallocations);
+				}
+				if (size + headerSize > maximumClassSize) {
+					::operator delete(ptr);
+					return;
+				}
+				uint64_t index{ getClassIndex(size) };
+				void* rawData{ static_cast<uint8_t*>(ptr) - headerSize };
+				frame_cache* owner{ static_cast<frame_header*>(rawData)->owner };
+				if (!owner) {
+					::operator delete(rawData);
+				} else if (owner == cache) {
+					cache->push(index, rawData);
+				} else {
+					if (cache) {
+						increment(cache->remoteDeallocations);
+					}
+					owner->pushRemote(index, rawData);
+				}
+			}
+
+			/// @brief Collects the allocator's counters.
+			/// @return co_routine_frame_stats the counters, summed over every thread that has allocated a frame.
+			inline static co_routine_frame_stats getStats() {
+				co_routine_frame_stats returnData{};
+				std::unique_lock lock{ cachesMutex };
+				for (auto& value: caches) {
+					returnData.remoteDeallocations += value->remoteDeallocations.load(std::memory_order_relaxed);
+					returnData.systemAllocations += value->systemAllocations.load(std::memory_order_relaxed);
+					returnData.poolAllocations += value->poolAllocations.load(std::memory_order_relaxed);
+					returnData.deallocations += value->deallocations.load(std::memory_order_relaxed);
+				}
+				return returnData;
+			}
+
+		  protected:
+			struct frame_block {
+				frame_block* next{};
+			};
+
+			class frame_cache;
+
+			struct frame_header {
+				frame_cache* owner{};
+			};
+
+			static_assert(sizeof(frame_header) <= headerSize && sizeof(frame_block) <= minimumClassSize);
+
+			/// @brief One thread's free lists. A cache outlives its thread, since frames it handed out may still be returned to it - once orphaned, its
+			/// return lists are sealed, and late returns go to the global operator delete instead.
+			class frame_cache {
+			  public:
+				std::array<std::atomic<frame_block*>, sizeClassCount> remoteFrees{};
+				std::array<frame_block*, sizeClassCount> localFrees{};
+				std::array<uint64_t, sizeClassCount> localCounts{};
+				std::atomic<uint64_t> remoteDeallocations{};
+				std::atomic<uint64_t> systemAllocations{};
+				std::atomic<uint64_t> poolAllocations{};
+				std::atomic<uint64_t> deallocations{};
+
+				inline frame_block* pop(uint64_t index) {
+					if (!localFrees[index]) {
+						frame_block* remoteBlocks{ remoteFrees[index].exchange(nullptr, std::memory_order_acquire) };
+						while (remoteBlocks) {
+							frame_block* next{ remoteBlocks->next };
+							push(index, remoteBlocks);
+							remoteBlocks = next;
+						}
+					}
+					frame_block* block{ localFrees[index] };
+					if (block) {
+						localFrees[index] = block->next;
+						--localCounts[index];
+					}
+					return block;
+				}
+
+				inline void push(uint64_t index, void* rawData) {
+					if (localCounts[index] >= maxCachedPerClass) {
+						::operator delete(rawData);
+						return;
+					}
+					frame_block* block{ new (rawData) frame_block{ localFrees[index] } };
+					localFrees[index] = block;
+					++localCounts[index];
+				}
+
+				inline void pushRemote(uint64_t index, void* rawData) {
+					frame_block* block{ new (rawData) frame_block{} };
+					frame_block* head{ remoteFrees[index].load(std::memory_order_relaxed) };
+					do {
+						if (head == getOrphanedTag()) {
+							::operator delete(rawData);
+							return;
+						}
+						block->next = head;
+					} while (!remoteFrees[index].compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+				}
+
+				/// Frees everything the cache holds and seals its return lists, as its thread exits.
+				inline void orphan() {
+					for (uint64_t x = 0; x < sizeClassCount; ++x) {
+						frame_block* remoteBlocks{ remoteFrees[x].exchange(getOrphanedTag(), std::memory_order_acquire) };
+						freeBlocks(remoteBlocks);
+						freeBlocks(localFrees[x]);
+						localFrees[x]  = nullptr;
+						localCounts[x] = 0;
+					}
+				}
+
+			  protected:
+				inline static void freeBlocks(frame_block* block) {
+					while (block) {
+						frame_block* next{ block->next };
+						::operator delete(static_cast<void*>(block));
+						block = next;
+					}
+				}
+			};
+
+			/// @brief Creates the thread's cache on first use, and orphans it once the thread exits.
+			struct frame_cache_holder {
+				inline frame_cache_holder() {
+					currentCache = new frame_cache{};
+					std::unique_lock lock{ cachesMutex };
+					caches.emplace_back(currentCache);
+				}
+
+				inline ~frame_cache_holder() {
+					currentCache->orphan();
+					currentCache = nullptr;
+					threadExiting = true;
+				}
+			};
+
+			inline static thread_local frame_cache* currentCache{};
+			inline static std::vector<frame_cache*> caches{};
+			inline static thread_local bool threadExiting{};
+			inline static std::mutex cachesMutex{};
+
+			/// @return frame_cache* the calling thread's cache, or nullptr while the thread is exiting.
+			inline static frame_cache* getCache() {
+				if (!currentCache && !threadExiting) {
+					thread_local frame_cache_holder holder{};
+				}
+				return currentCache;
+			}
+
+			inline static frame_block* getOrphanedTag() {
+				static frame_block orphanedTag{};
+				return &orphanedTag;
+			}
+
+			inline static uint64_t getClassIndex(uint64_t size) {
+				return static_cast<uint64_t>(std::bit_width((size + headerSize - 1) / minimumClassSize));
+			}
+
+			/// Each counter is only ever written by its own cache's thread, so a plain load and store stands in for a locked read-modify-write.
+			inline static void increment(std::atomic<uint64_t>& counter) {
+				counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			}
+
+			inline static void countSystemAllocation(frame_cache* cache) {
+				if (cache) {
+					increment(cache->systemAllocations);
+				}
+			}
+		};
+
+		/**@}*/
+	}
+}
@@ -78,8 +78,9 @@ namespace discord_core_api {
 					currentCount.fetch_add(1, std::memory_order_release);
 					uint64_t indexNew = currentIndex.load(std::memory_order_acquire);
 					getMap().emplace(indexNew, makeUnique<worker_thread>());
-					getMap()[indexNew]->thread = std::jthread([=, this](std::stop_token tokenNew) mutable {
-						threadFunction(getMap().at(indexNew).get(), tokenNew);
+					worker_thread* workerPtr{ getMap()[indexNew].get() };
+					workerPtr->thread = std::jthread([=, this](std::stop_token tokenNew) mutable {
+						threadFunction(indexNew, workerPtr, tokenNew);
 					});
 				}
 			}
@@ -89,31 +90,36 @@ namespace discord_core_api {
 			inline void submitTask(std::coroutine_handle<> coro) {
 				bool areWeAllBusy{ true };
 				uint64_t currentLowestValue{ std::numeric_limits<uint64_t>::max() };
-				uint64_t currentLowestIndex{ std::numeric_limits<uint64_t>::max() };
+				worker_thread* currentLowestWorker{};
 				std::shared_lock lock01{ workerAccessMutex };
 				for (auto& [key, value]: getMap()) {
 					if (!value->areWeCurrentlyWorking.load(std::memory_order_acquire)) {
 						areWeAllBusy = false;
 						if (value->tasks.size() < currentLowestValue) {
 							currentLowestValue = value->tasks.size();
-							currentLowestIndex = key;
+							currentLowestWorker = value.get();
 						}
 						break;
 					}
 				}
 				if (areWeAllBusy) {
-					currentIndex.fetch_add(1, std::memory_order_release);
+					// The index is taken from the increment itself - two submitters loading it afterwards could share one, and the second would then
+					// replace, and join, the first one's running thread.
+					uint64_t indexNew{ currentIndex.fetch_add(1, std::memory_order_acq_rel) + 1 };
 					currentCount.fetch_add(1, std::memory_order_release);
-					uint64_t indexNew = currentIndex.load(std::memory_order_acquire);
 					lock01.unlock();
 					std::unique_lock lock02{ workerAccessMutex };
-					getMap().emplace(indexNew, makeUnique<worker_thread>());
-					getMap()[indexNew]->thread = std::jthread([=, this](std::stop_token tokenNew) mutable {
-						threadFunction(getMap().at(indexNew).get(), tokenNew);
+					// The worker is handed its own pointer, since the map may rehash under it as other workers come and go.
+					worker_thread* workerPtr{ getMap().emplace(indexNew, makeUnique<worker_thread>())->second.get() };
+					workerPtr->tasks.send(std::move(coro));
+					workerPtr->thread = std::jthread([=, this](std::stop_token tokenNew) mutable {
+						threadFunction(indexNew, workerPtr, tokenNew);
 					});
 					lock02.unlock();
 				} else {
-					getMap()[currentLowestIndex]->tasks.send(std::move(coro));
+					// The worker is sent to through the pointer found above - looking it up again with operator[], under only the shared lock, could insert
+					// an empty worker into a slot that a retired one had left free.
+					currentLowestWorker->tasks.send(std::move(coro));
 				}
 			}
 
@@ -129,47 +135,43 @@ namespace discord_core_api {
 			const uint64_t threadCount{};///< Total thread count.
 
 			/// @brief Thread function for each worker thread.
+			/// @param index The worker's key in the map.
 			/// @param thread A pointer to the current thread of execution.
 			/// @param tokenNew The stop token for the thread.
-			inline void threadFunction(worker_thread* thread, std::stop_token tokenNew) {
+			inline void threadFunction(uint64_t index, worker_thread* thread, std::stop_token tokenNew) {
 				while (!doWeQuit.load(std::memory_order_acquire) && !tokenNew.stop_requested()) {
 					std::coroutine_handle<> coroHandle{};
 					if (thread->tasks.tryReceive(coroHandle)) {
 						thread->areWeCurrentlyWorking.store(true, std::memory_order_release);
 						try {
+							// A co_routine that suspends again (on a timer, say) gets resubmitted when it is resumed, so this thread doesn't wait on it.
 							coroHandle();
-							while (!coroHandle.done()) {
-								std::this_thread::sleep_for(1ms);
-							}
 						} catch (const std::runtime_error& error) {
 							message_printer::printError<print_message_type::general>(error.what());
 						}
 						thread->areWeCurrentlyWorking.store(false, std::memory_order_release);
-					}
-					if (currentCount.load(std::memory_order_acquire) > threadCount) {
-						uint64_t extraWorkers{ currentCount.load(std::memory_order_acquire) - threadCount };
-						while (extraWorkers > 0) {
-							--extraWorkers;
-							size_type currentHighestIndex{};
-							for (const auto& [key, value]: *this) {
-								if (key > currentHighestIndex) {
-									currentHighestIndex = key;
-								}
-							}
-							std::unique_lock lock{ workerAccessMutex };
-							auto oldThread = begin() + currentHighestIndex;
-							if (oldThread->second->thread.joinable()) {
-								oldThread->second->thread.request_stop();
-								oldThread->second->thread.detach();
-								currentCount.fetch_sub(1, std::memory_order_release);
-								getMap().erase(oldThread->first);
-							}
-						}
+					} else if (currentCount.load(std::memory_order_acquire) > threadCount && retireWorker(index, thread)) {
+						// The worker, and its jthread, are gone - so nothing of them may be touched from here on.
+						return;
 					}
 					std::this_thread::sleep_for(std::chrono::nanoseconds{ 100000 });
 				}
 			}
 
+			/// @brief Removes an idle worker that was added while the pool was busy, from its own thread - submitTask() only sends to a worker while
+			/// holding the shared lock, so once the queue is seen empty under the exclusive lock nothing more can arrive on it.
+			/// @return bool true if the worker was removed, and has to return without touching itself again.
+			inline bool retireWorker(uint64_t index, worker_thread* thread) {
+				std::unique_lock lock{ workerAccessMutex };
+				if (currentCount.load(std::memory_order_acquire) <= threadCount || thread->tasks.size() > 0) {
+					return false;
+				}
+				thread->thread.detach();
+				currentCount.fetch_sub(1, std::memory_order_release);
+				getMap().erase(index);
+				return true;
+			}
+
 			inline map_type& getMap() {
 				return *this;
 			}
@@ -0,0 +1,205 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// CollectorRegistry.hpp - Header file for the event-driven collector channels.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file CollectorRegistry.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/TimerWheel.hpp>
+#include <shared_mutex>
+#include <utility>
+#include <memory>
+#include <deque>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		template<typename value_type> class collector_receive_awaiter;
+
+		/// @brief The inbox of a single collector - the dispatch path sends into it, and the collecting co_routine awaits it, so no thread is held while the
+		/// collector waits.
+		template<typename value_type> class collector_channel : public std::enable_shared_from_this<collector_channel<value_type>> {
+		  public:
+			friend class collector_receive_awaiter<value_type>;
+
+			/// @brief Hands a value to the waiting co_routine, resuming it on the co_routine thread pool, or queues it if nothing is waiting yet.
+			/// @param value the value to send.
+			inline void send(const value_type& value) {
+				std::unique_lock lock{ accessMutex };
+				if (!waiter) {
+					pending.emplace_back(value);
+					return;
+				}
+				*target			 = value;
+				*deliveredTarget = true;
+				auto waiterNew	 = std::exchange(waiter, std::coroutine_handle<>{});
+				uint64_t timerId{ currentTimerId };
+				lock.unlock();
+				timer_wheel_base::timerWheel.cancel(timerId);
+				new_thread_awaiter_base::threadPool.submitTask(waiterNew);
+			}
+
+			/// @brief Waits for the next value - co_await channel->receive(value, timeout).
+			/// @param valueNew the value to move the received value into.
+			/// @param timeout how long to wait for a value.
+			/// @return an awaitable that produces true if a value was received, or false if the time ran out.
+			inline collector_receive_awaiter<value_type> receive(value_type& valueNew, milliseconds timeout) {
+				return collector_receive_awaiter<value_type>{ this->shared_from_this(), valueNew, timeout };
+			}
+
+		  protected:
+			std::coroutine_handle<> waiter{};
+			std::deque<value_type> pending{};
+			bool* deliveredTarget{};
+			std::mutex accessMutex{};
+			uint64_t currentTimerId{};
+			value_type* target{};
+			uint64_t generation{};
+
+			/// Resumes the waiter with nothing, unless a value or a newer wait got there first.
+			inline void expire(uint64_t generationNew) {
+				std::unique_lock lock{ accessMutex };
+				if (!waiter || generation != generationNew) {
+					return;
+				}
+				*deliveredTarget = false;
+				auto waiterNew	 = std::exchange(waiter, std::coroutine_handle<>{});
+				lock.unlock();
+				new_thread_awaiter_base::threadPool.submitTask(waiterNew);
+			}
+		};
+
+		/// @brief The awaitable returned by collector_channel::receive().
+		template<typename value_type> class collector_receive_awaiter {
+		  public:
+			inline collector_receive_awaiter(std::shared_ptr<collector_channel<value_type>> channelNew, value_type& valueNew, milliseconds timeoutNew)
+				: channel{ std::move(channelNew) }, timeout{ timeoutNew }, value{ &valueNew } {};
+
+			inline bool await_ready() const {
+				return false;
+			}
+
+			inline bool await_suspend(std::coroutine_handle<> coroHandleNew) {
+				std::unique_lock lock{ channel->accessMutex };
+				if (channel->pending.size() > 0) {
+					*value = std::move(channel->pending.front());
+					channel->pending.pop_front();
+					delivered = true;
+					return false;
+				}
+				if (timeout.count() <= 0) {
+					return false;
+				}
+				channel->waiter			 = coroHandleNew;
+				channel->deliveredTarget = &delivered;
+				channel->target			 = value;
+				uint64_t generationNew{ ++channel->generation };
+				std::weak_ptr<collector_channel<value_type>> channelNew{ channel };
+				// The channel's lock is held until the timer is recorded, so an early expiry simply waits for it.
+				channel->currentTimerId = timer_wheel_base::timerWheel.schedule(timeout, [channelNew, generationNew] {
+					if (auto channelNewer = channelNew.lock(); channelNewer) {
+						channelNewer->expire(generationNew);
+					}
+				});
+				return true;
+			}
+
+			inline bool await_resume() const {
+				return delivered;
+			}
+
+		  protected:
+			std::shared_ptr<collector_channel<value_type>> channel{};
+			milliseconds timeout{};
+			value_type* value{};
+			bool delivered{};
+		};
+
+		template<typename value_type> using collector_channel_ptr = std::shared_ptr<collector_channel<value_type>>;
+
+		/// @brief Creates a collector's channel.
+		/// @return collector_channel_ptr<value_type> the new channel.
+		template<typename value_type> inline collector_channel_ptr<value_type> makeCollectorChannel() {
+			return std::make_shared<collector_channel<value_type>>();
+		}
+
+		/// @brief Routes values from the dispatch path to the collectors registered under a key - a channel or message id - so each value is only offered
+		/// to the collectors that can want it.
+		template<typename value_type> class collector_registry {
+		  public:
+			using channel_ptr = collector_channel_ptr<value_type>;
+
+			/// @brief Registers a collector's channel under a key.
+			/// @param key the id to route on.
+			/// @param channel the channel to send matching values into.
+			inline void add(snowflake key, const channel_ptr& channel) {
+				std::unique_lock lock{ accessMutex };
+				channels[key].emplace_back(channel);
+			}
+
+			/// @brief Unregisters a collector's channel.
+			/// @param key the id it was registered under.
+			/// @param channel the channel to remove.
+			inline void remove(snowflake key, const channel_ptr& channel) {
+				std::unique_lock lock{ accessMutex };
+				if (auto iterator = channels.find(key); iterator != channels.end()) {
+					std::erase(iterator->second, channel);
+					if (iterator->second.empty()) {
+						channels.erase(key);
+					}
+				}
+			}
+
+			/// @brief Sends a value to each of the channels registered under a key.
+			/// @param key the id to route on.
+			/// @param value the value to send.
+			/// @return true if any collector was registered under the key.
+			inline bool send(snowflake key, const value_type& value) {
+				std::shared_lock lock{ accessMutex };
+				if (auto iterator = channels.find(key); iterator != channels.end()) {
+					for (auto& valueNew: iterator->second) {
+						valueNew->send(value);
+					}
+					return true;
+				}
+				return false;
+			}
+
+		  protected:
+			unordered_map<snowflake, std::vector<channel_ptr>> channels{};
+			std::shared_mutex accessMutex{};
+		};
+
+		/**@}*/
+	}
+}
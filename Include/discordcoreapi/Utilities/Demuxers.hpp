@@ -31,6 +31,9 @@
 
 #include <discordcoreapi/Utilities.hpp>
 #include <opus/opus.h>
+#include <algorithm>
+#include <optional>
+#include <array>
 #include <fstream>
 
 namespace discord_core_api {
@@ -42,9 +45,23 @@ namespace discord_core_api {
 		* @{
 		*/
 
-  		static constexpr uint32_t segmentId{ 0x18538067 };
-		static constexpr uint8_t simpleBlockId{ 0xA3 };
-		static constexpr uint8_t opusTrackId{ 0x81 };
+		static constexpr uint32_t segmentId{ 0x18538067 };
+		static constexpr uint32_t infoId{ 0x1549A966 };
+		static constexpr uint32_t timecodeScaleId{ 0x2AD7B1 };
+		static constexpr uint32_t tracksId{ 0x1654AE6B };
+		static constexpr uint32_t trackEntryId{ 0xAE };
+		static constexpr uint32_t trackNumberId{ 0xD7 };
+		static constexpr uint32_t codecId{ 0x86 };
+		static constexpr uint32_t cuesId{ 0x1C53BB6B };
+		static constexpr uint32_t cuePointId{ 0xBB };
+		static constexpr uint32_t cueTimeId{ 0xB3 };
+		static constexpr uint32_t cueTrackPositionsId{ 0xB7 };
+		static constexpr uint32_t cueClusterPositionId{ 0xF1 };
+		static constexpr uint32_t clusterId{ 0x1F43B675 };
+		static constexpr uint32_t clusterTimecodeId{ 0xE7 };
+		static constexpr uint32_t blockGroupId{ 0xA0 };
+		static constexpr uint32_t blockId{ 0xA1 };
+		static constexpr uint32_t simpleBlockId{ 0xA3 };
 
 		static constexpr uint8_t ffLog2Tab[]{ 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
 			5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
@@ -52,16 +69,38 @@ namespace discord_core_api {
 			7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
 			7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 };
 
-		/// @brief A class for demuxing Matroska-contained audio data.
+		/// @brief A single entry of a Matroska file's Cues element.
+		struct cue_point {
+			uint64_t clusterPosition{};///< The cluster's offset, relative to the start of the segment's data.
+			uint64_t time{};///< The timestamp of the cue, in timecode-scale units.
+		};
+
+		/// @brief A class for incrementally demuxing Matroska-contained audio data, as it arrives.
 		class matroska_demuxer {
 		  public:
 			/// @brief Constructor for matroska_demuxer.
 			inline matroska_demuxer() = default;
 
-			/// @brief Writes data to the Matroska demuxer.
-			/// @param dataNew The data to be written.
+			/// @brief Writes data to the Matroska demuxer - bytes that have already been demuxed are released first.
+			/// @param dataNew The data to be written, which must directly follow the previously written data.
 			inline void writeData(jsonifier::string_view_base<uint8_t> dataNew) {
-				data = dataNew;
+				releaseConsumedData();
+				if (bytesToSkip > 0) {
+					const uint64_t skippedBytes{ std::min(bytesToSkip, static_cast<uint64_t>(dataNew.size())) };
+					bytesToSkip -= skippedBytes;
+					bufferOffset += skippedBytes;
+					dataNew = jsonifier::string_view_base<uint8_t>{ dataNew.data() + skippedBytes, dataNew.size() - skippedBytes };
+				}
+				if (dataNew.size() > 0) {
+					const uint64_t oldSize{ data.size() };
+					data.resize(oldSize + dataNew.size());
+					std::memcpy(data.data() + oldSize, dataNew.data(), dataNew.size());
+				}
+			}
+
+			/// @brief Signals that no more data will be written, so that a trailing partial element ends the demuxing.
+			inline void endOfStream() {
+				endOfStreamVal = true;
 			}
 
 			/// @brief Collects the next frame from the demuxer.
@@ -69,68 +108,87 @@ namespace discord_core_api {
 			/// @return True if a frame was collected, false otherwise.
 			inline bool collectFrame(audio_frame_data& frameNew) {
 				if (frames.size() > 0) {
-					frameNew = std::move(frames.at(0));
-					frames.erase(frames.begin());
+					frameNew = std::move(frames.front());
+					frames.pop_front();
 					return true;
 				} else {
 					return false;
 				}
 			}
 
-			/// @brief Proceed with the demuxing process.
+			/// @brief Proceed with the demuxing process, parsing every complete element that has been written so far.
 			inline void proceedDemuxing() {
-				if (!doWeHaveTotalSize) {
-					if (reverseBytes<uint32_t>() != segmentId) {
-						message_printer::printError<print_message_type::general>(
-							jsonifier::string{ "Missing a Segment, which was expected at index: " + jsonifier::toString(currentPosition) + jsonifier::string{ "..." } });
-						if (!findNextId(segmentId)) {
-							if ((totalSize > 0 && static_cast<int64_t>(currentPosition) >= totalSize)) {
+				while (!areWeDoneVal) {
+					if (bytesToSkip > 0) {
+						const uint64_t skippedBytes{ std::min(bytesToSkip, static_cast<uint64_t>(data.size() - currentPosition)) };
+						currentPosition += skippedBytes;
+						bytesToSkip -= skippedBytes;
+						if (bytesToSkip > 0) {
+							// The rest of a skipped element is never going to arrive, so the stream was truncated.
+							if (endOfStreamVal) {
 								areWeDoneVal = true;
 							}
-							return;
+							break;
 						}
-						message_printer::printSuccess<print_message_type::general>(
-							jsonifier::string{ "Missing Segment, found at index: " + jsonifier::toString(currentPosition) + "." });
-					} else {
-						currentPosition += sizeof(uint32_t);
 					}
-					totalSize		  = collectElementSize();
-					doWeHaveTotalSize = true;
-				}
-				while (currentPosition + 3 < data.size() && data.find(static_cast<uint8_t>(0xa3)) != jsonifier::string::npos) {
-					if (currentPosition >= data.size() - 8) {
-						if ((totalSize > 0 && static_cast<int64_t>(currentPosition) >= totalSize)) {
-							areWeDoneVal = true;
+					if (getAbsolutePosition() >= segmentEnd) {
+						areWeDoneVal  = true;
+						reachedEndVal = true;
+						break;
+					}
+					const uint64_t elementStart{ currentPosition };
+					uint64_t elementId{};
+					uint64_t elementSize{};
+					bool isSizeUnknown{};
+					if (!readElementHeader(elementId, elementSize, isSizeUnknown)) {
+						currentPosition = elementStart;
+						if (endOfStreamVal) {
+							// A segment of unknown size ends with the stream - cleanly, so long as no partial element is left over.
+							areWeDoneVal  = true;
+							reachedEndVal = segmentEnd == std::numeric_limits<uint64_t>::max() && currentPosition == data.size();
 						}
-						return;
-					}
-					if (data.at(currentPosition) == simpleBlockId && ((data.at(currentPosition + 2) == opusTrackId || data.at(currentPosition + 3) == opusTrackId))) {
-						++currentPosition;
-						if (currentSize == 0) {
-							currentSize = static_cast<uint64_t>(collectElementSize());
-							if (static_cast<int64_t>(currentSize) >= totalSize || static_cast<int64_t>(currentSize) >= 1276 || static_cast<int64_t>(currentSize) < 4) {
-								++currentPosition;
-								currentSize = 0;
-								continue;
-							} else if (currentSize == static_cast<uint64_t>(-1) || currentPosition + currentSize >= data.size()) {
-								if ((totalSize > 0 && static_cast<int64_t>(currentPosition) >= totalSize)) {
-									areWeDoneVal = true;
-								}
-								return;
-							} else {
-								parseOpusFrame();
-							}
-						} else {
-							currentSize = 0;
+						break;
+					}
+					if (!processElement(elementId, elementSize, isSizeUnknown)) {
+						currentPosition = elementStart;
+						if (endOfStreamVal) {
+							areWeDoneVal = true;
 						}
-					} else {
-						++currentPosition;
+						break;
 					}
 				}
-				if ((totalSize > 0 && static_cast<int64_t>(currentPosition) >= totalSize)) {
-					areWeDoneVal = true;
+			}
+
+			/// @brief Prepares the demuxer to seek to a given timestamp, using the cue points collected from the Cues element.
+			/// @param timeStamp The timestamp to seek to.
+			/// @return The absolute byte offset that data must be written from, or std::nullopt if no cue points have been parsed.
+			inline std::optional<uint64_t> seek(milliseconds timeStamp) {
+				if (cuePoints.empty()) {
+					return std::nullopt;
+				}
+				const uint64_t targetTimecode{ static_cast<uint64_t>(timeStamp.count()) * 1000000ULL / timecodeScale };
+				auto cuePoint = std::upper_bound(cuePoints.begin(), cuePoints.end(), targetTimecode, [](uint64_t value, const cue_point& cue) {
+					return value < cue.time;
+				});
+				if (cuePoint != cuePoints.begin()) {
+					--cuePoint;
 				}
-				return;
+				data.clear();
+				frames.clear();
+				currentPosition	   = 0;
+				bytesToSkip		   = 0;
+				reachedEndVal	   = false;
+				areWeDoneVal	   = false;
+				endOfStreamVal	   = false;
+				seekTargetTimecode = targetTimecode;
+				bufferOffset	   = segmentDataStart + cuePoint->clusterPosition;
+				return bufferOffset;
+			}
+
+			/// @brief Collects the timestamp of the most recently demuxed frame.
+			/// @return The timestamp of the frame.
+			inline milliseconds getCurrentTimeStamp() {
+				return milliseconds{ static_cast<int64_t>(currentTimecode * timecodeScale / 1000000ULL) };
 			}
 
 			/// @brief Checks if the demuxing process is complete.
@@ -139,261 +197,526 @@ namespace discord_core_api {
 				return areWeDoneVal;
 			}
 
+			/// @brief Checks if the demuxing process ran to the end of the segment, rather than stopping on a truncated or unreadable stream.
+			/// @return True if the whole segment was demuxed, false otherwise.
+			inline bool didWeReachEnd() {
+				return reachedEndVal;
+			}
+
 		  protected:
-			jsonifier::string_view_base<uint8_t> data{};///< Input data for demuxing.
+			static constexpr uint64_t maxLeafElementSize{ 1024ULL * 1024ULL };///< The largest element that will be buffered in full.
+			static constexpr uint64_t maxFrameSize{ 1275 };///< The largest valid opus packet.
+
+			uint64_t segmentEnd{ std::numeric_limits<uint64_t>::max() };///< Absolute offset of the end of the segment.
+			jsonifier::string_base<uint8_t> data{};///< Input data that has yet to be demuxed.
 			std::deque<audio_frame_data> frames{};///< Queue to store collected frames.
-			bool doWeHaveTotalSize{ false };///< Flag indicating if total size has been determined.
-			bool areWeDoneVal{ false };///< Flag indicating if demuxing is complete.
+			jsonifier::vector<cue_point> cuePoints{};///< The cue points collected from the Cues element.
+			uint64_t timecodeScale{ 1000000 };///< Nanoseconds per timecode unit.
+			uint64_t pendingTrackNumber{};///< The track number of the track entry being parsed.
+			uint64_t seekTargetTimecode{};///< Frames before this timecode are dropped, after a seek.
+			uint64_t segmentDataStart{};///< Absolute offset of the start of the segment's data.
+			uint64_t opusTrackNumber{};///< The track number of the opus track, or 0 if not yet known.
+			uint64_t clusterTimecode{};///< The timecode of the current cluster.
 			uint64_t currentPosition{};///< Current position in the data.
-			uint64_t currentSize{};///< Current size of the element being processed.
-			int64_t totalSize{};///< Total size of the segment.
-
-			/// @brief Finds the next occurrence of the specified value in the data.
-			/// @tparam object_type The type of value to search for.
-			/// @param value The value to search for.
-			/// @return True if the value was found, false otherwise.
-			template<typename object_type> inline bool findNextId(object_type value) {
-				if (currentPosition + sizeof(object_type) >= data.size()) {
-					return false;
-				}
-				while (currentPosition + sizeof(object_type) < data.size()) {
-					if (reverseBytes<object_type>() == value) {
-						currentPosition += sizeof(object_type);
-						return true;
-					}
-					++currentPosition;
+			uint64_t currentTimecode{};///< The timecode of the most recently demuxed frame.
+			uint64_t currentCueTime{};///< The time of the cue point being parsed.
+			uint64_t bufferOffset{};///< Absolute offset of the first byte of data.
+			uint64_t bytesToSkip{};///< Bytes of an uninteresting element that have yet to arrive.
+			bool pendingTrackIsOpus{};///< Whether the track entry being parsed has the opus codec.
+			bool endOfStreamVal{ false };///< Flag indicating that no more data will be written.
+			bool reachedEndVal{ false };///< Flag indicating that the end of the segment was reached.
+			bool areWeDoneVal{ false };///< Flag indicating if demuxing is complete.
+
+			/// @brief Collects the absolute offset, within the stream, of the current position.
+			/// @return The absolute offset.
+			inline uint64_t getAbsolutePosition() {
+				return bufferOffset + currentPosition;
+			}
+
+			/// @brief Drops the bytes that have already been demuxed from the front of the buffer.
+			inline void releaseConsumedData() {
+				if (currentPosition > 0) {
+					const uint64_t remainingSize{ data.size() - currentPosition };
+					std::memmove(data.data(), data.data() + currentPosition, remainingSize);
+					data.resize(remainingSize);
+					bufferOffset += currentPosition;
+					currentPosition = 0;
 				}
-				return false;
 			}
 
-			/// @brief Reverses the byte order of the current element being processed.
-			/// @tparam object_type The type of the current element.
-			/// @return The current element with reversed byte order.
-			template<typename object_type> inline object_type reverseBytes() {
-				if (data.size() <= currentPosition + sizeof(object_type)) {
-					return static_cast<object_type>(-1);
-				}
-				object_type newValue{};
-				std::memcpy(&newValue, &data.at(currentPosition), sizeof(object_type));
-				reverseByteOrder(newValue);
-				return newValue;
+			/// @brief Reads an EBML variable-length integer at the current position.
+			/// @param value The reference to store the collected value.
+			/// @param keepMarker Whether to keep the length-marker bit, as is done for element ids.
+			/// @return The length of the integer in bytes, or 0 if it has not fully arrived.
+			inline uint64_t readVariableInt(uint64_t& value, bool keepMarker) {
+				if (currentPosition >= data.size()) {
+					return 0;
+				}
+				const uint8_t firstByte{ data[currentPosition] };
+				const uint64_t length{ 8ULL - ffLog2Tab[firstByte] };
+				if (currentPosition + length > data.size()) {
+					return 0;
+				}
+				value = keepMarker ? firstByte : firstByte ^ (1ULL << ffLog2Tab[firstByte]);
+				for (uint64_t x = 1; x < length; ++x) {
+					value = (value << 8) | data[currentPosition + x];
+				}
+				currentPosition += length;
+				return length;
 			}
 
-			/// @brief Collects the size of the current element being processed.
-			/// @return The size of the current element.
-			inline int64_t collectElementSize() {
-				if (currentPosition >= data.size() - 8) {
-					return -1;
+			/// @brief Reads an element's id and size at the current position.
+			/// @param elementId The reference to store the element's id.
+			/// @param elementSize The reference to store the element's size.
+			/// @param isSizeUnknown The reference to store whether the element's size is unknown.
+			/// @return True if the header was read, false if it has not fully arrived.
+			inline bool readElementHeader(uint64_t& elementId, uint64_t& elementSize, bool& isSizeUnknown) {
+				while (currentPosition < data.size() && (data[currentPosition] == 0 || ffLog2Tab[data[currentPosition]] < 4)) {
+					// Not a valid id, so resynchronize on the next byte.
+					++currentPosition;
 				}
-				return collectNumber();
+				if (readVariableInt(elementId, true) == 0) {
+					return false;
+				}
+				if (currentPosition < data.size() && data[currentPosition] == 0) {
+					// An invalid size, so skip past the id and resynchronize.
+					elementId = 0;
+					return true;
+				}
+				const uint64_t sizeLength{ readVariableInt(elementSize, false) };
+				if (sizeLength == 0) {
+					return false;
+				}
+				isSizeUnknown = elementSize == (1ULL << (7ULL * sizeLength)) - 1ULL;
+				return true;
 			}
 
-			/// @brief Collects a number from the data.
-			/// @return The collected number.
-			inline int64_t collectNumber() {
-				uint64_t read{}, n{ 1 };
-				uint64_t total{};
-				total = static_cast<uint8_t>(data.at(currentPosition++));
+			/// @brief Reads an unsigned integer element's value.
+			/// @param elementSize The size of the element.
+			/// @return The collected value.
+			inline uint64_t readUnsignedInt(uint64_t elementSize) {
+				uint64_t value{};
+				for (uint64_t x = 0; x < elementSize && x < sizeof(uint64_t); ++x) {
+					value = (value << 8) | data[currentPosition + x];
+				}
+				return value;
+			}
 
-				read = 8ULL - ffLog2Tab[total];
+			/// @brief Processes a single element, whose header has been read.
+			/// @param elementId The element's id.
+			/// @param elementSize The element's size.
+			/// @param isSizeUnknown Whether the element's size is unknown.
+			/// @return True if the element was processed, false if more data is required.
+			inline bool processElement(uint64_t elementId, uint64_t elementSize, bool isSizeUnknown) {
+				switch (elementId) {
+					case segmentId: {
+						segmentDataStart = getAbsolutePosition();
+						segmentEnd		 = isSizeUnknown ? std::numeric_limits<uint64_t>::max() : segmentDataStart + elementSize;
+						return true;
+					}
+					case trackEntryId: {
+						pendingTrackNumber = 0;
+						pendingTrackIsOpus = false;
+						return true;
+					}
+					case clusterId: {
+						[[fallthrough]];
+					}
+					case infoId: {
+						[[fallthrough]];
+					}
+					case tracksId: {
+						[[fallthrough]];
+					}
+					case cuesId: {
+						[[fallthrough]];
+					}
+					case cuePointId: {
+						[[fallthrough]];
+					}
+					case cueTrackPositionsId: {
+						[[fallthrough]];
+					}
+					case blockGroupId: {
+						return true;
+					}
+					case 0: {
+						return true;
+					}
+					case timecodeScaleId: {
+						[[fallthrough]];
+					}
+					case trackNumberId: {
+						[[fallthrough]];
+					}
+					case codecId: {
+						[[fallthrough]];
+					}
+					case cueTimeId: {
+						[[fallthrough]];
+					}
+					case cueClusterPositionId: {
+						[[fallthrough]];
+					}
+					case clusterTimecodeId: {
+						[[fallthrough]];
+					}
+					case blockId: {
+						[[fallthrough]];
+					}
+					case simpleBlockId: {
+						if (isSizeUnknown) {
+							areWeDoneVal = true;
+							return true;
+						} else if (elementSize > maxLeafElementSize) {
+							bytesToSkip = elementSize;
+							return true;
+						}
+						if (currentPosition + elementSize > data.size()) {
+							return false;
+						}
+						processLeafElement(elementId, jsonifier::string_view_base<uint8_t>{ data.data() + currentPosition, elementSize });
+						currentPosition += elementSize;
+						return true;
+					}
+					default: {
+						if (isSizeUnknown) {
+							message_printer::printError<print_message_type::general>(
+								jsonifier::string{ "Unknown-sized element with id: " } + jsonifier::toString(elementId) + jsonifier::string{ ", stopping." });
+							areWeDoneVal = true;
+							return true;
+						}
+						bytesToSkip = elementSize;
+						return true;
+					}
+				}
+			}
 
-				total ^= 1ULL << ffLog2Tab[total];
-				while (n++ < read) {
-					total = (total << 8) | static_cast<uint8_t>(data.at(currentPosition++));
+			/// @brief Processes the value of a leaf element.
+			/// @param elementId The element's id.
+			/// @param value The element's value.
+			inline void processLeafElement(uint64_t elementId, jsonifier::string_view_base<uint8_t> value) {
+				switch (elementId) {
+					case timecodeScaleId: {
+						timecodeScale = readUnsignedInt(value.size());
+						if (timecodeScale == 0) {
+							timecodeScale = 1000000;
+						}
+						break;
+					}
+					case trackNumberId: {
+						pendingTrackNumber = readUnsignedInt(value.size());
+						break;
+					}
+					case codecId: {
+						static constexpr jsonifier::string_view opusCodecId{ "A_OPUS" };
+						pendingTrackIsOpus = jsonifier::string_view{ reinterpret_cast<const char*>(value.data()), value.size() } == opusCodecId;
+						break;
+					}
+					case cueTimeId: {
+						currentCueTime = readUnsignedInt(value.size());
+						break;
+					}
+					case cueClusterPositionId: {
+						cuePoints.emplace_back(cue_point{ .clusterPosition = readUnsignedInt(value.size()), .time = currentCueTime });
+						break;
+					}
+					case clusterTimecodeId: {
+						clusterTimecode = readUnsignedInt(value.size());
+						break;
+					}
+					default: {
+						parseBlock(value);
+						break;
+					}
+				}
+				if (pendingTrackIsOpus && pendingTrackNumber != 0 && opusTrackNumber == 0) {
+					opusTrackNumber = pendingTrackNumber;
 				}
-				return static_cast<int64_t>(total);
 			}
 
-			/// @brief Parses an Opus frame.
-			inline void parseOpusFrame() {
+			/// @brief Parses a Block or SimpleBlock, emitting its frame if it belongs to the opus track.
+			/// @param block The block's contents.
+			inline void parseBlock(jsonifier::string_view_base<uint8_t> block) {
+				if (block.size() == 0 || block[0] == 0) {
+					return;
+				}
+				const uint64_t trackNumberLength{ 8ULL - ffLog2Tab[block[0]] };
+				static constexpr uint64_t timecodeAndFlagsSize{ 3 };
+				if (block.size() <= trackNumberLength + timecodeAndFlagsSize) {
+					return;
+				}
+				uint64_t trackNumber{ static_cast<uint64_t>(block[0] ^ (1ULL << ffLog2Tab[block[0]])) };
+				for (uint64_t x = 1; x < trackNumberLength; ++x) {
+					trackNumber = (trackNumber << 8) | block[x];
+				}
+				const int16_t relativeTimecode{ static_cast<int16_t>((block[trackNumberLength] << 8) | block[trackNumberLength + 1]) };
+				const uint8_t flags{ block[trackNumberLength + 2] };
+				const uint64_t frameOffset{ trackNumberLength + timecodeAndFlagsSize };
+				const uint64_t frameSize{ block.size() - frameOffset };
+				static constexpr uint8_t lacingFlags{ 0x06 };
+				if ((opusTrackNumber != 0 && trackNumber != opusTrackNumber) || (flags & lacingFlags) != 0 || frameSize > maxFrameSize) {
+					return;
+				}
+				currentTimecode = static_cast<uint64_t>(std::max(static_cast<int64_t>(clusterTimecode) + relativeTimecode, int64_t{}));
+				if (currentTimecode < seekTargetTimecode) {
+					return;
+				}
 				audio_frame_data frameNew{};
-				frameNew.currentSize = static_cast<int64_t>(currentSize - 4);
-				frameNew += jsonifier::string_view_base<uint8_t>{ data.data() + currentPosition + 4, static_cast<uint64_t>(frameNew.currentSize) };
+				frameNew.currentSize = static_cast<int64_t>(frameSize);
+				frameNew += jsonifier::string_view_base<uint8_t>{ block.data() + frameOffset, frameSize };
 				frameNew.type = audio_frame_type::encoded;
-				currentPosition += currentSize;
 				frames.emplace_back(std::move(frameNew));
-				currentSize = 0;
 			}
 		};
 
-		using opus_packet = jsonifier::vector<uint8_t>;
-
-		/// @brief A class representing an Ogg page for demuxing.
-		class ogg_page {
-		  public:
-			/// @brief Constructor for ogg_page.
-			/// @param newData The data for the Ogg page.
-			inline ogg_page(jsonifier::vector<uint8_t>&& newData) {
-				data = std::move(newData);
-				verifyAsOggPage();
-				getSegmentData();
-			}
-
-			/// @brief Retrieves the next Opus packet from the Ogg page.
-			/// @param newPacket Reference to store the retrieved Opus packet.
-			/// @return True if an Opus packet was retrieved, false otherwise.
-			inline bool getOpusPacket(opus_packet& newPacket) {
-				if (segmentTable.size() > 0) {
-					auto newSpace = static_cast<uint64_t>(segmentTable.front());
-					segmentTable.pop_front();
-					newPacket.resize(newSpace);
-					std::memcpy(newPacket.data(), data.data() + currentPosition, newSpace);
-					currentPosition += newSpace;
-					return true;
-				} else {
-					return false;
+		/// @brief Generates the slicing-by-8 lookup tables for the Ogg page checksum - crc-32 with polynomial 0x04C11DB7, unreflected.
+		/// @return The lookup tables.
+		inline constexpr std::array<std::array<uint32_t, 256>, 8> generateOggCrcTables() {
+			std::array<std::array<uint32_t, 256>, 8> returnValue{};
+			for (uint32_t x = 0; x < 256; ++x) {
+				uint32_t value{ x << 24 };
+				for (uint32_t y = 0; y < 8; ++y) {
+					value = (value & 0x80000000) ? (value << 1) ^ 0x04C11DB7 : (value << 1);
 				}
+				returnValue[0][x] = value;
 			}
-
-			/// @brief Parses the segment data of the Ogg page.
-			inline void getSegmentData() {
-				segmentCount = data.at(26);
-				currentPosition += 27;
-				for (uint64_t x{}; x < segmentCount; ++x) {
-					uint64_t packetLength{ data.at(27ULL + x) };
-					while (data.at(27ULL + x) == 255) {
-						++x;
-						packetLength += data.at(27ULL + x);
-					}
-					segmentTable.emplace_back(packetLength);
+			for (uint32_t x = 0; x < 256; ++x) {
+				for (uint64_t y = 1; y < 8; ++y) {
+					returnValue[y][x] = (returnValue[y - 1][x] << 8) ^ returnValue[0][returnValue[y - 1][x] >> 24];
 				}
-				currentPosition += segmentCount;
-				return;
 			}
-
-			/// @brief Returns the size of the Ogg page data.
-			/// @return The size of the Ogg page data.
-			inline uint64_t getDataSize() {
-				return data.size();
+			return returnValue;
+		}
+
+		static constexpr std::array<std::array<uint32_t, 256>, 8> oggCrcTables{ generateOggCrcTables() };
+
+		/// @brief Updates an Ogg page checksum with a run of bytes, eight bytes at a time.
+		/// @param crc The checksum so far.
+		/// @param bytes The bytes to add to the checksum.
+		/// @param length The number of bytes.
+		/// @return The updated checksum.
+		inline uint32_t updateOggCrc(uint32_t crc, const uint8_t* bytes, uint64_t length) {
+			while (length >= 8) {
+				crc ^= (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) | (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3];
+				crc = oggCrcTables[7][crc >> 24] ^ oggCrcTables[6][(crc >> 16) & 0xFF] ^ oggCrcTables[5][(crc >> 8) & 0xFF] ^ oggCrcTables[4][crc & 0xFF] ^
+					oggCrcTables[3][bytes[4]] ^ oggCrcTables[2][bytes[5]] ^ oggCrcTables[1][bytes[6]] ^ oggCrcTables[0][bytes[7]];
+				bytes += 8;
+				length -= 8;
 			}
-
-		  protected:
-			std::deque<uint64_t> segmentTable{};///< Segment table storing Opus packet sizes.
-			jsonifier::vector<uint8_t> data{};///< The data for the Ogg page.
-			uint64_t totalPacketSize{};///< Total size of Opus packets in the page.
-			uint64_t currentPosition{};///< Current position in the page data.
-			uint64_t segmentCount{};///< Number of segments in the Ogg page.
-
-			/// @brief Verifies that the data represents a valid Ogg page.
-			inline void verifyAsOggPage() {
-				while (data.at(currentPosition) != 'O' || data.at(currentPosition + 1) != 'g' || data.at(currentPosition + 2) != 'g' || data.at(currentPosition + 3) != 'S') {
-					++currentPosition;
-					if (currentPosition >= data.size()) {
-						return;
-					}
-				}
+			while (length > 0) {
+				crc = (crc << 8) ^ oggCrcTables[0][(crc >> 24) ^ *bytes];
+				++bytes;
+				--length;
 			}
-		};
+			return crc;
+		}
 
-		/// @brief A class for demuxing Ogg-contained audio data.
+		/// @brief A class for demuxing Ogg-contained audio data, by walking the pages in place within a single streaming buffer.
 		class ogg_demuxer {
 		  public:
 			inline ogg_demuxer() = default;
 
+			/// @brief Collects the next Opus packet from the demuxer, without copying it.
+			/// @param packetNew The reference to store a view of the packet, which remains valid until the next call to collectPacket or writeData.
+			/// @return True if a packet was collected, false otherwise.
+			inline bool collectPacket(jsonifier::string_view_base<uint8_t>& packetNew) {
+				while (packets.size() > 0) {
+					const ogg_packet_location location{ packets.front() };
+					packets.pop_front();
+					if (location.offset == std::numeric_limits<uint64_t>::max()) {
+						collectedPacket = std::move(continuedPackets.front());
+						continuedPackets.pop_front();
+						packetNew = jsonifier::string_view_base<uint8_t>{ collectedPacket.data(), collectedPacket.size() };
+					} else {
+						packetNew = jsonifier::string_view_base<uint8_t>{ data.data() + location.offset, location.size };
+					}
+					if (!isHeaderPacket(packetNew)) {
+						return true;
+					}
+				}
+				return false;
+			}
+
 			/// @brief Collects the next audio frame from the demuxer.
 			/// @param frameNew The reference to store the collected frame.
 			/// @return True if a frame was collected, false otherwise.
 			inline bool collectFrame(audio_frame_data& frameNew) {
-				if (frames.size() > 0) {
-					frameNew = std::move(frames.front());
-					frames.pop_front();
+				jsonifier::string_view_base<uint8_t> packet{};
+				if (collectPacket(packet)) {
+					frameNew.clearData();
+					frameNew += packet;
+					frameNew.currentSize = static_cast<int64_t>(packet.size());
+					frameNew.type		 = audio_frame_type::encoded;
 					return true;
 				} else {
 					return false;
 				}
 			}
 
-			/// @brief Writes data to the Ogg demuxer and processes it.
-			/// @param inputData The data to be written and processed.
+			/// @brief Writes data to the Ogg demuxer - bytes belonging to packets that have already been collected are released first.
+			/// @param inputData The data to be written, which must directly follow the previously written data.
 			inline void writeData(jsonifier::string_view inputData) {
-				uint64_t pos = 0;
-				data.clear();
-				data.resize(inputData.size());
-				std::memcpy(data.data(), inputData.data(), inputData.size());
-				uint64_t collectedLength{};
-				while (pos < inputData.size()) {
-					uint64_t oggPos = inputData.find("OggS", pos);
-					if (oggPos != jsonifier::string::npos) {
-						uint64_t nextOggPos = inputData.find("OggS", oggPos + 1);
-						if (nextOggPos != jsonifier::string::npos) {
-							collectedLength += nextOggPos - oggPos;
-							jsonifier::vector<uint8_t> newerString{};
-							newerString.resize(nextOggPos - oggPos);
-							std::memcpy(newerString.data(), data.data() + oggPos, nextOggPos - oggPos);
-							pages.emplace_back(std::move(newerString));
-							pos = nextOggPos;
-						} else {
-							jsonifier::vector<uint8_t> newerString{};
-							newerString.resize(inputData.size() - collectedLength);
-							std::memcpy(newerString.data(), data.data() + oggPos, inputData.size() - collectedLength);
-							pages.emplace_back(std::move(newerString));
-							pos = collectedLength;
-							break;
-						}
-					} else {
-						jsonifier::vector<uint8_t> newerString{};
-						newerString.resize(inputData.size() - collectedLength);
-						std::memcpy(newerString.data(), data.data() + oggPos, inputData.size() - collectedLength);
-						pages.emplace_back(std::move(newerString));
-						break;
-					}
-				}
-				return;
+				releaseConsumedData();
+				const uint64_t oldSize{ data.size() };
+				data.resize(oldSize + inputData.size());
+				std::memcpy(data.data() + oldSize, inputData.data(), inputData.size());
 			}
 
-			/// @brief Proceeds with the demuxing process.
-			/// @return True if demuxing is successful, false otherwise.
+			/// @brief Proceeds with the demuxing process, walking every complete page that has been written so far.
+			/// @return True if any pages were processed, false otherwise.
 			inline bool proceedDemuxing() {
-				while (1) {
-					if (!processOggPage()) {
-						return false;
-					}
+				bool returnValue{};
+				while (processOggPage()) {
+					returnValue = true;
 				}
-				return true;
+				return returnValue;
 			}
 
 		  protected:
-			std::deque<audio_frame_data> frames{};///< Queue to store collected audio frames.
-			jsonifier::vector<uint8_t> data{};///< Input data for demuxing.
-			std::deque<opus_packet> packets{};///< Queue to store Opus packets.
-			std::deque<ogg_page> pages{};///< Queue to store Ogg pages.
-
-			/// @brief Processes an Ogg page for demuxing.
-			/// @return True if processing is successful, false if there are no more pages.
-			inline bool processOggPage() {
-				if (pages.empty()) {
+			/// @brief The location of a packet within the buffer - an offset of uint64_t's max refers to the front of continuedPackets.
+			struct ogg_packet_location {
+				uint64_t offset{};
+				uint64_t size{};
+			};
+
+			static constexpr uint64_t pageHeaderSize{ 27 };
+			static constexpr uint64_t checksumOffset{ 22 };
+			static constexpr uint8_t continuedPacketFlag{ 0x01 };
+
+			std::deque<jsonifier::string_base<uint8_t>> continuedPackets{};///< Packets that were reassembled from more than one page.
+			jsonifier::string_base<uint8_t> collectedPacket{};///< The most recently collected reassembled packet.
+			jsonifier::string_base<uint8_t> partialPacket{};///< A packet that continues onto the next page.
+			std::deque<ogg_packet_location> packets{};///< Queue of packets that have yet to be collected.
+			jsonifier::string_base<uint8_t> data{};///< Input data for demuxing.
+			uint64_t currentPosition{};///< Position of the next page in the data.
+
+			/// @brief Checks whether a packet is one of the OpusHead or OpusTags header packets.
+			/// @param packet The packet to check.
+			/// @return True if the packet is a header packet, false otherwise.
+			inline static bool isHeaderPacket(jsonifier::string_view_base<uint8_t> packet) {
+				static constexpr jsonifier::string_view headMagic{ "OpusHead" };
+				static constexpr jsonifier::string_view tagsMagic{ "OpusTags" };
+				if (packet.size() < headMagic.size()) {
 					return false;
 				}
-
-				processPages();
-				processPackets();
-
-				return true;
+				jsonifier::string_view magic{ reinterpret_cast<const char*>(packet.data()), headMagic.size() };
+				return magic == headMagic || magic == tagsMagic;
 			}
 
-			/// @brief Processes Opus packets extracted from Ogg pages.
-			inline void processPackets() {
-				while (!packets.empty()) {
-					opus_packet newPacket = packets.front();
-					packets.pop_front();
-					audio_frame_data newFrame{};
-					newFrame += newPacket;
-					newFrame.currentSize = static_cast<int64_t>(newPacket.size());
-					newFrame.type		 = audio_frame_type::encoded;
-					frames.emplace_back(std::move(newFrame));
+			/// @brief Drops the bytes that are no longer referenced from the front of the buffer.
+			inline void releaseConsumedData() {
+				uint64_t releasedSize{ currentPosition };
+				for (auto& value: packets) {
+					if (value.offset != std::numeric_limits<uint64_t>::max()) {
+						releasedSize = std::min(releasedSize, value.offset);
+						break;
+					}
 				}
+				if (releasedSize > 0) {
+					for (auto& value: packets) {
+						if (value.offset != std::numeric_limits<uint64_t>::max()) {
+							value.offset -= releasedSize;
+						}
+					}
+					std::memmove(data.data(), data.data() + releasedSize, data.size() - releasedSize);
+					data.resize(data.size() - releasedSize);
+					currentPosition -= releasedSize;
+				}
+			}
+
+			/// @brief Computes the checksum of a page, with its checksum field treated as zero.
+			/// @param page The page.
+			/// @param pageSize The size of the page.
+			/// @return The checksum.
+			inline static uint32_t computePageCrc(const uint8_t* page, uint64_t pageSize) {
+				static constexpr uint8_t zeroes[sizeof(uint32_t)]{};
+				uint32_t crc{ updateOggCrc(0, page, checksumOffset) };
+				crc = updateOggCrc(crc, zeroes, sizeof(uint32_t));
+				return updateOggCrc(crc, page + checksumOffset + sizeof(uint32_t), pageSize - checksumOffset - sizeof(uint32_t));
 			}
 
-			/// @brief Processes Ogg pages to extract Opus packets.
-			inline void processPages() {
-				while (!pages.empty()) {
-					ogg_page page = pages.front();
-					pages.pop_front();
-					opus_packet newPacket{};
-					while (page.getOpusPacket(newPacket)) {
-						packets.emplace_back(newPacket);
+			/// @brief Processes an Ogg page for demuxing.
+			/// @return True if a page was processed or skipped, false if a complete page has yet to arrive.
+			inline bool processOggPage() {
+				jsonifier::string_view remainingData{ reinterpret_cast<const char*>(data.data()) + currentPosition, data.size() - currentPosition };
+				const uint64_t pageStart{ remainingData.find("OggS") };
+				if (pageStart == jsonifier::string_view::npos) {
+					// Keep a possibly-partial capture pattern around.
+					currentPosition = data.size() > 3 ? std::max(currentPosition, static_cast<uint64_t>(data.size() - 3)) : currentPosition;
+					return false;
+				}
+				currentPosition += pageStart;
+				const uint8_t* page{ data.data() + currentPosition };
+				const uint64_t availableSize{ data.size() - currentPosition };
+				if (availableSize < pageHeaderSize) {
+					return false;
+				}
+				const uint64_t segmentCount{ page[26] };
+				if (availableSize < pageHeaderSize + segmentCount) {
+					return false;
+				}
+				uint64_t bodySize{};
+				for (uint64_t x = 0; x < segmentCount; ++x) {
+					bodySize += page[pageHeaderSize + x];
+				}
+				const uint64_t pageSize{ pageHeaderSize + segmentCount + bodySize };
+				if (availableSize < pageSize) {
+					return false;
+				}
+				uint32_t storedCrc{};
+				for (uint64_t x = 0; x < sizeof(uint32_t); ++x) {
+					storedCrc |= static_cast<uint32_t>(page[checksumOffset + x]) << (8 * x);
+				}
+				if (page[4] != 0 || computePageCrc(page, pageSize) != storedCrc) {
+					message_printer::printError<print_message_type::general>(
+						jsonifier::string{ "Invalid Ogg page at index: " } + jsonifier::toString(currentPosition) + jsonifier::string{ ", skipping." });
+					++currentPosition;
+					return true;
+				}
+				const bool isContinuedPage{ static_cast<bool>(page[5] & continuedPacketFlag) };
+				if (!isContinuedPage) {
+					partialPacket.clear();
+				}
+				uint64_t packetOffset{ currentPosition + pageHeaderSize + segmentCount };
+				uint64_t packetSize{};
+				bool isContinuation{ isContinuedPage && partialPacket.size() > 0 };
+				// The start of a continued packet that we never saw, such as after a lost page, can't be reassembled.
+				bool isOrphanedContinuation{ isContinuedPage && partialPacket.size() == 0 };
+				for (uint64_t x = 0; x < segmentCount; ++x) {
+					const uint8_t lacingValue{ page[pageHeaderSize + x] };
+					packetSize += lacingValue;
+					if (lacingValue < 255) {
+						if (isContinuation) {
+							appendToPartialPacket(packetOffset, packetSize);
+							continuedPackets.emplace_back(std::move(partialPacket));
+							partialPacket.clear();
+							packets.emplace_back(ogg_packet_location{ std::numeric_limits<uint64_t>::max(), 0 });
+							isContinuation = false;
+						} else if (isOrphanedContinuation) {
+							isOrphanedContinuation = false;
+						} else if (packetSize > 0) {
+							packets.emplace_back(ogg_packet_location{ packetOffset, packetSize });
+						}
+						packetOffset += packetSize;
+						packetSize = 0;
 					}
 				}
+				if (packetSize > 0 && !isOrphanedContinuation) {
+					// The final packet continues onto the next page.
+					appendToPartialPacket(packetOffset, packetSize);
+				}
+				currentPosition += pageSize;
+				return true;
+			}
+
+			/// @brief Appends a run of the buffer to the packet that spans pages.
+			/// @param offset The offset of the run.
+			/// @param size The size of the run.
+			inline void appendToPartialPacket(uint64_t offset, uint64_t size) {
+				const uint64_t oldSize{ partialPacket.size() };
+				partialPacket.resize(oldSize + size);
+				std::memcpy(partialPacket.data() + oldSize, data.data() + offset, size);
 			}
 		};
 
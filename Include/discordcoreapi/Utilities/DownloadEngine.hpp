@@ -0,0 +1,292 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// DownloadEngine.hpp - Header file for the prefetching song download engine.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file DownloadEngine.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <condition_variable>
+#include <functional>
+#include <map>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup voice_connection
+	 * @{
+	 */
+
+	/// @brief Buffer-health metrics of a streaming song download.
+	struct download_health_metrics {
+		double requestThroughput{};///< Smoothed bytes per second of a single request.
+		milliseconds totalStallTime{};///< Time spent waiting on the network with a starved buffer.
+		double totalThroughput{};///< Smoothed bytes per second across all of the requests.
+		milliseconds bufferedAhead{};///< Audio buffered ahead of playback, as last reported.
+		uint64_t segmentsCompleted{};///< Segments that have been downloaded.
+		uint64_t segmentsDelivered{};///< Segments that have been handed to the demuxer.
+		uint64_t bytesDownloaded{};///< Total bytes downloaded.
+		uint64_t segmentsTotal{};///< Segments that make up the song.
+		uint64_t retryCount{};///< Requests that had to be retried.
+		uint64_t stallCount{};///< Times playback was starved waiting on the network.
+		uint64_t inFlight{};///< Requests currently in flight.
+		uint64_t window{};///< Current number of segments allowed ahead of the demuxer.
+	};
+
+	/**@}*/
+
+	namespace discord_core_internal {
+
+		/// @brief Counts a download as active for as long as it lives, so that several downloads on one api are tracked independently.
+		struct active_download_guard {
+			inline active_download_guard(std::atomic_uint64_t& countNew) : count{ countNew } {
+				count.fetch_add(1, std::memory_order_release);
+			}
+
+			inline ~active_download_guard() {
+				count.fetch_sub(1, std::memory_order_release);
+			}
+
+		  protected:
+			std::atomic_uint64_t& count;
+		};
+
+		/// @brief Tuning values for the prefetching download engine.
+		struct download_engine_settings {
+			milliseconds highWatermark{ 30000 };///< Above this much buffered audio the window shrinks.
+			milliseconds lowWatermark{ 3000 };///< Below this much buffered audio the window grows.
+			uint64_t initialWindow{ 2 };
+			uint64_t maxWindow{ 6 };
+			uint64_t minWindow{ 1 };
+			uint64_t maxRetries{ 3 };
+		};
+
+		/// @brief Keeps several range or segment requests in flight ahead of the demuxer, and hands their results back in order.
+		class ranged_download_engine {
+		  public:
+			using workload_factory = std::function<https_workload_data(uint64_t)>;
+
+			/// @brief Starts downloading.
+			/// @param clientNew the https client to issue the requests through.
+			/// @param segmentCountNew the number of segments that make up the stream.
+			/// @param workloadFactoryNew builds the request for a given segment index, it is called again for each retry.
+			/// @param settingsNew the tuning values.
+			inline ranged_download_engine(https_client_core& clientNew, uint64_t segmentCountNew, workload_factory workloadFactoryNew,
+				download_engine_settings settingsNew = download_engine_settings{})
+				: settings{ settingsNew }, workloadFactory{ std::move(workloadFactoryNew) }, client{ &clientNew }, segmentCount{ segmentCountNew } {
+				settings.maxWindow = std::max(settings.maxWindow, uint64_t{ 1 });
+				settings.minWindow = std::clamp(settings.minWindow, uint64_t{ 1 }, settings.maxWindow);
+				window			   = std::clamp(settings.initialWindow, settings.minWindow, settings.maxWindow);
+				lastCompletion	   = hrclock::now();
+				for (uint64_t x = 0; x < std::min(settings.maxWindow, segmentCount); ++x) {
+					workers.emplace_back([this](std::stop_token token) {
+						runWorker(token);
+					});
+				}
+			}
+
+			inline ranged_download_engine& operator=(const ranged_download_engine&) = delete;
+			inline ranged_download_engine(const ranged_download_engine&)			= delete;
+
+			/// @brief Collects the next segment in order, waiting up to the timeout for it to arrive.
+			/// @param segment the string to move the segment into.
+			/// @param timeout how long to wait for the segment.
+			/// @return true if a segment was collected.
+			inline bool collectSegment(jsonifier::string& segment, milliseconds timeout) {
+				std::unique_lock lock{ accessMutex };
+				auto startTime = hrclock::now();
+				if (!readyCondition.wait_for(lock, timeout, [this] {
+						return failed || nextToDeliver >= segmentCount || readySegments.contains(nextToDeliver);
+					})) {
+					recordStall(hrclock::now() - startTime);
+					return false;
+				}
+				auto readyIterator = readySegments.find(nextToDeliver);
+				if (readyIterator == readySegments.end()) {
+					return false;
+				}
+				recordStall(hrclock::now() - startTime);
+				segment = std::move(readyIterator->second);
+				readySegments.erase(readyIterator);
+				++nextToDeliver;
+				lock.unlock();
+				workCondition.notify_all();
+				return true;
+			}
+
+			/// @brief Reports how much audio is buffered ahead of playback, which drives the window size.
+			/// @param bufferedAhead the buffered audio duration.
+			inline void reportBufferLevel(milliseconds bufferedAhead) {
+				std::unique_lock lock{ accessMutex };
+				bufferLevel = bufferedAhead;
+			}
+
+			/// @return true once every segment has been handed out.
+			inline bool areWeDone() {
+				std::unique_lock lock{ accessMutex };
+				return nextToDeliver >= segmentCount;
+			}
+
+			/// @return true if a segment could not be downloaded after retrying.
+			inline bool didWeFail() {
+				std::unique_lock lock{ accessMutex };
+				return failed;
+			}
+
+			/// @return a snapshot of the buffer-health metrics.
+			inline download_health_metrics getMetrics() {
+				std::unique_lock lock{ accessMutex };
+				download_health_metrics returnData{ metrics };
+				returnData.bufferedAhead	 = bufferLevel;
+				returnData.segmentsDelivered = nextToDeliver;
+				returnData.segmentsTotal	 = segmentCount;
+				returnData.inFlight			 = inFlight;
+				returnData.window			 = window;
+				return returnData;
+			}
+
+			inline ~ranged_download_engine() {
+				for (auto& value: workers) {
+					value.request_stop();
+				}
+				workCondition.notify_all();
+				workers.clear();
+			}
+
+		  protected:
+			std::map<uint64_t, jsonifier::string> readySegments{};
+			std::condition_variable_any workCondition{};
+			std::condition_variable_any readyCondition{};
+			std::vector<std::jthread> workers{};
+			download_engine_settings settings{};
+			download_health_metrics metrics{};
+			hrclock::time_point lastCompletion{};
+			workload_factory workloadFactory{};
+			double throughputAtLastGrowth{};
+			milliseconds bufferLevel{};
+			https_client_core* client{};
+			std::mutex accessMutex{};
+			uint64_t nextToDeliver{};
+			uint64_t segmentCount{};
+			uint64_t nextToIssue{};
+			uint64_t inFlight{};
+			uint64_t window{};
+			bool failed{};
+
+			static constexpr double smoothingFactor{ 0.3 };
+
+			inline static double smooth(double current, double sample) {
+				return current == 0.0 ? sample : current + (sample - current) * smoothingFactor;
+			}
+
+			/// Only counts as a stall when playback is actually starved, otherwise the consumer is just polling ahead of need.
+			inline void recordStall(hrclock::duration waited) {
+				if (bufferLevel < settings.lowWatermark && waited >= 1ms) {
+					++metrics.stallCount;
+					metrics.totalStallTime += std::chrono::duration_cast<milliseconds>(waited);
+				}
+			}
+
+			/// Grows the window while the buffer is low, but only as long as the last growth actually raised the combined throughput - once the upstream's
+			/// bandwidth is saturated, more connections just compete with each other.
+			inline void adjustWindow() {
+				if (bufferLevel > settings.highWatermark) {
+					window				   = std::max(window - 1, settings.minWindow);
+					throughputAtLastGrowth = 0.0;
+				} else if (bufferLevel < settings.lowWatermark && window < settings.maxWindow) {
+					if (throughputAtLastGrowth == 0.0 || metrics.totalThroughput > throughputAtLastGrowth * 1.1) {
+						throughputAtLastGrowth = metrics.totalThroughput;
+						++window;
+					}
+				}
+			}
+
+			inline void recordCompletion(uint64_t index, jsonifier::string&& data, hrclock::duration latency) {
+				auto currentTime = hrclock::now();
+				double size		 = static_cast<double>(data.size());
+				double latencyS	 = std::chrono::duration<double>(latency).count();
+				double gapS		 = std::chrono::duration<double>(currentTime - lastCompletion).count();
+				lastCompletion	 = currentTime;
+				if (latencyS > 0.0) {
+					metrics.requestThroughput = smooth(metrics.requestThroughput, size / latencyS);
+				}
+				if (gapS > 0.0) {
+					metrics.totalThroughput = smooth(metrics.totalThroughput, size / gapS);
+				}
+				metrics.bytesDownloaded += data.size();
+				++metrics.segmentsCompleted;
+				readySegments.emplace(index, std::move(data));
+				adjustWindow();
+			}
+
+			inline void runWorker(std::stop_token token) {
+				while (!token.stop_requested()) {
+					std::unique_lock lock{ accessMutex };
+					if (!workCondition.wait(lock, token, [this] {
+							return failed || nextToIssue >= segmentCount || nextToIssue - nextToDeliver < window;
+						})) {
+						return;
+					}
+					if (failed || nextToIssue >= segmentCount) {
+						return;
+					}
+					uint64_t index{ nextToIssue++ };
+					++inFlight;
+					lock.unlock();
+					jsonifier::string data{};
+					auto startTime = hrclock::now();
+					bool succeeded{};
+					for (uint64_t x = 0; x <= settings.maxRetries && !token.stop_requested() && !succeeded; ++x) {
+						if (x > 0) {
+							std::unique_lock lockNew{ accessMutex };
+							++metrics.retryCount;
+						}
+						try {
+							https_response_data result{ client->submitWorkloadAndGetResult(workloadFactory(index)) };
+							if (result.responseCode == 200 && result.responseData.size() > 0) {
+								data	  = std::move(result.responseData);
+								succeeded = true;
+							}
+						} catch (const https_error& error) {
+							message_printer::printError<print_message_type::https>("ranged_download_engine::runWorker() error: " + jsonifier::string{ error.what() });
+						}
+					}
+					lock.lock();
+					--inFlight;
+					if (succeeded) {
+						recordCompletion(index, std::move(data), hrclock::now() - startTime);
+					} else if (!token.stop_requested()) {
+						failed = true;
+					}
+					lock.unlock();
+					readyCondition.notify_all();
+					workCondition.notify_all();
+				}
+			}
+		};
+	}
+}
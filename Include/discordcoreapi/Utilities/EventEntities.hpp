@@ -30,6 +30,12 @@
 #pragma once
 
 #include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/CoRoutine.hpp>
+#include <optional>
+#include <array>
+#include <deque>
+#include <tuple>
+#include <bit>
 
 namespace discord_core_api {
 
@@ -63,6 +69,91 @@ namespace discord_core_api {
 			uint64_t eventId{};///< Identifier for the event.
 		};
 
+		/// @brief How an event runs its handlers. every event starts out sequential, and the other modes are opted into per event, with
+		/// event::setDispatchMode().
+		enum class event_dispatch_mode : uint8_t {
+			sequential = 0,///< Each handler runs to completion on the dispatching thread before the next one starts.
+			parallel   = 1,///< The handlers are launched together onto the co_routine thread pool, and dispatching returns immediately.
+			ordered	   = 2,///< Like parallel, but dispatches sharing an ordering key run strictly one after another.
+		};
+
+		/// @brief A snapshot of a latency histogram, with power-of-two microsecond buckets.
+		struct latency_histogram_data {
+			static constexpr uint64_t bucketCount{ 32 };
+
+			std::array<uint64_t, bucketCount> buckets{};///< Bucket x counts the samples in [2^(x - 1), 2^x) microseconds.
+			uint64_t totalMicroseconds{};///< Sum of the samples.
+			uint64_t maxMicroseconds{};///< Longest sample.
+			uint64_t count{};///< Number of samples.
+
+			/// @brief Estimates a percentile of the recorded latencies.
+			/// @param percentile the percentile to estimate, from 0 to 100.
+			/// @return microseconds the upper bound of the bucket holding that percentile.
+			inline microseconds getPercentile(double percentile) const {
+				if (count == 0) {
+					return microseconds{};
+				}
+				uint64_t target{ std::max(static_cast<uint64_t>(std::ceil(static_cast<double>(count) * std::clamp(percentile, 0.0, 100.0) / 100.0)), uint64_t{ 1 }) };
+				uint64_t seen{};
+				for (uint64_t x = 0; x < bucketCount; ++x) {
+					seen += buckets[x];
+					if (seen >= target) {
+						return microseconds{ static_cast<int64_t>(std::min(uint64_t{ 1 } << x, maxMicroseconds)) };
+					}
+				}
+				return microseconds{ static_cast<int64_t>(maxMicroseconds) };
+			}
+
+			/// @return microseconds the mean of the recorded latencies.
+			inline microseconds getMean() const {
+				return count == 0 ? microseconds{} : microseconds{ static_cast<int64_t>(totalMicroseconds / count) };
+			}
+		};
+
+		/// @brief A lock-free latency histogram, safe to record into from any number of threads.
+		class latency_histogram {
+		  public:
+			/// @brief Records a latency sample.
+			/// @param sample the latency to record.
+			inline void record(hrclock::duration sample) {
+				uint64_t value{ static_cast<uint64_t>(std::max(std::chrono::duration_cast<microseconds>(sample).count(), int64_t{ 0 })) };
+				buckets[std::min(static_cast<uint64_t>(std::bit_width(value)), latency_histogram_data::bucketCount - 1)].fetch_add(1, std::memory_order_relaxed);
+				totalMicroseconds.fetch_add(value, std::memory_order_relaxed);
+				count.fetch_add(1, std::memory_order_relaxed);
+				uint64_t currentMax{ maxMicroseconds.load(std::memory_order_relaxed) };
+				while (value > currentMax && !maxMicroseconds.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+				}
+			}
+
+			/// @return latency_histogram_data a snapshot of the recorded samples.
+			inline latency_histogram_data getData() const {
+				latency_histogram_data returnData{};
+				for (uint64_t x = 0; x < latency_histogram_data::bucketCount; ++x) {
+					returnData.buckets[x] = buckets[x].load(std::memory_order_relaxed);
+				}
+				returnData.totalMicroseconds = totalMicroseconds.load(std::memory_order_relaxed);
+				returnData.maxMicroseconds	 = maxMicroseconds.load(std::memory_order_relaxed);
+				returnData.count			 = count.load(std::memory_order_relaxed);
+				return returnData;
+			}
+
+			/// @brief Discards the recorded samples.
+			inline void reset() {
+				for (auto& value: buckets) {
+					value.store(0, std::memory_order_relaxed);
+				}
+				totalMicroseconds.store(0, std::memory_order_relaxed);
+				maxMicroseconds.store(0, std::memory_order_relaxed);
+				count.store(0, std::memory_order_relaxed);
+			}
+
+		  protected:
+			std::array<std::atomic_uint64_t, latency_histogram_data::bucketCount> buckets{};
+			std::atomic_uint64_t totalMicroseconds{};
+			std::atomic_uint64_t maxMicroseconds{};
+			std::atomic_uint64_t count{};
+		};
+
 	};
 
 	template<event_delegate_token_t value_type> struct key_hasher<value_type> {
@@ -148,6 +239,8 @@ namespace discord_core_api {
 		/// @brief Template class representing an event that executes event functions.
 		template<typename return_type, typename... arg_types> class event {
 		  public:
+			using ordering_key_function = std::function<uint64_t(const arg_types&...)>;
+
 			unordered_map<event_delegate_token, event_delegate<return_type, arg_types...>> functions{};
 
 			inline event& operator=(const event& other) = delete;
@@ -160,8 +253,13 @@ namespace discord_core_api {
 			/// @return reference to the current event instance after the move assignment.
 			inline event& operator=(event&& other) noexcept {
 				if (this != &other) {
+					std::scoped_lock lock{ accessMutex, other.accessMutex };
 					std::swap(functions, other.functions);
+					std::swap(orderingKey, other.orderingKey);
 					std::swap(eventId, other.eventId);
+					std::swap(mode, other.mode);
+					other.publishSnapshot();
+					publishSnapshot();
 				}
 				return *this;
 			}
@@ -179,6 +277,7 @@ namespace discord_core_api {
 			inline event() {
 				std::unique_lock lock{ accessMutex };
 				eventId = std::chrono::duration_cast<std::chrono::duration<uint64_t, std::micro>>(sys_clock::now().time_since_epoch()).count();
+				publishSnapshot();
 			}
 
 			/// @brief Add an event delegate to the event.
@@ -190,6 +289,7 @@ namespace discord_core_api {
 				eventToken.handlerId  = std::chrono::duration_cast<std::chrono::duration<uint64_t, std::micro>>(sys_clock::now().time_since_epoch()).count();
 				eventToken.eventId	  = eventId;
 				functions[eventToken] = std::move(eventDelegate);
+				publishSnapshot();
 				return eventToken;
 			}
 
@@ -200,34 +300,262 @@ namespace discord_core_api {
 				if (eventToken.eventId == eventId) {
 					if (functions.contains(eventToken)) {
 						functions.erase(eventToken);
+						publishSnapshot();
 					}
 				}
 			}
 
+			/// @brief Removes every event delegate from the event.
+			inline void clear() {
+				std::unique_lock lock{ accessMutex };
+				functions.clear();
+				publishSnapshot();
+			}
+
+			/// @brief Sets how the handlers are run when the event fires.
+			/// @details sequential dispatches already stay in order per guild, since the gateway runs each guild's events on its own executor lane. a bot
+			/// with slow handlers can overlap them, while keeping each guild's events in order, with:
+			/// @code
+			/// client->getEventManager().onMessageCreationEvent.setDispatchMode(event_dispatch_mode::ordered, [](const on_message_creation_data& data) {
+			/// 	return static_cast<uint64_t>(data.value.guildId);
+			/// });
+			/// @endcode
+			/// @param modeNew the dispatch mode.
+			/// @param orderingKeyNew for event_dispatch_mode::ordered, maps the arguments to the key that dispatches are serialized on - for example the guild
+			/// id, so that one guild's events are handled in order while different guilds are handled in parallel. without one every dispatch shares a key.
+			inline void setDispatchMode(event_dispatch_mode modeNew, ordering_key_function orderingKeyNew = ordering_key_function{}) {
+				std::unique_lock lock{ accessMutex };
+				orderingKey = std::move(orderingKeyNew);
+				mode		= modeNew;
+				publishSnapshot();
+			}
+
+			/// @return event_dispatch_mode the current dispatch mode.
+			inline event_dispatch_mode getDispatchMode() {
+				std::unique_lock lock{ accessMutex };
+				return mode;
+			}
+
+			/// @return latency_histogram_data how long the handlers took to complete.
+			inline latency_histogram_data getHandlerLatency() const {
+				return handlerLatency.getData();
+			}
+
+			/// @return latency_histogram_data how long dispatches waited before their handlers started.
+			inline latency_histogram_data getQueueLatency() const {
+				return queueLatency.getData();
+			}
+
 			/// @brief Invoke the event with provided arguments.
+			/// the handlers are taken from an immutable snapshot, so add() and erase() never wait on a dispatch, and a handler may remove itself.
 			/// @param args the arguments to pass to the event delegates.
 			inline void operator()(const arg_types&... args) {
-				std::unique_lock lock{ accessMutex };
-				for (auto& [key, value]: functions) {
-					try {
-						value.function(args...).get();
-					} catch (const dca_exception& error) {
-						message_printer::printError<print_message_type::general>(error.what());
+				auto currentSnapshot = loadSnapshot();
+				if (currentSnapshot->handlers.size() == 0) {
+					return;
+				}
+				if (currentSnapshot->mode == event_dispatch_mode::sequential) {
+					for (auto& value: currentSnapshot->handlers) {
+						auto startTime = hrclock::now();
+						try {
+							value(args...).get();
+						} catch (...) {
+							reportHandlerException(std::current_exception());
+						}
+						handlerLatency.record(hrclock::now() - startTime);
 					}
+					return;
+				}
+				dispatch_data dispatchData{ currentSnapshot, std::tuple<arg_types...>{ args... }, hrclock::now() };
+				if (currentSnapshot->mode == event_dispatch_mode::ordered) {
+					uint64_t key{ currentSnapshot->orderingKey ? currentSnapshot->orderingKey(args...) : 0 };
+					std::unique_lock lock{ laneMutex };
+					if (auto iterator = lanes.find(key); iterator != lanes.end()) {
+						iterator->second.emplace_back(std::move(dispatchData));
+						return;
+					}
+					lanes[key];
+					lock.unlock();
+					launchDispatch(std::move(dispatchData), key, true);
+				} else {
+					launchDispatch(std::move(dispatchData), 0, false);
 				}
-				return;
 			}
 
 			~event() {
-				{
-					std::unique_lock lock{ accessMutex };
+				std::unique_lock lock{ taskMutex };
+				// an ordered lane may hand its next dispatch on to a new task while the others are joined, so this repeats until none are left.
+				while (tasks.size() > 0) {
+					auto tasksNew = std::move(tasks);
+					tasks.clear();
 					lock.unlock();
+					// the dispatches time out after 15 seconds, like co_routine::get(), so that a stalled thread pool can't hang shutdown.
+					for (auto& value: tasksNew) {
+						try {
+							value->get();
+						} catch (...) {
+							reportHandlerException(std::current_exception());
+						}
+					}
+					lock.lock();
 				}
 			}
 
 		  protected:
+			/// @brief The handlers and settings that a dispatch runs with, replaced rather than modified.
+			struct dispatch_snapshot {
+				jsonifier::vector<std::function<return_type(arg_types...)>> handlers{};
+				ordering_key_function orderingKey{};
+				event_dispatch_mode mode{};
+			};
+
+			/// @brief A single firing of the event, waiting on or running in a dispatch lane.
+			struct dispatch_data {
+				std::shared_ptr<const dispatch_snapshot> snapshot{};
+				std::tuple<arg_types...> args;
+				hrclock::time_point queuedAt{};
+			};
+
+			unordered_map<uint64_t, std::deque<dispatch_data>> lanes{};
+			std::shared_ptr<const dispatch_snapshot> snapshot{};
+			std::vector<std::shared_ptr<co_routine<void, true>>> tasks{};
+			ordering_key_function orderingKey{};
+			latency_histogram handlerLatency{};
+			latency_histogram queueLatency{};
+			event_dispatch_mode mode{};
 			std::mutex accessMutex{};
+			std::mutex laneMutex{};
+			std::mutex taskMutex{};
 			uint64_t eventId{};
+
+			/// Expects accessMutex to be held.
+			inline void publishSnapshot() {
+				auto newSnapshot = std::make_shared<dispatch_snapshot>();
+				newSnapshot->handlers.reserve(functions.size());
+				for (auto& [key, value]: functions) {
+					newSnapshot->handlers.emplace_back(value.function);
+				}
+				newSnapshot->orderingKey = orderingKey;
+				newSnapshot->mode		 = mode;
+				snapshot				 = std::move(newSnapshot);
+			}
+
+			inline std::shared_ptr<const dispatch_snapshot> loadSnapshot() {
+				std::unique_lock lock{ accessMutex };
+				return snapshot;
+			}
+
+			/// @brief Drops the completed dispatch tasks.
+			inline void reapTasks() {
+				std::unique_lock lock{ taskMutex };
+				std::erase_if(tasks, [](auto& value) {
+					return value->getStatus() != co_routine_status::running;
+				});
+			}
+
+			inline void launchDispatch(dispatch_data&& dispatchData, uint64_t key, bool ordered) {
+				auto task = std::make_shared<co_routine<void, true>>(runDispatch(std::move(dispatchData), key, ordered));
+				reapTasks();
+				std::unique_lock lock{ taskMutex };
+				tasks.emplace_back(std::move(task));
+			}
+
+			/// @brief Releases an ordered lane however its dispatch ends, so that an exception or an abandoned task can never leave the lane's key blocked.
+			struct lane_guard {
+				inline lane_guard(event* eventNew, uint64_t keyNew, bool activeNew) : eventPtr{ eventNew }, key{ keyNew }, active{ activeNew } {
+				}
+
+				inline ~lane_guard() {
+					if (active) {
+						eventPtr->releaseLane(key);
+					}
+				}
+
+				event* eventPtr{};
+				uint64_t key{};
+				bool active{};
+			};
+
+			/// Logs an exception that escaped a handler - of any type, so that one failing handler never stops the others, or its lane.
+			inline static void reportHandlerException(std::exception_ptr exception) {
+				try {
+					std::rethrow_exception(exception);
+				} catch (const std::exception& error) {
+					message_printer::printError<print_message_type::general>(error.what());
+				} catch (...) {
+					message_printer::printError<print_message_type::general>("An event handler threw an exception that isn't a std::exception.");
+				}
+			}
+
+			/// @brief Collects the next dispatch queued on an ordered lane, erasing the lane once it's empty.
+			/// @return std::optional<dispatch_data> the dispatch, or nothing if the lane was empty, and has been erased.
+			inline std::optional<dispatch_data> takeNextDispatch(uint64_t key) {
+				std::unique_lock lock{ laneMutex };
+				auto iterator = lanes.find(key);
+				if (iterator == lanes.end()) {
+					return std::nullopt;
+				} else if (iterator->second.size() == 0) {
+					lanes.erase(key);
+					return std::nullopt;
+				}
+				std::optional<dispatch_data> returnValue{ std::move(iterator->second.front()) };
+				iterator->second.pop_front();
+				return returnValue;
+			}
+
+			/// Hands an ordered lane's next dispatch on to a new task, or erases the lane if nothing is queued on it.
+			inline void releaseLane(uint64_t key) noexcept {
+				try {
+					if (auto nextDispatch = takeNextDispatch(key); nextDispatch) {
+						launchDispatch(std::move(*nextDispatch), key, true);
+					}
+				} catch (...) {
+					reportHandlerException(std::current_exception());
+					std::unique_lock lock{ laneMutex };
+					lanes.erase(key);
+				}
+			}
+
+			/// Runs a dispatch on the thread pool, and for an ordered lane keeps going until the lane is drained.
+			inline co_routine<void, true> runDispatch(dispatch_data dispatchData, uint64_t key, bool ordered) {
+				lane_guard guard{ this, key, ordered };
+				co_await newThreadAwaitable<void, true>();
+				co_await runHandlers(dispatchData);
+				while (ordered) {
+					auto nextDispatch = takeNextDispatch(key);
+					if (!nextDispatch) {
+						guard.active = false;
+						co_return;
+					}
+					dispatchData = std::move(*nextDispatch);
+					co_await runHandlers(dispatchData);
+				}
+				co_return;
+			}
+
+			/// Launches every handler before awaiting any of them, so that handlers which hop onto the thread pool overlap.
+			inline co_routine<void, false> runHandlers(dispatch_data& dispatchData) {
+				auto startTime = hrclock::now();
+				queueLatency.record(startTime - dispatchData.queuedAt);
+				std::vector<return_type> running{};
+				running.reserve(dispatchData.snapshot->handlers.size());
+				for (auto& value: dispatchData.snapshot->handlers) {
+					try {
+						running.emplace_back(std::apply(value, dispatchData.args));
+					} catch (...) {
+						reportHandlerException(std::current_exception());
+					}
+				}
+				for (auto& value: running) {
+					try {
+						co_await value;
+					} catch (...) {
+						reportHandlerException(std::current_exception());
+					}
+					handlerLatency.record(hrclock::now() - startTime);
+				}
+				co_return;
+			}
 		};
 
 		/// @brief Event-delegate, for representing an event-function to be executed conditionally.
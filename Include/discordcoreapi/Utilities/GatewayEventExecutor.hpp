@@ -0,0 +1,275 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GatewayEventExecutor.hpp - Header file for the per-guild ordered gateway event executor.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file GatewayEventExecutor.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/ThreadPlacement.hpp>
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <condition_variable>
+#include <functional>
+#include <array>
+#include <deque>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup discord_core_client
+	 * @{
+	 */
+
+	/// @brief Queue metrics of a single gateway event lane.
+	struct gateway_lane_metrics {
+		milliseconds longestWait{};///< Longest time an event waited in the lane before being processed.
+		uint64_t eventsProcessed{};///< Events that the lane has processed.
+		uint64_t peakQueueDepth{};///< Most events that have been waiting in the lane at once.
+		uint64_t queueDepth{};///< Events currently waiting in the lane.
+	};
+
+	/**@}*/
+
+	namespace discord_core_internal {
+
+		/// @brief A gateway dispatch, copied off of the websocket's buffer.
+		struct gateway_event {
+			jsonifier::string_base<uint8_t> payload{};
+			hrclock::time_point receivedAt{};
+			uint64_t eventType{};
+		};
+
+		/// @brief Processes gateway dispatches on a fixed set of ordered lanes - events that share a routing key (the guild id) land on the same lane, so
+		/// each guild's events are handled in the order they arrived while different guilds are handled in parallel.
+		class gateway_event_executor {
+		  public:
+			using processor_function = std::function<void(jsonifier::jsonifier_core<false>&, uint64_t, jsonifier::string_view_base<uint8_t>)>;
+
+			/// @brief Starts the lanes.
+			/// @param laneCount the number of lanes, and of worker threads.
+			/// @param processorNew parses and handles a single event, each lane passes it its own parser.
+			inline gateway_event_executor(uint64_t laneCount, processor_function processorNew) : processor{ std::move(processorNew) } {
+				laneCount = std::max(laneCount, uint64_t{ 1 });
+				for (uint64_t x = 0; x < laneCount; ++x) {
+					lanes.emplace_back(makeUnique<lane>());
+				}
+				for (uint64_t x = 0; x < laneCount; ++x) {
+					workers.emplace_back([this, x](std::stop_token token) {
+						runLane(*lanes[x], token);
+					});
+				}
+			}
+
+			inline gateway_event_executor& operator=(const gateway_event_executor&) = delete;
+			inline gateway_event_executor(const gateway_event_executor&)			= delete;
+
+			/// @brief Queues an event onto the lane for its routing key.
+			/// @param routingKey the key to order the event on - the guild id, or the channel id for events outside of a guild. events with a key of 0
+			/// share a lane.
+			/// @param shardId the shard that received the event, which picks the lane group - a guild's events always arrive on the guild's shard, while
+			/// direct messages arrive on whichever shard discord chose, so the shard can't be derived from the key.
+			/// @param eventNew the event to process.
+			inline void submit(uint64_t routingKey, uint64_t shardId, gateway_event&& eventNew) {
+				uint64_t mixed{ routingKey * 0x9E3779B97F4A7C15ull };
+				uint64_t groupCount{ laneGroupCount.load(std::memory_order_acquire) };
+				uint64_t lanesPerGroup{ lanes.size() / groupCount };
+				uint64_t group{ (shardId % shardCount.load(std::memory_order_acquire)) % groupCount };
+				uint64_t groupSize{ group + 1 == groupCount ? lanes.size() - group * lanesPerGroup : lanesPerGroup };
+				auto& laneNew = *lanes[group * lanesPerGroup + (mixed ^ (mixed >> 32)) % groupSize];
+				std::unique_lock lock{ laneNew.accessMutex };
+				laneNew.events.emplace_back(std::move(eventNew));
+				laneNew.metrics.peakQueueDepth = std::max(laneNew.metrics.peakQueueDepth, static_cast<uint64_t>(laneNew.events.size()));
+				lock.unlock();
+				laneNew.workCondition.notify_one();
+			}
+
+			/// @brief Splits the lanes into a group per cpu, and pins each group to its cpu - an event then picks its group by the shard that received it,
+			/// the same way that the shards are split between the websocket agents, so each agent's events are handled on the agent's own cpu. Call it before
+			/// the shards connect, as events that are already queued may be overtaken.
+			/// @param groupCpus the cpu of each websocket agent, in order - any lanes left over go to the last group.
+			/// @param shardCountNew the total number of shards.
+			inline void placeLanes(const jsonifier::vector<uint32_t>& groupCpus, uint64_t shardCountNew) {
+				uint64_t groupCount{ std::clamp(static_cast<uint64_t>(groupCpus.size()), uint64_t{ 1 }, static_cast<uint64_t>(lanes.size())) };
+				uint64_t lanesPerGroup{ lanes.size() / groupCount };
+				for (uint64_t x = 0; x < workers.size() && groupCpus.size() > 0; ++x) {
+					jsonifier::vector<uint32_t> cpu{};
+					cpu.emplace_back(groupCpus[std::min(x / lanesPerGroup, groupCount - 1)]);
+					setThreadAffinity(workers[x].native_handle(), cpu);
+				}
+				shardCount.store(std::max(shardCountNew, uint64_t{ 1 }), std::memory_order_release);
+				laneGroupCount.store(groupCount, std::memory_order_release);
+			}
+
+			/// @brief Collects the shard that a guild's events arrive on - for events that didn't arrive on a shard, such as those of the interactions
+			/// endpoint.
+			/// @param guildId the guild's id, or 0 outside of a guild - where discord sends everything to shard 0.
+			/// @return uint64_t the shard's id.
+			inline uint64_t getGuildShard(uint64_t guildId) const {
+				return (guildId >> 22) % shardCount.load(std::memory_order_acquire);
+			}
+
+			/// @return a snapshot of the metrics of each lane.
+			inline jsonifier::vector<gateway_lane_metrics> getLaneMetrics() {
+				jsonifier::vector<gateway_lane_metrics> returnData{};
+				for (auto& value: lanes) {
+					std::unique_lock lock{ value->accessMutex };
+					returnData.emplace_back(value->metrics);
+					returnData.back().queueDepth = value->events.size();
+				}
+				return returnData;
+			}
+
+			/// @brief Finds a top-level snowflake field of a dispatch's "d" object without parsing the payload, so that the event can be routed before it is
+			/// parsed.
+			/// @param payload the json text of the dispatch.
+			/// @param key the name of the field.
+			/// @return the value of the field, or 0 if it isn't present.
+			inline static uint64_t findDispatchValue(jsonifier::string_view_base<uint8_t> payload, jsonifier::string_view key) {
+				std::array<bool, 3> isObject{};
+				uint8_t previous{};
+				uint64_t depth{};
+				bool inData{};
+				for (uint64_t x = 0; x < payload.size(); ++x) {
+					switch (payload[x]) {
+						case '"': {
+							uint64_t start{ x + 1 };
+							for (++x; x < payload.size() && payload[x] != '"'; ++x) {
+								if (payload[x] == '\\') {
+									++x;
+								}
+							}
+							if ((previous == '{' || previous == ',') && depth <= 2 && isObject[depth]) {
+								jsonifier::string_view name{ reinterpret_cast<const char*>(payload.data()) + start, std::min(x, payload.size()) - start };
+								if (depth == 1) {
+									inData = name == "d";
+								} else if (depth == 2 && inData && name == key) {
+									return parseSnowflake(payload, x + 1);
+								}
+							}
+							previous = '"';
+							break;
+						}
+						case '{':
+							[[fallthrough]];
+						case '[': {
+							++depth;
+							if (depth <= 2) {
+								isObject[depth] = payload[x] == '{';
+							}
+							previous = payload[x];
+							break;
+						}
+						case '}':
+							[[fallthrough]];
+						case ']': {
+							if (depth == 2 && inData) {
+								return 0;
+							}
+							depth -= depth > 0 ? 1 : 0;
+							previous = payload[x];
+							break;
+						}
+						case ' ':
+							[[fallthrough]];
+						case '\t':
+							[[fallthrough]];
+						case '\r':
+							[[fallthrough]];
+						case '\n': {
+							break;
+						}
+						default: {
+							previous = payload[x];
+							break;
+						}
+					}
+				}
+				return 0;
+			}
+
+			inline ~gateway_event_executor() {
+				for (auto& value: workers) {
+					value.request_stop();
+				}
+				workers.clear();
+			}
+
+		  protected:
+			struct lane {
+				std::condition_variable_any workCondition{};
+				std::deque<gateway_event> events{};
+				gateway_lane_metrics metrics{};
+				std::mutex accessMutex{};
+			};
+
+			std::atomic<uint64_t> laneGroupCount{ 1 };
+			std::vector<unique_ptr<lane>> lanes{};
+			std::vector<std::jthread> workers{};
+			std::atomic<uint64_t> shardCount{ 1 };
+			processor_function processor{};
+
+			/// Reads the snowflake that follows a key, skipping the colon and the quotes around it.
+			inline static uint64_t parseSnowflake(jsonifier::string_view_base<uint8_t> payload, uint64_t index) {
+				while (index < payload.size() && (payload[index] == ':' || payload[index] == ' ' || payload[index] == '"')) {
+					++index;
+				}
+				uint64_t returnValue{};
+				while (index < payload.size() && payload[index] >= '0' && payload[index] <= '9') {
+					returnValue = returnValue * 10 + static_cast<uint64_t>(payload[index] - '0');
+					++index;
+				}
+				return returnValue;
+			}
+
+			inline void runLane(lane& laneNew, std::stop_token token) {
+				jsonifier::jsonifier_core<false> parser{};
+				while (!token.stop_requested()) {
+					std::unique_lock lock{ laneNew.accessMutex };
+					if (!laneNew.workCondition.wait(lock, token, [&] {
+							return laneNew.events.size() > 0;
+						})) {
+						return;
+					}
+					gateway_event eventNew{ std::move(laneNew.events.front()) };
+					laneNew.events.pop_front();
+					lock.unlock();
+					auto waited = std::chrono::duration_cast<milliseconds>(hrclock::now() - eventNew.receivedAt);
+					// Nothing that a handler throws may escape, or it would end the lane's thread - and with it every later event of the lane's guilds.
+					try {
+						processor(parser, eventNew.eventType, { eventNew.payload.data(), eventNew.payload.size() });
+					} catch (const std::exception& error) {
+						message_printer::printError<print_message_type::websocket>(error.what());
+					} catch (...) {
+						message_printer::printError<print_message_type::websocket>("A gateway event's handler threw an exception that isn't a std::exception.");
+					}
+					lock.lock();
+					laneNew.metrics.longestWait = std::max(laneNew.metrics.longestWait, waited);
+					++laneNew.metrics.eventsProcessed;
+				}
+			}
+		};
+	}
+}
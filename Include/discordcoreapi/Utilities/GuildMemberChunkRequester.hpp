@@ -0,0 +1,106 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GuildMemberChunkRequester.hpp - Header file for requesting guild members over the gateway.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file GuildMemberChunkRequester.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/CollectorRegistry.hpp>
+#include <discordcoreapi/GuildMemberEntities.hpp>
+#include <deque>
+#include <mutex>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		/// @brief Queues request guild members commands on their guilds' shards, for the shards' agents to send within a budget of the gateway's rate limit,
+		/// and follows each request's chunks by its nonce - handing the request's result to its collector channel once the last chunk is in.
+		class DiscordCoreAPI_Dll guild_member_chunk_requester {
+		  public:
+			/// @brief Half of the gateway's 120 commands per minute, leaving the rest of each shard's budget to heartbeats, presence and voice updates.
+			static constexpr uint64_t requestsPerWindow{ 60 };
+			static constexpr milliseconds requestWindow{ 60000 };
+
+			guild_member_chunk_requester() = default;
+
+			guild_member_chunk_requester& operator=(const guild_member_chunk_requester&) = delete;
+			guild_member_chunk_requester(const guild_member_chunk_requester&)			 = delete;
+
+			/// @brief Queues a request on its shard.
+			/// @param dataPackage the request.
+			/// @param shardId the shard of the request's guild.
+			/// @param nonce set to the request's nonce, for cancel().
+			/// @return collector_channel_ptr<request_guild_members_result> the channel that the request's result is sent to.
+			collector_channel_ptr<request_guild_members_result> submit(const request_guild_members_data& dataPackage, uint64_t shardId, jsonifier::string& nonce);
+
+			/// @brief Takes a shard's next queued request, if the shard has any budget left for it.
+			/// @param shardId the shard.
+			/// @param payload set to the request's payload.
+			/// @return true if there's a request to send.
+			bool tryPop(uint64_t shardId, request_guild_members_payload& payload);
+
+			/// @brief Puts back a request that tryPop() handed out but that couldn't be sent, along with the budget that it took.
+			/// @param shardId the shard.
+			/// @param payload the request's payload.
+			void requeueFront(uint64_t shardId, request_guild_members_payload&& payload);
+
+			/// @brief Counts a chunk against its request, completing the request on its last chunk - chunks with nonces that aren't ours are ignored.
+			/// @param chunk the chunk, whose members have been cached already.
+			void onChunk(const guild_members_chunk_event_data& chunk);
+
+			/// @brief Forgets a request that's no longer being waited on, dropping it from its shard's queue if it hasn't been sent yet.
+			/// @param nonce the request's nonce.
+			/// @param result set to the request's progress so far.
+			/// @return false if the request was completed first.
+			bool cancel(jsonifier::string_view nonce, request_guild_members_result& result);
+
+		  protected:
+			struct pending_request {
+				collector_channel_ptr<request_guild_members_result> channel{};
+				request_guild_members_result result{};
+			};
+
+			struct shard_queue {
+				std::deque<request_guild_members_payload> requests{};
+				std::deque<hrclock::time_point> sendTimes{};
+			};
+
+			unordered_map<jsonifier::string, pending_request> pendingRequests{};
+			unordered_map<uint64_t, shard_queue> shardQueues{};
+			std::mutex accessMutex{};
+			uint64_t nextNonce{};
+		};
+
+		/**@}*/
+	}
+}
@@ -185,6 +185,12 @@ namespace discord_core_api {
 		}
 	};
 
+	template<jsonifier::concepts::integer_t value_type> struct key_accessor<value_type> {
+		inline static uint64_t getHashKey(const value_type& other) {
+			return key_hasher<value_type>::getHashKey(other);
+		}
+	};
+
 	template<> struct key_accessor<two_id_key> {
 		inline static uint64_t getHashKey(const two_id_key& other) {
 			return key_hasher<two_id_key>::getHashKey(other);
@@ -0,0 +1,298 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// Http2Client.hpp - Header file for the http/2 rest transport.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file Http2Client.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <semaphore>
+#include <memory>
+#include <deque>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		struct hpack_header {
+			jsonifier::string value{};
+			jsonifier::string name{};
+		};
+
+		/// @brief The hpack header table - the static table, followed by the dynamic table that each end of a connection builds from the headers it
+		/// sends (rfc 7541).
+		class DiscordCoreAPI_Dll hpack_table {
+		  public:
+			static constexpr uint64_t staticTableSize{ 61 };
+			static constexpr uint64_t defaultMaxSize{ 4096 };
+			static constexpr uint64_t entryOverhead{ 32 };
+
+			/// @brief Collects an entry by its index, which counts from the start of the static table.
+			/// @param index the entry's index.
+			/// @param name set to the entry's name.
+			/// @param value set to the entry's value.
+			/// @return false if there's no entry at the index.
+			bool get(uint64_t index, jsonifier::string_view& name, jsonifier::string_view& value) const;
+
+			/// @brief Searches for an entry.
+			/// @param name the entry's name.
+			/// @param value the entry's value.
+			/// @param nameOnly set to true if only the name matched.
+			/// @return uint64_t the entry's index, or 0 if no entry has the name.
+			uint64_t find(jsonifier::string_view name, jsonifier::string_view value, bool& nameOnly) const;
+
+			void insert(jsonifier::string_view name, jsonifier::string_view value);
+
+			void setMaxSize(uint64_t maxSizeNew);
+
+			uint64_t getMaxSize() const;
+
+		  protected:
+			std::deque<hpack_header> entries{};
+			uint64_t maxSize{ defaultMaxSize };
+			uint64_t currentSize{};
+
+			/// Evicts the oldest entries until there's room for one of the given size.
+			void evict(uint64_t incomingSize);
+		};
+
+		/// @brief Encodes header blocks. Headers that repeat from request to request are added to the dynamic table, so that after the first request
+		/// they cost a byte or two each.
+		class DiscordCoreAPI_Dll hpack_encoder {
+		  public:
+			/// @brief Starts a header block, signalling any change to the table's size that the peer asked for.
+			/// @param output the block to encode into.
+			void beginBlock(jsonifier::string& output);
+
+			/// @brief Encodes a header.
+			/// @param output the block to encode into.
+			/// @param name the header's name, in lower case.
+			/// @param value the header's value.
+			/// @param indexable whether to add the header to the dynamic table.
+			void encode(jsonifier::string& output, jsonifier::string_view name, jsonifier::string_view value, bool indexable);
+
+			/// @brief Applies the peer's SETTINGS_HEADER_TABLE_SIZE - the table never grows past the default size, but shrinks if asked to.
+			/// @param maxSizeNew the peer's limit.
+			void setMaxSize(uint64_t maxSizeNew);
+
+		  protected:
+			bool sizeUpdatePending{};
+			hpack_table table{};
+		};
+
+		/// @brief Decodes header blocks, including huffman-coded strings and dynamic table size updates.
+		class DiscordCoreAPI_Dll hpack_decoder {
+		  public:
+			/// @brief Decodes a complete header block.
+			/// @param block the block, after any CONTINUATION frames have been joined to it.
+			/// @param headers the headers to add the decoded ones to.
+			/// @return false if the block is malformed, which is an error on the whole connection.
+			bool decode(jsonifier::string_view block, jsonifier::vector<hpack_header>& headers);
+
+		  protected:
+			hpack_table table{};
+		};
+
+		enum class http2_frame_type : uint8_t {
+			Data		  = 0,
+			Headers		  = 1,
+			Priority	  = 2,
+			Rst_Stream	  = 3,
+			Settings	  = 4,
+			Push_Promise  = 5,
+			Ping		  = 6,
+			Goaway		  = 7,
+			Window_Update = 8,
+			Continuation  = 9
+		};
+
+		/// @brief Where a stream is, as far as whether the server could have acted on it.
+		enum class http2_stream_state : uint8_t {
+			Queued	  = 0,///< Waiting for a session to open it - nothing has been written.
+			Opened	  = 1,///< Its headers have been written, so the server may have acted on it.
+			Refused	  = 2,///< The server said that it never processed it - REFUSED_STREAM, or past GOAWAY's last stream id.
+			Abandoned = 3,///< Taken back by the caller before it was opened.
+		};
+
+		/// @brief How a request submitted over http/2 ended.
+		enum class http2_submit_result : uint8_t {
+			Completed = 0,///< The response arrived.
+			Not_Sent  = 1,///< The server provably never acted on the request - it's safe to send it again, over http/1.1.
+			Failed	  = 2,///< The request may have been acted on, but no response arrived - it mustn't be sent again.
+		};
+
+		/// @brief A request in flight on an http/2 connection, and its response.
+		struct http2_stream {
+			jsonifier::vector<hpack_header> headers{};///< The request's headers, pseudo-headers first.
+			std::atomic<http2_stream_state> state{};///< Moved out of Queued by whichever of the session and the caller gets there first.
+			std::binary_semaphore completed{ 0 };///< Released once the response has ended, or the stream has failed.
+			https_response_data response{};
+			uint64_t receivedSinceUpdate{};
+			jsonifier::string content{};
+			uint64_t contentOffset{};
+			int64_t sendWindow{};
+			uint32_t id{};
+		};
+
+		/// @brief An http/2 connection - frames, flow control and header compression, for many streams at once. Only the owning session's worker thread
+		/// touches it.
+		class DiscordCoreAPI_Dll http2_connection : public tcp_connection<http2_connection> {
+		  public:
+			static constexpr uint64_t receiveWindowSize{ 1ull << 24 };
+			static constexpr uint64_t defaultWindowSize{ 65535 };
+			static constexpr uint64_t defaultFrameSize{ 16384 };
+
+			http2_connection() = default;
+
+			http2_connection(const jsonifier::string& baseUrlNew, const uint16_t portNew);
+
+			/// @return true if the server agreed to speak http/2, during the tls handshake.
+			bool isHttp2();
+
+			/// @return true if another stream can be opened, within the server's limit on concurrent streams.
+			bool canOpenStream();
+
+			/// @brief Sends a stream's headers, and queues its body.
+			/// @param stream the stream to open.
+			void openStream(std::shared_ptr<http2_stream> stream);
+
+			/// @brief Moves queued frames into the output buffer, sending as much of each stream's body as flow control allows.
+			void flushOutgoing();
+
+			/// @return true once the connection can't carry any more streams - the server has sent GOAWAY, or the connection broke the protocol.
+			bool isFinished();
+
+			uint64_t getStreamCount();
+
+			/// @brief Fails every stream that's still open, as the connection goes away.
+			void failStreams();
+
+			void handleBuffer() override;
+
+			virtual ~http2_connection() = default;
+
+		  protected:
+			unordered_map<uint32_t, std::shared_ptr<http2_stream>> streams{};
+			std::deque<uint32_t> sendingStreams{};
+			int64_t peerInitialWindowSize{ defaultWindowSize };
+			int64_t connectionSendWindow{ defaultWindowSize };
+			uint64_t peerMaxConcurrentStreams{ 100 };
+			uint64_t peerMaxFrameSize{ defaultFrameSize };
+			jsonifier::string inputBufferReal{};
+			uint64_t connectionReceivedSinceUpdate{};
+			jsonifier::string headerBlock{};
+			jsonifier::string outgoing{};
+			uint64_t outgoingOffset{};
+			hpack_encoder encoder{};
+			hpack_decoder decoder{};
+			uint32_t nextStreamId{ 1 };
+			uint32_t headerStreamId{};
+			bool headerBlockEnds{};
+			bool protocolError{};
+			bool goingAway{};
+
+			void writeFrame(http2_frame_type type, uint8_t flags, uint32_t streamId, jsonifier::string_view payload);
+
+			bool processFrame(http2_frame_type type, uint8_t flags, uint32_t streamId, jsonifier::string_view payload);
+
+			bool processHeaderBlock(uint32_t streamId, bool endsStream);
+
+			bool processSettings(uint8_t flags, jsonifier::string_view payload);
+
+			void completeStream(uint32_t streamId, bool ended);
+
+			void failConnection(uint32_t errorCode);
+		};
+
+		class http2_client;
+
+		/// @brief One of the client's connections, with the worker thread that drives it - reconnecting whenever there's work and no connection.
+		class DiscordCoreAPI_Dll http2_session {
+		  public:
+			/// @param clientNew the client that the session belongs to.
+			/// @param cpus the cpus to pin the session's worker to - empty to leave it unpinned.
+			http2_session(http2_client& clientNew, const jsonifier::vector<uint32_t>& cpus);
+
+			http2_session& operator=(const http2_session&) = delete;
+			http2_session(const http2_session&)			   = delete;
+
+			void submit(std::shared_ptr<http2_stream> stream);
+
+			~http2_session();
+
+		  protected:
+			std::deque<std::shared_ptr<http2_stream>> pending{};
+			unique_ptr<http2_connection> connection{};
+			std::condition_variable_any workCondition{};
+			http2_client* client{};
+			std::mutex accessMutex{};
+			std::jthread worker{};
+
+			void run(std::stop_token token);
+
+			void failPending();
+		};
+
+		/// @brief Sends rest requests to discord over a few http/2 connections, each carrying many requests at once as concurrent streams - rather than
+		/// one http/1.1 connection per route, with one request in flight on each.
+		class DiscordCoreAPI_Dll http2_client {
+		  public:
+			friend class http2_session;
+
+			static constexpr milliseconds responseTimeout{ 10000 };
+
+			/// @brief Starts the client's sessions - connections are only made once there are requests to send.
+			/// @param botTokenNew the bot's token.
+			/// @param connectionCount the number of connections to share the requests between.
+			/// @param cpus the cpus to pin the sessions' workers to - empty to leave them unpinned.
+			http2_client(jsonifier::string_view botTokenNew, uint64_t connectionCount, const jsonifier::vector<uint32_t>& cpus);
+
+			http2_client& operator=(const http2_client&) = delete;
+			http2_client(const http2_client&)			 = delete;
+
+			/// @brief Sends a request to discord, and waits for its response.
+			/// @param workload the request.
+			/// @param response the response data to fill in.
+			/// @return Not_Sent if the server never acted on the request, in which case it's to be sent over http/1.1 instead - or Failed if it may
+			/// have, in which case it mustn't be sent again.
+			http2_submit_result submit(const https_workload_data& workload, https_response_data& response);
+
+		  protected:
+			std::vector<unique_ptr<http2_session>> sessions{};
+			std::atomic<uint64_t> nextSession{};
+			std::atomic<bool> unsupported{};
+			jsonifier::string authorization{};
+		};
+
+		/**@}*/
+	}
+}
@@ -30,9 +30,32 @@
 #pragma once
 
 #include <discordcoreapi/Utilities/RateLimitQueue.hpp>
+#include <discordcoreapi/Utilities/ThreadPlacement.hpp>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
 
 namespace discord_core_api {
 
+	/**
+	 * \addtogroup discord_core_client
+	 * @{
+	 */
+
+	/// @brief Latency metrics of the interaction response lane, measured from an interaction's arrival on the gateway to discord's acknowledgement of
+	/// its callback.
+	struct interaction_response_metrics {
+		milliseconds averageLatency{};///< Average time from gateway receipt to acknowledgement.
+		milliseconds longestLatency{};///< Longest time from gateway receipt to acknowledgement.
+		uint64_t missedDeadlines{};///< Callbacks acknowledged after the three-second deadline.
+		uint64_t responsesSent{};///< Callbacks sent on the lane.
+		uint64_t nearMisses{};///< Callbacks acknowledged inside the deadline, but past the warning threshold.
+		uint64_t unanswered{};///< Interactions that were never responded to.
+		uint64_t untracked{};///< Callbacks for interactions whose gateway receipt wasn't recorded.
+	};
+
+	/**@}*/
+
 	namespace discord_core_internal {
 
 		/// \brief Voice websocket close codes.
@@ -102,14 +125,52 @@ namespace discord_core_api {
 			inline https_error(const jsonifier::string_view& message, std::source_location location = std::source_location::current()) : dca_exception{ message, location } {};
 		};
 
+		/// @brief The headers of a response - kept as offsets into the response's header block, so that no header's name or value is copied out on its
+		/// own.
+		class DiscordCoreAPI_Dll https_response_headers {
+		  public:
+			friend class https_rnr_builder;
+			friend class http2_connection;
+
+			/// @brief Checks for a header, ignoring the case of its name.
+			/// @param name the header's name.
+			/// @return true if the header is present.
+			bool contains(jsonifier::string_view name) const;
+
+			/// @brief Collects a header's value, ignoring the case of its name.
+			/// @param name the header's name.
+			/// @return jsonifier::string_view a view of the value, which stays valid for as long as the headers do - or an empty view if the header
+			/// isn't present.
+			jsonifier::string_view at(jsonifier::string_view name) const;
+
+			/// @return uint64_t the number of headers.
+			uint64_t size() const;
+
+		  protected:
+			struct header_entry {
+				uint32_t valueOffset{};
+				uint32_t valueLength{};
+				uint32_t nameOffset{};
+				uint32_t nameLength{};
+			};
+
+			jsonifier::vector<header_entry> entries{};
+			jsonifier::string block{};
+
+			const header_entry* find(jsonifier::string_view name) const;
+
+			/// Appends a header that arrived already split from its name, as over http/2.
+			void emplace(jsonifier::string_view name, jsonifier::string_view value);
+		};
+
 		struct DiscordCoreAPI_Dll https_response_data {
 			friend class https_rnr_builder;
 			friend class https_connection;
 			friend class https_client;
 
 			https_response_code responseCode{ std::numeric_limits<uint32_t>::max() };
-			unordered_map<jsonifier::string, jsonifier::string> responseHeaders{};
 			https_state currentState{ https_state::Collecting_Headers };
+			https_response_headers responseHeaders{};
 			jsonifier::string responseData{};
 			uint64_t contentLength{};
 
@@ -125,18 +186,47 @@ namespace discord_core_api {
 
 			https_response_data finalizeReturnValues(rate_limit_data& rateLimitData);
 
-			jsonifier::string buildRequest(const https_workload_data& workload);
+			/// @brief Serializes the connection's workload and writes it, in a single pass - straight into the connection's output buffer when it fits.
+			/// @param clientHeaders the client's own headers, which are sent with every request to discord.
+			void writeRequest(jsonifier::string_view clientHeaders);
 
 			void updateRateLimitData(rate_limit_data& rateLimitData);
 
-			bool parseHeaders();
+			/// @brief Parses as much of the received response as has arrived, picking up where the last call left off - the body, or each chunk of
+			/// it, is decoded into the response's data as its bytes arrive.
+			void parseResponse();
+
+			/// @brief Completes a response whose body runs until the connection closes, once it has closed.
+			/// @return true if the response was one whose body runs until the connection closes.
+			bool finishOnClose();
 
 			virtual ~https_rnr_builder() = default;
 
 		  protected:
+			enum class chunk_state { Size = 0, Data = 1, Data_End = 2, Trailers = 3 };
+
+			https_workload_class templateClass{};
+			jsonifier::string templateBaseUrl{};
+			jsonifier::string requestHeaders{};
+			jsonifier::string requestBuffer{};
+			jsonifier::string requestPrefix{};
+			chunk_state chunkState{ chunk_state::Size };
+			uint64_t headerScanOffset{};
+			uint64_t parseOffset{};
+			uint64_t remaining{};
+			bool readUntilClose{};
+
+			void resetParser();
+
+			bool parseHeaders();
+
 			bool parseContents();
 
 			bool parseChunk();
+
+			bool parseHeaderBlock(jsonifier::string_view headerBlock);
+
+			void buildRequestTemplate(jsonifier::string_view clientHeaders);
 		};
 
 		class DiscordCoreAPI_Dll https_connection : public https_rnr_builder, public tcp_connection<https_connection> {
@@ -199,8 +289,14 @@ namespace discord_core_api {
 			https_connection* connection{};
 		};
 
+		class http2_client;
+
 		class DiscordCoreAPI_Dll https_client_core {
 		  public:
+			friend class interaction_response_lane;
+
+			static constexpr jsonifier::string_view userAgent{ "DiscordCoreAPI (https://discordcoreapi.com/1.0)" };
+
 			https_client_core(jsonifier::string_view botTokenNew);
 
 			inline https_response_data submitWorkloadAndGetResult(https_workload_data&& workloadNew) {
@@ -231,6 +327,8 @@ namespace discord_core_api {
 			}
 
 		  protected:
+			std::atomic<http2_client*> http2Transport{};
+			jsonifier::string clientHeaders{};
 			jsonifier::string botToken{};
 
 			https_response_data httpsRequestInternal(https_connection& connection);
@@ -240,6 +338,144 @@ namespace discord_core_api {
 			https_response_data getResponse(https_connection& connection);
 		};
 
+		class interaction_response_lane;
+
+		/// @brief The awaitable returned by interaction_response_lane::submit() - the awaiting co_routine is resumed on the co_routine thread pool once
+		/// discord has acknowledged the callback, so no pool thread is held for the round trip.
+		class DiscordCoreAPI_Dll interaction_response_awaiter {
+		  public:
+			friend class interaction_response_lane;
+
+			interaction_response_awaiter(interaction_response_lane& laneNew, https_workload_data&& workloadNew, snowflake interactionIdNew);
+
+			inline bool await_ready() const {
+				return false;
+			}
+
+			void await_suspend(std::coroutine_handle<> coroHandleNew);
+
+			https_response_data await_resume();
+
+			/// @return const https_workload_data& the callback's request.
+			inline const https_workload_data& getWorkload() const {
+				return workload;
+			}
+
+		  protected:
+			std::coroutine_handle<> waiter{};
+			interaction_response_lane* lane{};
+			https_workload_data workload{};
+			std::exception_ptr exception{};
+			https_response_data response{};
+			snowflake interactionId{};
+		};
+
+		/// @brief Where the first callback to an interaction that arrived on the http endpoint is handed over, to be written back as the http response
+		/// instead of being posted.
+		struct inline_interaction_reply {
+			interaction_response_awaiter* response{};
+			std::condition_variable condition{};
+		};
+
+		/// @brief Sends interaction callbacks on their own reserved connections and worker threads, ahead of and apart from the rest of the rest traffic -
+		/// discord drops an interaction that isn't acknowledged within three seconds of being sent.
+		class DiscordCoreAPI_Dll interaction_response_lane {
+		  public:
+			static constexpr milliseconds warningThreshold{ 2500 };
+			static constexpr milliseconds responseDeadline{ 3000 };
+			static constexpr milliseconds tokenLifetime{ 900000 };
+
+			/// @brief Starts the lane's workers, each with its own connection.
+			/// @param clientNew the client to send the callbacks with.
+			/// @param connectionCount the number of reserved connections.
+			/// @param cpus the cpus to pin the workers to - empty to leave them unpinned.
+			interaction_response_lane(https_client_core& clientNew, uint64_t connectionCount, const jsonifier::vector<uint32_t>& cpus);
+
+			interaction_response_lane& operator=(const interaction_response_lane&) = delete;
+			interaction_response_lane(const interaction_response_lane&)			   = delete;
+
+			/// @brief Records when an interaction arrived on the gateway, and warns if it's still unacknowledged as its deadline nears.
+			/// @param interactionId the id of the interaction.
+			/// @param receivedAt when its dispatch was read off of the websocket.
+			void recordReceipt(snowflake interactionId, hrclock::time_point receivedAt);
+
+			/// @brief Queues an interaction callback - co_await lane.submit(...).
+			/// @param workload the callback's request.
+			/// @param interactionId the id of the interaction being responded to.
+			/// @return interaction_response_awaiter an awaitable for the response.
+			interaction_response_awaiter submit(https_workload_data&& workload, snowflake interactionId);
+
+			/// @brief Holds back the first callback to an interaction that arrived on the http endpoint, for waitForInlineReply().
+			/// @param interactionId the id of the interaction.
+			/// @param reply where to hand the callback over.
+			void registerInlineReply(snowflake interactionId, inline_interaction_reply& reply);
+
+			/// @brief Waits for the callback held back by registerInlineReply(), and stops holding callbacks back for the interaction.
+			/// @param interactionId the id of the interaction.
+			/// @param reply the reply that was registered.
+			/// @param timeout how long to wait for the callback.
+			/// @return interaction_response_awaiter* the callback, or nullptr if none arrived in time.
+			interaction_response_awaiter* waitForInlineReply(snowflake interactionId, inline_interaction_reply& reply, milliseconds timeout);
+
+			/// @brief Resumes a callback that was handed over by waitForInlineReply() - or posts it as usual, if it couldn't be written back.
+			/// @param response the callback.
+			/// @param sent whether it was written back as the http response.
+			void completeInlineReply(interaction_response_awaiter* response, bool sent);
+
+			/// @brief Records that the endpoint deferred an interaction, because no callback arrived in time - a message callback to it would now be
+			/// rejected, and has to be sent as an edit of the deferred response instead.
+			/// @param interactionId the id of the interaction.
+			void recordDeferral(snowflake interactionId);
+
+			/// @brief Checks for, and forgets, a deferral recorded by recordDeferral().
+			/// @param interactionId the id of the interaction.
+			/// @return true if the endpoint deferred the interaction.
+			bool takeDeferral(snowflake interactionId);
+
+			/// @return interaction_response_metrics a snapshot of the lane's latency metrics.
+			interaction_response_metrics getMetrics();
+
+			/// @brief Stops the lane's workers, and waits for them to finish - so that nothing they use is torn down underneath them. Callbacks that are
+			/// still queued, or submitted afterwards, fail with an https_error.
+			void stop();
+
+			~interaction_response_lane();
+
+		  protected:
+			friend class interaction_response_awaiter;
+
+			struct receipt_data {
+				hrclock::time_point receivedAt{};
+				uint64_t timerId{};
+			};
+
+			unordered_map<snowflake, inline_interaction_reply*> inlineReplies{};
+			std::deque<interaction_response_awaiter*> responses{};
+			unordered_map<snowflake, receipt_data> receipts{};
+			unordered_map<snowflake, uint64_t> deferrals{};
+			std::condition_variable_any workCondition{};
+			interaction_response_metrics metrics{};
+			milliseconds totalLatency{};
+			https_client_core* client{};
+			std::mutex accessMutex{};
+			std::vector<std::jthread> workers{};
+			bool stopped{};
+
+			void enqueue(interaction_response_awaiter* response);
+
+			void failResponse(interaction_response_awaiter* response);
+
+			void expireReceipt(snowflake interactionId);
+
+			bool takeReceipt(snowflake interactionId, hrclock::time_point& receivedAt, uint64_t& timerId);
+
+			void warnIfUnacknowledged(snowflake interactionId);
+
+			void recordLatency(bool tracked, hrclock::time_point receivedAt);
+
+			void run(std::stop_token token);
+		};
+
 		/**
 		 * \addtogroup discord_core_internal
 		 * @{
@@ -249,7 +485,12 @@ namespace discord_core_api {
 		/// @brief For sending Https requests.
 		class DiscordCoreAPI_Dll https_client : public https_client_core {
 		  public:
-			https_client(jsonifier::string_view botTokenNew);
+			/// @brief Constructor.
+			/// @param botTokenNew the bot's token.
+			/// @param http2ConnectionCount the number of http/2 connections for requests to discord to share - 0 to send them over http/1.1, on a
+			/// connection per route.
+			/// @param cpus the cpus to pin the client's threads to - empty to leave them unpinned.
+			https_client(jsonifier::string_view botTokenNew, uint64_t http2ConnectionCount, const jsonifier::vector<uint32_t>& cpus);
 
 			template<typename value_type, typename string_type> void getParseErrors(jsonifier::jsonifier_core<false>& parser, value_type& value, string_type& stringNew) {
 				parser.parseJson<true>(value, parser.minify(parser.prettify(stringNew)));
@@ -260,6 +501,15 @@ namespace discord_core_api {
 				}
 			}
 
+			/// @brief Sends an interaction callback on the interaction response lane.
+			/// @param workload the callback's request.
+			/// @param interactionId the id of the interaction being responded to.
+			/// @return interaction_response_awaiter an awaitable for the response.
+			interaction_response_awaiter submitInteractionResponse(https_workload_data&& workload, snowflake interactionId);
+
+			/// @return interaction_response_lane& the lane that interaction callbacks are sent on.
+			interaction_response_lane& getInteractionResponseLane();
+
 			template<typename workload_type, typename... args> void submitWorkloadAndGetResult(workload_type&& workload, args&... argsNew) {
 				https_connection_stack_holder stackHolder{ connectionManager, std::move(workload) };
 				https_response_data returnData = httpsRequest(stackHolder.getConnection());
@@ -293,7 +543,11 @@ namespace discord_core_api {
 				}
 			}
 
+			~https_client();
+
 		  protected:
+			unique_ptr<http2_client> http2Client{};///< Declared first, so that it outlives everything that sends requests with it.
+			interaction_response_lane interactionResponseLane;
 			https_connection_manager connectionManager{};
 			rate_limit_queue rateLimitQueue{};
 
@@ -0,0 +1,128 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// InteractionEndpoint.hpp - Header file for the http interactions endpoint.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file InteractionEndpoint.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/GatewayEventExecutor.hpp>
+#include <discordcoreapi/Utilities/TCPConnection.hpp>
+#include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <condition_variable>
+#include <deque>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		/// @brief A request read off of one of the endpoint's connections.
+		struct interaction_endpoint_request {
+			jsonifier::string signatureTimestamp{};
+			jsonifier::string signature{};
+			jsonifier::string method{};
+			jsonifier::string body{};
+			bool keepAlive{ true };
+		};
+
+		/// @brief Receives interactions over http, at the application's interactions endpoint url - each request's ed25519 signature is checked against the
+		/// application's public key, pings are answered on the spot, and everything else is handed to the gateway event lanes just as if it had arrived on
+		/// the gateway. The request is held open until the interaction's first callback, which is written back as the http response instead of being posted.
+		/// The endpoint speaks plain http, so tls is expected to be terminated in front of it.
+		/// Connections are multiplexed: a single poller watches every idle keep-alive connection, and hands one to a worker only once a request has
+		/// started arriving on it. The worker serves that one request and then hands the connection back, so an idle connection never holds a worker.
+		/// A worker does stay with a request while its interaction is held open, for up to interaction_response_lane::warningThreshold - so at most
+		/// workerCount interactions are in flight at once, and the rest wait for a worker. Size workerCount for the expected burst of interactions.
+		class DiscordCoreAPI_Dll interaction_endpoint {
+		  public:
+			static constexpr milliseconds idleTimeout{ 10000 };
+			static constexpr uint64_t maxRequestSize{ 1024 * 1024 };
+			static constexpr seconds maxTimestampSkew{ 300 };
+
+			/// @brief Starts listening, and starts the endpoint's workers.
+			/// @param optionsNew the endpoint's options.
+			/// @param workerCount the number of threads that requests are handled on - and so the number of interactions that can be held open at once.
+			/// @param laneNew the lane that the interactions' callbacks arrive on.
+			/// @param executorNew the lanes that the interactions are processed on.
+			interaction_endpoint(const interaction_endpoint_options& optionsNew, uint64_t workerCount, interaction_response_lane& laneNew,
+				gateway_event_executor& executorNew);
+
+			interaction_endpoint& operator=(const interaction_endpoint&) = delete;
+			interaction_endpoint(const interaction_endpoint&)			 = delete;
+
+			/// @return true if the endpoint is listening.
+			bool isListening();
+
+			~interaction_endpoint();
+
+		  protected:
+			/// @brief A connection, along with whatever has been read off of it past the last request.
+			struct endpoint_connection {
+				hrclock::time_point idleSince{};
+				jsonifier::string buffer{};
+				socket_wrapper socket{};
+			};
+
+			std::deque<endpoint_connection> returnedConnections{};
+			std::deque<endpoint_connection> pendingConnections{};
+			std::array<uint8_t, 32> publicKey{};
+			std::condition_variable_any workCondition{};
+			gateway_event_executor* executor{};
+			interaction_response_lane* lane{};
+			std::vector<std::jthread> workers{};
+			socket_wrapper wakeReceiver{};
+			std::mutex accessMutex{};
+			socket_wrapper wakeSender{};
+			socket_wrapper listener{};
+			std::jthread poller{};
+
+			bool startListening(const interaction_endpoint_options& options);
+
+			bool startWaking();
+
+			void pollConnections(std::stop_token token);
+
+			void runWorker(std::stop_token token);
+
+			bool readRequest(SOCKET socket, jsonifier::string& buffer, interaction_endpoint_request& request, std::stop_token token);
+
+			bool handleRequest(SOCKET socket, interaction_endpoint_request& request);
+
+			bool verifySignature(const interaction_endpoint_request& request) const;
+
+			bool isTimestampFresh(const interaction_endpoint_request& request) const;
+
+			bool sendResponse(SOCKET socket, jsonifier::string_view status, jsonifier::string_view contentType, jsonifier::string_view body, bool keepAlive);
+		};
+
+		/**@}*/
+	}
+}
@@ -74,6 +74,25 @@ namespace discord_core_api {
 			return cacheMap.emplace(makeUnique<std::remove_cvref_t<mapped_type_new>>(std::forward<mapped_type_new>(object)));
 		}
 
+		/// @brief Add a batch of objects to the cache, under a single lock - the objects are built before the lock is taken.
+		/// @tparam range_type the type of the range of values.
+		/// @tparam projection_type the type of the projection.
+		/// @param objects the values to build the objects from.
+		/// @param projection picks the part of each value that its object is built from.
+		template<typename range_type, typename projection_type> inline void emplaceRange(range_type&& objects, projection_type&& projection) {
+			std::vector<unique_ptr<mapped_type>> newObjects{};
+			newObjects.reserve(objects.size());
+			for (auto& value: objects) {
+				newObjects.emplace_back(makeUnique<mapped_type>(projection(value)));
+			}
+			std::unique_lock lock(cacheMutex);
+			// Growing once for the whole batch saves rehashing the cache several times over as a chunk lands.
+			cacheMap.reserve(cacheMap.size() + newObjects.size());
+			for (auto& value: newObjects) {
+				cacheMap.emplace(std::move(value));
+			}
+		}
+
 		/// @brief Access an object in the cache using a key.
 		/// @tparam mapped_type_new the type of the key used for access.
 		/// @param key the key used for accessing the object in the cache.
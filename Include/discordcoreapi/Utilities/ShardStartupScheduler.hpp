@@ -0,0 +1,212 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ShardStartupScheduler.hpp - Header file for the shard startup scheduler.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file ShardStartupScheduler.hpp
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <deque>
+#include <mutex>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup discord_core_client
+	 * @{
+	 */
+
+	/// @brief The shards' progress through startup.
+	struct shard_startup_progress {
+		milliseconds elapsedTime{};///< Time since the first shard was released to connect.
+		uint64_t connectingShards{};///< Shards that have been released to identify, but haven't received their ready event yet.
+		uint64_t queuedShards{};///< Shards still waiting for their identify bucket.
+		uint64_t readyShards{};///< Shards that have received their ready event.
+		uint64_t totalShards{};///< Shards being started by this process.
+	};
+
+	/**@}*/
+
+	namespace discord_core_internal {
+
+		/// @brief Releases shards to identify in the buckets that the gateway enforces - shard_id % max_concurrency - one shard per bucket every five
+		/// seconds, with every bucket running in parallel.
+		class shard_startup_scheduler {
+		  public:
+			static constexpr milliseconds identifyInterval{ 5000 };
+			static constexpr milliseconds reconnectBackoff{ 1000 };
+
+			/// @brief Queues the shards, in order, on their buckets.
+			/// @param shardIds the shards being started by this process.
+			/// @param maxConcurrencyNew the session start limit's max_concurrency.
+			/// @param remoteAcquireNew also has to agree before a shard identifies, when the buckets are shared with other processes.
+			inline shard_startup_scheduler(const jsonifier::vector<uint64_t>& shardIds, uint64_t maxConcurrencyNew, std::function<bool(uint64_t)> remoteAcquireNew = {})
+				: remoteAcquire{ std::move(remoteAcquireNew) } {
+				maxConcurrency = std::max(maxConcurrencyNew, uint64_t{ 1 });
+				buckets.resize(maxConcurrency);
+				for (auto& value: shardIds) {
+					buckets[value % maxConcurrency].queuedShards.emplace_back(value);
+					shardStates.emplace(value, shard_state::queued);
+				}
+				for (auto& value: buckets) {
+					std::sort(value.queuedShards.begin(), value.queuedShards.end());
+				}
+				startTime = hrclock::now();
+			}
+
+			inline shard_startup_scheduler& operator=(const shard_startup_scheduler&) = delete;
+			inline shard_startup_scheduler(const shard_startup_scheduler&)			  = delete;
+
+			/// @brief Claims the shard's bucket, if it's the shard's turn and the bucket's interval has passed - shards that are still queued go in order,
+			/// while a shard that's reconnecting only has to wait for the interval.
+			/// @param shardId the shard to identify.
+			/// @param resuming whether the shard is resuming its session instead - resumes don't count against the buckets, so they go right away.
+			/// @return true if the shard may connect now.
+			inline bool tryAcquire(uint64_t shardId, bool resuming = false) {
+				std::unique_lock lock{ accessMutex };
+				auto& bucketNew = buckets[shardId % maxConcurrency];
+				auto state		= shardStates.find(shardId);
+				if (resuming) {
+					if (state != shardStates.end() && state->second == shard_state::queued) {
+						std::erase(bucketNew.queuedShards, shardId);
+						state->second = shard_state::connecting;
+					}
+					return true;
+				}
+				hrclock::time_point now{ hrclock::now() };
+				if (now < bucketNew.nextIdentifyTime) {
+					return false;
+				}
+				bool isItQueued{ state != shardStates.end() && state->second == shard_state::queued };
+				if (isItQueued && (bucketNew.queuedShards.empty() || bucketNew.queuedShards.front() != shardId)) {
+					return false;
+				}
+				if (remoteAcquire && !remoteAcquire(shardId)) {
+					return false;
+				}
+				if (isItQueued) {
+					bucketNew.queuedShards.pop_front();
+					state->second = shard_state::connecting;
+				}
+				bucketNew.nextIdentifyTime = now + identifyInterval;
+				return true;
+			}
+
+			/// @brief Paces a lost shard's reconnection without blocking - the shard first waits out reconnectBackoff, and then again after each time that
+			/// tryAcquire() refuses it, while the agent carries on servicing its other shards.
+			/// @param shardId the shard that lost its connection.
+			/// @param resuming whether the shard is resuming its session.
+			/// @return true if the shard may connect now.
+			inline bool tryReconnect(uint64_t shardId, bool resuming) {
+				std::unique_lock lock{ accessMutex };
+				hrclock::time_point now{ hrclock::now() };
+				if (auto iterator = reconnectTimes.find(shardId); iterator == reconnectTimes.end()) {
+					reconnectTimes.emplace(shardId, now + reconnectBackoff);
+					return false;
+				} else if (now < iterator->second) {
+					return false;
+				}
+				lock.unlock();
+				bool mayConnect{ tryAcquire(shardId, resuming) };
+				lock.lock();
+				if (mayConnect) {
+					reconnectTimes.erase(shardId);
+				} else if (auto iterator = reconnectTimes.find(shardId); iterator != reconnectTimes.end()) {
+					iterator->second = hrclock::now() + reconnectBackoff;
+				}
+				return mayConnect;
+			}
+
+			/// @brief Records that a shard has received its ready event.
+			/// @param shardId the shard.
+			/// @return true the first time that the shard becomes ready.
+			inline bool markReady(uint64_t shardId) {
+				std::unique_lock lock{ accessMutex };
+				auto state = shardStates.find(shardId);
+				if (state == shardStates.end() || state->second == shard_state::ready) {
+					return false;
+				}
+				state->second = shard_state::ready;
+				++readyCount;
+				lock.unlock();
+				progressCondition.notify_all();
+				return true;
+			}
+
+			/// @brief Waits for more shards to become ready than the given count.
+			/// @param readyCountOld the count to wait past.
+			/// @param timeout the longest to wait for.
+			/// @return shard_startup_progress the progress, once the wait is over.
+			inline shard_startup_progress waitForProgress(uint64_t readyCountOld, milliseconds timeout) {
+				std::unique_lock lock{ accessMutex };
+				progressCondition.wait_for(lock, timeout, [&] {
+					return readyCount > readyCountOld;
+				});
+				return getProgressInternal();
+			}
+
+			inline shard_startup_progress getProgress() {
+				std::unique_lock lock{ accessMutex };
+				return getProgressInternal();
+			}
+
+		  protected:
+			enum class shard_state : uint8_t { queued = 0, connecting = 1, ready = 2 };
+
+			struct bucket {
+				hrclock::time_point nextIdentifyTime{};
+				std::deque<uint64_t> queuedShards{};
+			};
+
+			unordered_map<uint64_t, hrclock::time_point> reconnectTimes{};
+			unordered_map<uint64_t, shard_state> shardStates{};
+			std::function<bool(uint64_t)> remoteAcquire{};
+			std::condition_variable progressCondition{};
+			hrclock::time_point startTime{};
+			std::vector<bucket> buckets{};
+			std::mutex accessMutex{};
+			uint64_t maxConcurrency{};
+			uint64_t readyCount{};
+
+			inline shard_startup_progress getProgressInternal() {
+				shard_startup_progress returnData{};
+				returnData.elapsedTime = std::chrono::duration_cast<milliseconds>(hrclock::now() - startTime);
+				returnData.totalShards = shardStates.size();
+				returnData.readyShards = readyCount;
+				for (auto& value: buckets) {
+					returnData.queuedShards += value.queuedShards.size();
+				}
+				returnData.connectingShards = returnData.totalShards - returnData.readyShards - returnData.queuedShards;
+				return returnData;
+			}
+		};
+
+	}
+}
@@ -30,7 +30,7 @@
 #pragma once
 
 #include <discordcoreapi/Utilities/RingBuffer.hpp>
-#include <discordcoreapi/Utilities/EventEntities.hpp>
+#include <discordcoreapi/FoundationEntities.hpp>
 
 #if !defined(OPENSSL_NO_DEPRECATED)
 	#define OPENSSL_NO_DEPRECATED
@@ -241,9 +241,9 @@ namespace discord_core_api {
 						shutdown(*ptrNew, SHUT_RDWR);
 						close(*ptrNew);
 						*ptrNew = INVALID_SOCKET;
-						delete ptrNew;
-						ptrNew = nullptr;
 					};
+					// A wrapper that was handed INVALID_SOCKET still owns the allocation.
+					delete ptrNew;
 				}
 			};
 
@@ -364,6 +364,24 @@ namespace discord_core_api {
 				}
 			}
 
+			/// @brief Writes a message by serializing it straight into the output buffer, instead of copying in a finished message - for messages that
+			/// fit in a single slice of the buffer.
+			/// @param size the exact size of the message.
+			/// @param writer called with a pointer to the size bytes that it's to fill in.
+			/// @return false if the message doesn't fit, or the connection is down, in which case nothing was written.
+			template<typename function_type> inline bool writeDataInPlace(uint64_t size, function_type&& writer) {
+				if (!static_cast<value_type*>(this)->areWeStillConnected() || !static_cast<value_type*>(this)->ssl || size == 0 || size >= maxBufferSize) {
+					return false;
+				}
+				outputBuffer.clear();
+				outputBuffer.getCurrentHead()->clear();
+				writer(outputBuffer.getCurrentHead()->getCurrentHead());
+				outputBuffer.getCurrentHead()->modifyReadOrWritePosition(ring_buffer_access_type::write, size);
+				outputBuffer.modifyReadOrWritePosition(ring_buffer_access_type::write, 1);
+				static_cast<value_type*>(this)->processWriteData();
+				return true;
+			}
+
 			inline auto getInputBuffer() {
 				return inputBuffer.readData();
 			}
@@ -392,6 +410,7 @@ namespace discord_core_api {
 		template<typename value_type> class tcp_connection : public ssl_data_interface<tcp_connection<value_type>> {
 		  public:
 			connection_status currentStatus{ connection_status::NO_Error };
+			jsonifier::string alpnProtocol{};
 			socket_wrapper socket{};
 			bool writeWantWrite{};
 			bool writeWantRead{};
@@ -404,7 +423,12 @@ namespace discord_core_api {
 			tcp_connection& operator=(const tcp_connection& other) = default;
 			tcp_connection(const tcp_connection& other)			   = default;
 
-			inline tcp_connection(const jsonifier::string& baseUrlNew, const uint16_t portNew) {
+			/// @brief Connects, and completes the tls handshake.
+			/// @param baseUrlNew the url to connect to.
+			/// @param portNew the port to connect to.
+			/// @param alpnProtocols the application protocols to offer during the handshake, in alpn's wire format - the one the server picks is left
+			/// in alpnProtocol.
+			inline tcp_connection(const jsonifier::string& baseUrlNew, const uint16_t portNew, jsonifier::string_view alpnProtocols = jsonifier::string_view{}) {
 				jsonifier::string addressString{};
 				auto httpsFind = baseUrlNew.find("https://");
 				auto comFind   = baseUrlNew.find(".com");
@@ -474,6 +498,18 @@ namespace discord_core_api {
 					return;
 				}
 
+				if (alpnProtocols.size() > 0) {
+					if (auto result{ SSL_set_alpn_protos(ssl, reinterpret_cast<const uint8_t*>(alpnProtocols.data()), static_cast<uint32_t>(alpnProtocols.size())) };
+						result != 0) {
+						message_printer::printError<print_message_type::general>(reportSSLError("tcp_connection::connect::SSL_set_alpn_protos(), to: " + baseUrlNew) + "\n" +
+							reportError("tcp_connection::connect::SSL_set_alpn_protos(), to: " + baseUrlNew));
+						currentStatus = connection_status::CONNECTION_Error;
+						socket		  = INVALID_SOCKET;
+						ssl			  = nullptr;
+						return;
+					}
+				}
+
 				if (auto result{ SSL_connect(ssl) }; result != 1) {
 					message_printer::printError<print_message_type::general>(reportSSLError("tcp_connection::connect::SSL_connect(), to: " + baseUrlNew) + "\n" +
 						reportError("tcp_connection::connect::SSL_connect(), to: " + baseUrlNew));
@@ -483,6 +519,15 @@ namespace discord_core_api {
 					return;
 				}
 
+				if (alpnProtocols.size() > 0) {
+					const uint8_t* selected{};
+					uint32_t selectedLength{};
+					SSL_get0_alpn_selected(ssl, &selected, &selectedLength);
+					if (selected) {
+						alpnProtocol = jsonifier::string_view{ reinterpret_cast<const char*>(selected), selectedLength };
+					}
+				}
+
 #if defined(_WIN32)
 				u_long value02{ 1 };
 				if (auto returnData{ ioctlsocket(socket, FIONBIO, &value02) }; returnData == SOCKET_ERROR) {
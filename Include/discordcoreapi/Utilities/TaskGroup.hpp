@@ -0,0 +1,353 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// TaskGroup.hpp - Header file for whenAll(), whenAny() and the task_group class.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file TaskGroup.hpp
+#pragma once
+
+#include <discordcoreapi/CoRoutine.hpp>
+#include <functional>
+#include <memory>
+#include <deque>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		/// @brief A one-shot event that a single co_routine can await - the co_routine is resumed on the thread that sets it.
+		class co_routine_event {
+		  public:
+			inline co_routine_event() = default;
+
+			inline co_routine_event& operator=(const co_routine_event&) = delete;
+			inline co_routine_event(const co_routine_event&)			= delete;
+
+			/// @brief Sets the event, resuming the waiting co_routine if there is one.
+			inline void set() {
+				void* waiterNew{ state.exchange(setState(), std::memory_order_acq_rel) };
+				if (waiterNew && waiterNew != setState()) {
+					std::coroutine_handle<>::from_address(waiterNew).resume();
+				}
+			}
+
+			inline bool await_ready() {
+				return state.load(std::memory_order_acquire) == setState();
+			}
+
+			inline bool await_suspend(std::coroutine_handle<> coroHandleNew) {
+				void* expected{};
+				return state.compare_exchange_strong(expected, coroHandleNew.address(), std::memory_order_acq_rel, std::memory_order_acquire);
+			}
+
+			inline void await_resume() {
+			}
+
+		  protected:
+			std::atomic<void*> state{};
+
+			/// The event's own address marks it as set, since no coroutine frame can share it.
+			inline void* setState() {
+				return static_cast<void*>(this);
+			}
+		};
+
+		/// @brief Requests a stop on each of the co_routines from a given index on.
+		template<typename return_type, bool timeOut> inline void requestStops(std::vector<co_routine<return_type, timeOut>>& tasks, uint64_t startIndex = 0) {
+			for (uint64_t x = startIndex; x < tasks.size(); ++x) {
+				tasks[x].requestStop();
+			}
+		}
+
+		/**@}*/
+	}
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief Awaits a set of co_routines, which are already running concurrently, collecting their results in order. If one of them throws, a stop is
+	/// requested on the ones after it, and the exception is passed on.
+	/// @param tasks the co_routines to await.
+	/// @return co_routine<jsonifier::vector<return_type>, false> a co_routine that produces the results.
+	template<typename return_type, bool timeOut>
+	inline co_routine<jsonifier::vector<return_type>, false> whenAll(std::vector<co_routine<return_type, timeOut>> tasks) {
+		jsonifier::vector<return_type> returnData{};
+		for (uint64_t x = 0; x < tasks.size(); ++x) {
+			try {
+				returnData.emplace_back(co_await tasks[x]);
+			} catch (...) {
+				discord_core_internal::requestStops(tasks, x + 1);
+				throw;
+			}
+		}
+		co_return std::move(returnData);
+	}
+
+	/// @brief Awaits a set of co_routines that produce no value, which are already running concurrently. If one of them throws, a stop is requested on
+	/// the ones after it, and the exception is passed on.
+	/// @param tasks the co_routines to await.
+	/// @return co_routine<void, false> a co_routine that completes once all of the tasks have.
+	template<jsonifier::concepts::void_t return_type, bool timeOut> inline co_routine<void, false> whenAll(std::vector<co_routine<return_type, timeOut>> tasks) {
+		for (uint64_t x = 0; x < tasks.size(); ++x) {
+			try {
+				co_await tasks[x];
+			} catch (...) {
+				discord_core_internal::requestStops(tasks, x + 1);
+				throw;
+			}
+		}
+		co_return;
+	}
+
+	/// @brief The result of whenAny() - which of the co_routines finished first, and its value.
+	template<typename return_type> struct when_any_result {
+		return_type value{};///< The value produced by the co_routine.
+		uint64_t index{};///< The index of the co_routine that finished first.
+	};
+
+	namespace discord_core_internal {
+
+		template<typename return_type, bool timeOut> struct when_any_state {
+			using result_type = std::conditional_t<std::is_void_v<return_type>, uint64_t, when_any_result<return_type>>;
+
+			std::vector<co_routine<return_type, timeOut>> tasks{};
+			std::exception_ptr exception{};
+			co_routine_event event{};
+			std::atomic_bool decided{};
+			result_type result{};
+		};
+
+		/// @brief Awaits one of whenAny()'s co_routines, and reports it if it was the first to finish.
+		template<typename return_type, bool timeOut> inline co_routine<void, false> whenAnyWatcher(std::shared_ptr<when_any_state<return_type, timeOut>> state, uint64_t index) {
+			try {
+				if constexpr (std::is_void_v<return_type>) {
+					co_await state->tasks[index];
+					if (!state->decided.exchange(true, std::memory_order_acq_rel)) {
+						state->result = index;
+						state->event.set();
+					}
+				} else {
+					auto value = co_await state->tasks[index];
+					if (!state->decided.exchange(true, std::memory_order_acq_rel)) {
+						state->result.value = std::move(value);
+						state->result.index = index;
+						state->event.set();
+					}
+				}
+			} catch (...) {
+				if (!state->decided.exchange(true, std::memory_order_acq_rel)) {
+					state->exception = std::current_exception();
+					state->event.set();
+				}
+			}
+			co_return;
+		}
+	}
+
+	/// @brief Awaits whichever of a set of co_routines finishes first, and requests a stop on the rest. If the first to finish threw, the exception is
+	/// passed on.
+	/// @param tasks the co_routines to race, which must not be empty.
+	/// @return a co_routine that produces a when_any_result, or just the index of the winner for co_routines that produce no value.
+	template<typename return_type, bool timeOut> inline auto whenAny(std::vector<co_routine<return_type, timeOut>> tasks)
+		-> co_routine<typename discord_core_internal::when_any_state<return_type, timeOut>::result_type, false> {
+		if (tasks.empty()) {
+			throw co_routine_error{ "whenAny(), you passed an empty set of co_routines." };
+		}
+		auto state	 = std::make_shared<discord_core_internal::when_any_state<return_type, timeOut>>();
+		state->tasks = std::move(tasks);
+		for (uint64_t x = 0; x < state->tasks.size(); ++x) {
+			discord_core_internal::whenAnyWatcher(state, x);
+		}
+		co_await state->event;
+		discord_core_internal::requestStops(state->tasks);
+		if (state->exception) {
+			std::rethrow_exception(state->exception);
+		}
+		co_return std::move(state->result);
+	}
+
+	/// @brief Runs co_routines with at most a set number of them in flight at once - for fanning out rest calls without flooding the rate limiter.
+	/// Tasks are started on the co_routine thread pool in the order they were spawned, and their results are kept in that order.
+	/// \tparam return_type the type of value produced by each task.
+	template<typename return_type> class task_group {
+	  public:
+		using slot_type	  = std::conditional_t<std::is_void_v<return_type>, bool, return_type>;
+		using result_type = std::conditional_t<std::is_void_v<return_type>, void, jsonifier::vector<return_type>>;
+
+		/// @brief Constructor.
+		/// @param maxConcurrencyNew the maximum number of tasks to run at once.
+		inline task_group(uint64_t maxConcurrencyNew = std::thread::hardware_concurrency()) : state{ std::make_shared<group_state>() } {
+			state->maxConcurrency = std::max(maxConcurrencyNew, uint64_t{ 1 });
+		}
+
+		/// @brief Adds a task, starting it now if there's room, or once an earlier one finishes.
+		/// @param function a callable that starts the task and returns its co_routine - it's only called once the task is allowed to run.
+		template<typename function_type> inline void spawn(function_type&& function) {
+			std::unique_lock lock{ state->accessMutex };
+			uint64_t index{ state->taskCount++ };
+			state->results.emplace_back();
+			if (state->cancelled) {
+				++state->completedCount;
+				return;
+			}
+			std::function<void(std::shared_ptr<group_state>)> starter{ [function = std::forward<function_type>(function), index](
+																		   std::shared_ptr<group_state> stateNew) mutable {
+				runTask(std::move(stateNew), index, std::move(function));
+			} };
+			if (state->runningCount < state->maxConcurrency) {
+				++state->runningCount;
+				lock.unlock();
+				starter(state);
+			} else {
+				state->pending.emplace_back(std::move(starter));
+			}
+		}
+
+		/// @brief Waits for every spawned task to finish. This is meant to be awaited once, after all of the tasks have been spawned.
+		/// @return a co_routine that produces the tasks' results in the order they were spawned. If a task threw, the first exception is passed on.
+		inline co_routine<result_type, false> wait() {
+			auto stateNew = state;
+			std::unique_lock lock{ stateNew->accessMutex };
+			stateNew->waiting = true;
+			bool areWeDone{ stateNew->completedCount == stateNew->taskCount };
+			lock.unlock();
+			if (areWeDone) {
+				stateNew->event.set();
+			}
+			co_await stateNew->event;
+			if (stateNew->exception) {
+				std::rethrow_exception(stateNew->exception);
+			}
+			if constexpr (std::is_void_v<return_type>) {
+				co_return;
+			} else {
+				co_return std::move(stateNew->results);
+			}
+		}
+
+		/// @brief Drops the tasks that haven't started yet, and requests a stop on the ones that are running.
+		inline void cancel() {
+			std::unique_lock lock{ state->accessMutex };
+			state->cancelled = true;
+			state->completedCount += state->pending.size();
+			state->pending.clear();
+			for (auto& [key, value]: state->stoppers) {
+				value();
+			}
+			bool areWeDone{ state->waiting && state->completedCount == state->taskCount };
+			lock.unlock();
+			if (areWeDone) {
+				state->event.set();
+			}
+		}
+
+	  protected:
+		struct group_state {
+			std::deque<std::function<void(std::shared_ptr<group_state>)>> pending{};
+			unordered_map<uint64_t, std::function<void()>> stoppers{};
+			discord_core_internal::co_routine_event event{};
+			jsonifier::vector<slot_type> results{};
+			std::exception_ptr exception{};
+			uint64_t completedCount{};
+			uint64_t maxConcurrency{};
+			std::mutex accessMutex{};
+			uint64_t runningCount{};
+			uint64_t taskCount{};
+			bool cancelled{};
+			bool waiting{};
+		};
+
+		std::shared_ptr<group_state> state{};
+
+		/// Hops onto the thread pool first, so that a task that finishes straight away can't start the next one further down the same stack.
+		template<typename function_type> inline static co_routine<void, false> runTask(std::shared_ptr<group_state> stateNew, uint64_t index, function_type function) {
+			co_await newThreadAwaitable<void, false>();
+			try {
+				auto task = function();
+				std::unique_lock lock{ stateNew->accessMutex };
+				if (stateNew->cancelled) {
+					task.requestStop();
+				}
+				stateNew->stoppers.emplace(index, [&task] {
+					task.requestStop();
+				});
+				lock.unlock();
+				try {
+					if constexpr (std::is_void_v<return_type>) {
+						co_await task;
+						lock.lock();
+						stateNew->results[index] = true;
+					} else {
+						auto value = co_await task;
+						lock.lock();
+						stateNew->results[index] = std::move(value);
+					}
+				} catch (...) {
+					lock.lock();
+					stateNew->stoppers.erase(index);
+					throw;
+				}
+				stateNew->stoppers.erase(index);
+			} catch (...) {
+				std::unique_lock lock{ stateNew->accessMutex };
+				if (!stateNew->exception) {
+					stateNew->exception = std::current_exception();
+				}
+			}
+			finishTask(stateNew);
+			co_return;
+		}
+
+		inline static void finishTask(std::shared_ptr<group_state> stateNew) {
+			std::unique_lock lock{ stateNew->accessMutex };
+			--stateNew->runningCount;
+			++stateNew->completedCount;
+			std::function<void(std::shared_ptr<group_state>)> next{};
+			if (stateNew->pending.size() > 0) {
+				next = std::move(stateNew->pending.front());
+				stateNew->pending.pop_front();
+				++stateNew->runningCount;
+			}
+			bool areWeDone{ stateNew->waiting && stateNew->completedCount == stateNew->taskCount };
+			lock.unlock();
+			if (next) {
+				next(stateNew);
+			}
+			if (areWeDone) {
+				stateNew->event.set();
+			}
+		}
+	};
+
+	/**@}*/
+}
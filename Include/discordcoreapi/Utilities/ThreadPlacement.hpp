@@ -0,0 +1,78 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ThreadPlacement.hpp - Header file for pinning threads to cpus.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file ThreadPlacement.hpp
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <thread>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup discord_core_client
+	 * @{
+	 */
+
+	/// @brief One of the host's logical cpus.
+	struct cpu_core_data {
+		uint32_t numaNode{};///< The numa node that the cpu belongs to - 0 where the host doesn't report them.
+		uint32_t cpuIndex{};///< The cpu's index, as used in thread_placement_options.
+	};
+
+	/**@}*/
+
+	namespace discord_core_internal {
+
+		/// @brief Collects the host's logical cpus, with their numa nodes - read from sysfs on linux, and from the numa api for the first 64 cpus on windows.
+		/// @return jsonifier::vector<cpu_core_data> the cpus, in order.
+		DiscordCoreAPI_Dll jsonifier::vector<cpu_core_data> getCpuTopology();
+
+		/// @brief Restricts a thread to a set of cpus - which isn't supported on macos, where the scheduler only takes hints.
+		/// @param thread the thread's native handle.
+		/// @param cpus the cpus to allow the thread on.
+		/// @return true if the thread was pinned.
+		DiscordCoreAPI_Dll bool setThreadAffinity(std::thread::native_handle_type thread, const jsonifier::vector<uint32_t>& cpus);
+
+		/// @brief Pins the calling thread for the guard's lifetime, then hands it back the cpus it had before - for work that borrows a pool's thread.
+		class DiscordCoreAPI_Dll thread_affinity_guard {
+		  public:
+			/// @param cpus the cpus to pin the thread to - an empty set leaves it alone.
+			thread_affinity_guard(const jsonifier::vector<uint32_t>& cpus);
+
+			thread_affinity_guard& operator=(const thread_affinity_guard&) = delete;
+			thread_affinity_guard(const thread_affinity_guard&)			   = delete;
+
+			~thread_affinity_guard();
+
+		  protected:
+			jsonifier::vector<uint32_t> previousCpus{};
+		};
+
+	}
+}
@@ -0,0 +1,333 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// TimerWheel.hpp - Header file for the hierarchical timer wheel.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file TimerWheel.hpp
+#pragma once
+
+#include <discordcoreapi/CoRoutine.hpp>
+#include <discordcoreapi/Utilities/UnorderedSet.hpp>
+#include <condition_variable>
+#include <functional>
+#include <array>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		/// @brief A single scheduled timer.
+		struct timer_entry {
+			std::function<void()> callback{};
+			uint64_t interval{};
+			uint64_t expiry{};
+			uint64_t id{};
+		};
+
+		/// @brief A hierarchical timer wheel with millisecond ticks, driven by a single thread - four levels of 64 slots cover about 4.6 hours, and longer
+		/// timers wait in an overflow list that is revisited each time the top level wraps.
+		class timer_wheel {
+		  public:
+			static constexpr uint64_t slotBits{ 6 };
+			static constexpr uint64_t slotCount{ 1ull << slotBits };
+			static constexpr uint64_t levelCount{ 4 };
+
+			inline timer_wheel() : startTime{ hrclock::now() } {
+				thread = std::jthread([this](std::stop_token token) {
+					run(token);
+				});
+			}
+
+			inline timer_wheel& operator=(const timer_wheel&) = delete;
+			inline timer_wheel(const timer_wheel&)			  = delete;
+
+			/// @brief Schedules a callback, which runs on the timer thread - so it should be short, or hand its work off.
+			/// @param delay how long until the callback runs.
+			/// @param callback the function to run.
+			/// @param interval if non-zero, the callback repeats at this interval until cancelled.
+			/// @return uint64_t a token for cancelling the timer.
+			inline uint64_t schedule(milliseconds delay, std::function<void()> callback, milliseconds interval = milliseconds{}) {
+				std::unique_lock lock{ accessMutex };
+				uint64_t elapsedTicks{ getElapsedTicks() };
+				if (activeIds.size() == 0) {
+					// Nothing live is left on the wheel, so it can skip the idle ticks instead of stepping through them.
+					clear();
+					currentTick = std::max(currentTick, elapsedTicks);
+				}
+				timer_entry entry{};
+				entry.callback = std::move(callback);
+				entry.interval = static_cast<uint64_t>(std::max(interval.count(), int64_t{ 0 }));
+				// One extra tick, since the current one has already partly passed and a timer should never fire early.
+				entry.expiry   = std::max(elapsedTicks, currentTick) + static_cast<uint64_t>(std::max(delay.count(), int64_t{ 0 })) + 1;
+				entry.id	   = ++lastId;
+				activeIds.emplace(entry.id);
+				bool doWeWake{ entry.expiry < nextWakeTick };
+				if (doWeWake) {
+					nextWakeTick = 0;
+				}
+				uint64_t returnValue{ entry.id };
+				insert(std::move(entry));
+				lock.unlock();
+				if (doWeWake) {
+					workCondition.notify_one();
+				}
+				return returnValue;
+			}
+
+			/// @brief Cancels a timer.
+			/// @param id the token returned when the timer was scheduled.
+			/// @return bool true if the timer was still pending.
+			inline bool cancel(uint64_t id) {
+				std::unique_lock lock{ accessMutex };
+				if (activeIds.contains(id)) {
+					activeIds.erase(id);
+					return true;
+				}
+				return false;
+			}
+
+			/// @return uint64_t the number of pending timers.
+			inline uint64_t size() {
+				std::unique_lock lock{ accessMutex };
+				return activeIds.size();
+			}
+
+			inline ~timer_wheel() {
+				thread.request_stop();
+				workCondition.notify_one();
+			}
+
+		  protected:
+			std::array<std::array<std::vector<timer_entry>, slotCount>, levelCount> levels{};
+			std::condition_variable_any workCondition{};
+			std::vector<timer_entry> overflow{};
+			hrclock::time_point startTime{};
+			unordered_set<uint64_t> activeIds{};
+			uint64_t nextWakeTick{ std::numeric_limits<uint64_t>::max() };
+			std::mutex accessMutex{};
+			uint64_t currentTick{};
+			uint64_t lastId{};
+			std::jthread thread{};
+
+			inline uint64_t getElapsedTicks() const {
+				return static_cast<uint64_t>(std::chrono::duration_cast<milliseconds>(hrclock::now() - startTime).count());
+			}
+
+			inline void clear() {
+				for (auto& level: levels) {
+					for (auto& slot: level) {
+						slot.clear();
+					}
+				}
+				overflow.clear();
+			}
+
+			/// Places an entry on the lowest level whose current rotation still contains its expiry, which guarantees the slot is reached before it expires.
+			inline void insert(timer_entry&& entry) {
+				for (uint64_t x = 0; x < levelCount; ++x) {
+					uint64_t shift{ slotBits * (x + 1) };
+					if ((entry.expiry >> shift) == (currentTick >> shift)) {
+						levels[x][(entry.expiry >> (slotBits * x)) & (slotCount - 1)].emplace_back(std::move(entry));
+						return;
+					}
+				}
+				overflow.emplace_back(std::move(entry));
+			}
+
+			/// Moves a slot's entries down to the lower levels, now that their rotation has begun.
+			inline void cascade(std::vector<timer_entry>& slot) {
+				std::vector<timer_entry> entries{ std::move(slot) };
+				slot.clear();
+				for (auto& value: entries) {
+					insert(std::move(value));
+				}
+			}
+
+			/// Advances the wheel by one tick, collecting the entries that are due.
+			inline void advance(std::vector<timer_entry>& due) {
+				++currentTick;
+				if ((currentTick & ((1ull << (slotBits * levelCount)) - 1)) == 0) {
+					cascade(overflow);
+				}
+				for (uint64_t x = levelCount - 1; x > 0; --x) {
+					if ((currentTick & ((1ull << (slotBits * x)) - 1)) == 0) {
+						cascade(levels[x][(currentTick >> (slotBits * x)) & (slotCount - 1)]);
+					}
+				}
+				auto& slot = levels[0][currentTick & (slotCount - 1)];
+				for (auto& value: slot) {
+					if (activeIds.contains(value.id)) {
+						due.emplace_back(std::move(value));
+					}
+				}
+				slot.clear();
+			}
+
+			/// @return the number of ticks until the next due entry in the lowest level, or until the next cascade.
+			inline uint64_t getTicksUntilNextWork() {
+				uint64_t blockEnd{ (currentTick | (slotCount - 1)) + 1 };
+				for (uint64_t x = currentTick + 1; x < blockEnd; ++x) {
+					if (levels[0][x & (slotCount - 1)].size() > 0) {
+						return x - currentTick;
+					}
+				}
+				return blockEnd - currentTick;
+			}
+
+			inline void run(std::stop_token token) {
+				std::vector<timer_entry> due{};
+				while (!token.stop_requested()) {
+					std::unique_lock lock{ accessMutex };
+					uint64_t elapsedTicks{ getElapsedTicks() };
+					while (currentTick < elapsedTicks) {
+						advance(due);
+					}
+					for (auto& value: due) {
+						if (value.interval > 0) {
+							timer_entry entry{ value.callback, value.interval, currentTick + value.interval, value.id };
+							insert(std::move(entry));
+						} else {
+							activeIds.erase(value.id);
+						}
+					}
+					if (due.size() > 0) {
+						lock.unlock();
+						for (auto& value: due) {
+							try {
+								value.callback();
+							} catch (const std::exception& error) {
+								// One bad callback mustn't take the timer thread, and every timer after it, down with it.
+								message_printer::printError<print_message_type::general>(error.what());
+							} catch (...) {
+								message_printer::printError<print_message_type::general>("A timer callback threw a non-standard exception.");
+							}
+						}
+						due.clear();
+						continue;
+					}
+					if (activeIds.size() == 0) {
+						nextWakeTick = std::numeric_limits<uint64_t>::max();
+						workCondition.wait(lock, token, [this] {
+							return activeIds.size() > 0;
+						});
+					} else {
+						uint64_t ticksToWait{ getTicksUntilNextWork() };
+						nextWakeTick = currentTick + ticksToWait;
+						workCondition.wait_until(lock, token, startTime + milliseconds{ nextWakeTick }, [this] {
+							return nextWakeTick == 0;
+						});
+					}
+					nextWakeTick = 0;
+				}
+			}
+		};
+
+		/// @brief The timer wheel that the library's delays and timeouts share.
+		class timer_wheel_base {
+		  public:
+			inline static timer_wheel timerWheel{};
+		};
+
+		/**@}*/
+	}
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief An awaitable that suspends the co_routine for a period of time without holding a thread, then resumes it on the co_routine thread pool. A
+	/// stop requested on the co_routine cancels the timer and resumes it early.
+	class timer_awaiter {
+	  public:
+		inline timer_awaiter(milliseconds delayNew) : delay{ delayNew } {};
+
+		inline bool await_ready() const {
+			return delay.count() <= 0;
+		}
+
+		template<typename promise_type> inline bool await_suspend(std::coroutine_handle<promise_type> coroHandleNew) {
+			// Whichever of the timer and the stop gets here first resumes the co_routine - the state outlives the frame, for the other one.
+			auto stateNew = std::make_shared<timer_state>();
+			std::unique_lock lock{ stateNew->accessMutex };
+			stateNew->timerId = discord_core_internal::timer_wheel_base::timerWheel.schedule(delay, [stateNew, coroHandleNew] {
+				stateNew->resume(coroHandleNew);
+			});
+			if constexpr (std::is_base_of_v<co_routine_promise_base, promise_type>) {
+				promise = &coroHandleNew.promise();
+				if (!promise->setStopCallback([stateNew, coroHandleNew] {
+						if (discord_core_internal::timer_wheel_base::timerWheel.cancel(stateNew->timerId)) {
+							stateNew->resume(coroHandleNew);
+						}
+					})) {
+					discord_core_internal::timer_wheel_base::timerWheel.cancel(stateNew->timerId);
+					stateNew->resumed = true;
+					return false;
+				}
+			}
+			return true;
+		}
+
+		inline void await_resume() {
+			if (promise) {
+				promise->clearStopCallback();
+			}
+		}
+
+	  protected:
+		struct timer_state {
+			std::mutex accessMutex{};
+			uint64_t timerId{};
+			bool resumed{};
+
+			inline void resume(std::coroutine_handle<> coroHandleNew) {
+				std::unique_lock lock{ accessMutex };
+				if (!resumed) {
+					resumed = true;
+					lock.unlock();
+					new_thread_awaiter_base::threadPool.submitTask(coroHandleNew);
+				}
+			}
+		};
+
+		co_routine_promise_base* promise{};
+		milliseconds delay{};
+	};
+
+	/// @brief Suspends the current co_routine for a period of time, without blocking a thread - co_await after(500ms).
+	/// @param delay the period of time to wait.
+	/// @return timer_awaiter an awaitable for the delay.
+	inline timer_awaiter after(milliseconds delay) {
+		return timer_awaiter{ delay };
+	}
+
+	/**@}*/
+}
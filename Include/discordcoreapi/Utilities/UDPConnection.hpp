@@ -174,7 +174,9 @@ namespace discord_core_api {
 				}
 			}
 
-			inline connection_status processIO() {
+			/// @brief Sends and receives whatever the socket is ready for.
+			/// @param waitTimeInMs how long to wait for the socket to become ready - zero to just check it.
+			inline connection_status processIO(int32_t waitTimeInMs = 0) {
 				if (!areWeStillConnected()) {
 					return currentStatus;
 				};
@@ -185,7 +187,7 @@ namespace discord_core_api {
 				} else {
 					readWriteSet.events = POLLIN;
 				}
-				if (auto returnValue = poll(&readWriteSet, 1, 0); returnValue == SOCKET_ERROR) {
+				if (auto returnValue = poll(&readWriteSet, 1, waitTimeInMs); returnValue == SOCKET_ERROR) {
 					message_printer::printError<print_message_type::websocket>(reportSSLError("processIO() 00") + reportError("processIO() 00"));
 					currentStatus = connection_status::SOCKET_Error;
 					socket		  = INVALID_SOCKET;
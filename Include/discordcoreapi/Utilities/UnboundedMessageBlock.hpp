@@ -30,6 +30,7 @@
 #pragma once
 
 #include <discordcoreapi/Utilities/Base.hpp>
+#include <condition_variable>
 
 namespace discord_core_api {
 
@@ -57,11 +58,14 @@ namespace discord_core_api {
 		template<copyable_or_movable value_type_newer> inline void send(value_type_newer&& object) {
 			std::unique_lock lock{ accessMutex };
 			queue.emplace_back(std::forward<value_type_newer>(object));
+			lock.unlock();
+			dataCondition.notify_one();
 		}
 
 		inline void clearContents() {
 			std::unique_lock lock{ accessMutex };
 			queue.clear();
+			spaceCondition.notify_all();
 		}
 
 		inline bool tryReceive(value_type& object) {
@@ -69,34 +73,60 @@ namespace discord_core_api {
 			if (queue.size() > 0) {
 				object = std::move(queue.front());
 				queue.pop_front();
+				spaceCondition.notify_all();
 				return true;
 			} else {
 				return false;
 			}
 		}
 
+		/// @brief Waits for an object to arrive, for up to a given time.
+		/// @param object the object to move the received value into.
+		/// @param timeout how long to wait for one.
+		/// @return false if the time passed without an object arriving.
+		inline bool tryReceiveFor(value_type& object, milliseconds timeout) {
+			std::unique_lock lock{ accessMutex };
+			if (!dataCondition.wait_for(lock, timeout, [&] {
+					return queue.size() > 0;
+				})) {
+				return false;
+			}
+			object = std::move(queue.front());
+			queue.pop_front();
+			spaceCondition.notify_all();
+			return true;
+		}
+
 		inline uint64_t size() {
 			std::unique_lock lock{ accessMutex };
 			return queue.size();
 		}
 
+		/// @brief Blocks until the block holds no more than a given number of objects - for producers that are far faster than the consumer.
+		/// @param maxSize the number of objects to wait for the block to drain to.
+		/// @param stopRequested checked each time the wait is woken, ending it early once it returns true - wake it with notifyWaiters().
+		/// @return false if the wait was ended by stopRequested.
+		template<typename function_type> inline bool waitForSize(uint64_t maxSize, function_type&& stopRequested) {
+			std::unique_lock lock{ accessMutex };
+			spaceCondition.wait(lock, [&] {
+				return queue.size() <= maxSize || stopRequested();
+			});
+			return !stopRequested();
+		}
+
+		/// @brief Wakes the threads in waitForSize(), so that they check their stop condition.
+		inline void notifyWaiters() {
+			std::unique_lock lock{ accessMutex };
+			spaceCondition.notify_all();
+		}
+
 		inline ~unbounded_message_block() = default;
 
 	  protected:
+		std::condition_variable spaceCondition{};
+		std::condition_variable dataCondition{};
 		std::deque<value_type> queue{};
 		std::mutex accessMutex{};
 	};
 
-	template<typename value_type> inline bool waitForTimeToPass(unbounded_message_block<std::unwrap_ref_decay_t<value_type>>& outBuffer, value_type& argOne, uint64_t timeInMsNew) {
-		stop_watch<milliseconds> stopWatch{ milliseconds{ timeInMsNew } };
-		stopWatch.reset();
-		while (!outBuffer.tryReceive(argOne)) {
-			std::this_thread::sleep_for(1ms);
-			if (stopWatch.hasTimeElapsed()) {
-				return true;
-			}
-		};
-		return false;
-	}
-
 }
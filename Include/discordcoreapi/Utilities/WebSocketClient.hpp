@@ -31,8 +31,11 @@
 
 #include <discordcoreapi/Utilities/AudioDecoder.hpp>
 #include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/Utilities/GatewayEventExecutor.hpp>
+#include <discordcoreapi/Utilities/ShardStartupScheduler.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
 #include <discordcoreapi/Utilities/TCPConnection.hpp>
+#include <discordcoreapi/Utilities/TimerWheel.hpp>
 #include <discordcoreapi/Utilities/Etf.hpp>
 #include <thread>
 
@@ -217,6 +220,13 @@ namespace discord_core_api {
 
 			bool checkForAndSendHeartBeat(bool = false);
 
+			/// @brief Starts marking a heartbeat as due at each interval, from the timer wheel - the beat itself is still sent from the socket's own thread.
+			/// @param interval the heartbeat interval that the hello payload asked for.
+			void startHeartBeating(milliseconds interval);
+
+			/// @brief Stops the heartbeat timer.
+			void stopHeartBeating();
+
 			void parseConnectionHeaders();
 
 			virtual void onClosed() = 0;
@@ -227,13 +237,14 @@ namespace discord_core_api {
 
 			void disconnect();
 
-			virtual ~websocket_core() = default;
+			virtual ~websocket_core();
 
 		  protected:
-			stop_watch<milliseconds> heartBeatStopWatch{ 20000ms };
+			std::shared_ptr<std::atomic_bool> isHeartBeatDue{ std::make_shared<std::atomic_bool>() };///< Set by the timer wheel, shared so that a late timer never outlives it.
 			jsonifier::string_base<uint8_t> currentMessage{};
 			std::atomic<websocket_state> currentState{};
 			bool haveWeReceivedHeartbeatAck{ true };
+			milliseconds heartBeatInterval{ 20000ms };
 			std::atomic_bool areWeCollectingData{};
 			websocket_tcpconnection tcpConnection{};
 			uint32_t maxReconnectTries{ 10 };
@@ -242,6 +253,7 @@ namespace discord_core_api {
 			config_manager* configManager{};
 			uint32_t lastNumberReceived{};
 			websocket_op_code dataOpCode{};
+			uint64_t heartBeatTimerId{};
 			std::mutex accessMutex{};
 			bool areWeHeartBeating{};
 			websocket_type wsType{};
@@ -275,6 +287,9 @@ namespace discord_core_api {
 
 			void disconnect();
 
+			/// @brief Closes the connection without ending the session, so that another process can resume it.
+			void suspend();
+
 			void onClosed() override;
 
 			virtual ~websocket_client();
@@ -288,6 +303,17 @@ namespace discord_core_api {
 			bool serverUpdateCollected{};
 			bool stateUpdateCollected{};
 			snowflake userId{};
+
+			/// @brief Reports the shard's ready or resumed event to the startup scheduler.
+			void onShardReady();
+
+			/// @brief Sends a request guild members command.
+			/// @param payload the request.
+			/// @return false if the shard's connection was lost.
+			bool requestGuildMembers(const request_guild_members_payload& payload);
+
+			/// @brief Parses and handles a dispatch that doesn't touch the shard's own state, on one of the gateway event lanes.
+			static void processDispatch(jsonifier::jsonifier_core<false>& parser, uint64_t eventType, jsonifier::string_view_base<uint8_t> dataNew);
 		};
 
 		class base_socket_agent {
@@ -308,6 +334,9 @@ namespace discord_core_api {
 			std::jthread taskThread{};
 
 			void run(std::stop_token);
+
+			/// @brief Sends as many of the shard's queued guild member requests as its budget allows, once it's authenticated.
+			void sendGuildMemberRequests(uint64_t shardId, websocket_client& value);
 		};
 
 	}// namespace
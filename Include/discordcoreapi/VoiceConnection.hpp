@@ -153,21 +153,89 @@ namespace discord_core_api {
 		snowflake userId{};
 	};
 
+	/// @brief The transport encryption modes that can be negotiated with the voice server.
+	enum class voice_encryption_mode : uint8_t {
+		xsalsa20_poly1305				= 0,///< Legacy mode, the rtp header is used as the nonce.
+		aead_xchacha20_poly1305_rtpsize = 1,///< Xchacha20-poly1305 aead, with a 32-bit nonce appended to the packet.
+		aead_aes256_gcm_rtpsize			= 2///< Aes256-gcm aead, with a 32-bit nonce appended to the packet. requires aes-ni.
+	};
+
+	/// @brief Collects the string that discord uses to refer to a given encryption mode.
+	/// @param mode the mode to collect the string for.
+	/// @return jsonifier::string_view the name of the mode.
+	DiscordCoreAPI_Dll jsonifier::string_view getEncryptionModeName(voice_encryption_mode mode);
+
+	/// @brief Selects the fastest encryption mode out of those offered by the voice server.
+	/// @param modes the modes that were offered in the ready payload.
+	/// @return voice_encryption_mode the selected mode.
+	DiscordCoreAPI_Dll voice_encryption_mode selectEncryptionMode(const jsonifier::vector<jsonifier::string>& modes);
+
+	struct rtppacket_encrypter;
+
+	/// @brief A single frame to be encrypted as part of a batch.
+	struct rtp_encryption_job {
+		discord_core_internal::encoder_return_data* audioData{};///< The encoded frame to encrypt.
+		jsonifier::string_view_base<uint8_t> packet{};///< The resulting packet, a view into the batch's buffer.
+		rtppacket_encrypter* encrypter{};///< The encrypter of the connection that the frame belongs to.
+	};
+
 	struct DiscordCoreAPI_Dll rtppacket_encrypter {
+		static constexpr uint64_t headerSize{ 12 };
+		static constexpr uint64_t macSize{ 16 };
+		static constexpr uint64_t nonceSize{ sizeof(uint32_t) };
+
 		rtppacket_encrypter() = default;
 
-		rtppacket_encrypter(uint32_t ssrcNew, const jsonifier::string_base<uint8_t>& keysNew);
+		rtppacket_encrypter(uint32_t ssrcNew, const jsonifier::string_base<uint8_t>& keysNew, voice_encryption_mode modeNew = voice_encryption_mode::xsalsa20_poly1305);
+
+		/// @brief Collects the largest size that a packet may occupy once encrypted.
+		/// @param payloadSize the size of the unencrypted payload.
+		/// @return uint64_t the maximum size of the packet.
+		inline static constexpr uint64_t getMaxPacketSize(uint64_t payloadSize) {
+			return headerSize + payloadSize + macSize + nonceSize;
+		}
+
+		/// @brief Encrypts a batch of frames, possibly from different connections, into a single shared buffer.
+		/// @param jobs the frames to encrypt - each job's packet is set to a view into the buffer, or left empty on failure.
+		/// @param buffer the buffer to write the packets into, which is only ever grown.
+		static void encryptPackets(jsonifier::vector<rtp_encryption_job>& jobs, jsonifier::string_base<uint8_t>& buffer);
+
+		/// @brief Encrypts a frame into a given output buffer.
+		/// @param audioData the encoded frame to encrypt.
+		/// @param outputBuffer the buffer to write into, which must hold at least getMaxPacketSize(audioData.data.size()) bytes.
+		/// @return uint64_t the size of the written packet, or 0 on failure.
+		uint64_t encryptPacket(discord_core_internal::encoder_return_data& audioData, uint8_t* outputBuffer);
 
 		jsonifier::string_view_base<uint8_t> encryptPacket(discord_core_internal::encoder_return_data& audioData);
 
 	  protected:
+		crypto_aead_aes256gcm_state aesState{};
 		jsonifier::string_base<uint8_t> data{};
 		jsonifier::string_base<uint8_t> keys{};
+		voice_encryption_mode mode{};
+		uint32_t nonceCounter{};
 		uint32_t timeStamp{};
 		uint16_t sequence{};
 		uint32_t ssrc{};
 	};
 
+	struct DiscordCoreAPI_Dll rtppacket_decrypter {
+		rtppacket_decrypter() = default;
+
+		rtppacket_decrypter(const jsonifier::string_base<uint8_t>& keysNew, voice_encryption_mode modeNew);
+
+		/// @brief Decrypts an incoming rtp packet, stripping the header extension if present.
+		/// @param packet the full packet, as received.
+		/// @return jsonifier::string_view_base<uint8_t> the decrypted opus payload, or an empty view on failure.
+		jsonifier::string_view_base<uint8_t> decryptPacket(jsonifier::string_view_base<uint8_t> packet);
+
+	  protected:
+		crypto_aead_aes256gcm_state aesState{};
+		jsonifier::string_base<uint8_t> data{};
+		jsonifier::string_base<uint8_t> keys{};
+		voice_encryption_mode mode{};
+	};
+
 	struct DiscordCoreAPI_Dll moving_averager {
 		moving_averager(uint64_t collectionCountNew);
 
@@ -220,8 +288,8 @@ namespace discord_core_api {
 	  public:
 		friend class voice_connection;
 
-		voice_connection_bridge(unordered_map<uint64_t, unique_ptr<voice_user>>* voiceUsersPtrNew, jsonifier::string_base<uint8_t>& encryptionKeyNew, stream_type streamType,
-			const jsonifier::string& baseUrlNew, const uint16_t portNew, snowflake guildIdNew,
+		voice_connection_bridge(unordered_map<uint64_t, unique_ptr<voice_user>>* voiceUsersPtrNew, jsonifier::string_base<uint8_t>& encryptionKeyNew,
+			voice_encryption_mode encryptionModeNew, stream_type streamType, const jsonifier::string& baseUrlNew, const uint16_t portNew, snowflake guildIdNew,
 			std::coroutine_handle<discord_core_api::co_routine<void, false>::promise_type>* tokenNew);
 
 		inline void applyGainRamp(int64_t sampleCount);
@@ -237,12 +305,11 @@ namespace discord_core_api {
 	  protected:
 		std::coroutine_handle<discord_core_api::co_routine<void, false>::promise_type>* token{};
 		unordered_map<uint64_t, unique_ptr<voice_user>>* voiceUsersPtr{};
-		jsonifier::string_base<uint8_t> decryptedDataString{};
 		std::array<opus_int16, 23040> downSampledVector{};
-		jsonifier::string_base<uint8_t> encryptionKey{};
 		std::array<opus_int32, 23040> upSampledVector{};
 		jsonifier::vector<uint8_t> resampleVector{};
 		moving_averager voiceUserCountAverage{ 25 };
+		rtppacket_decrypter packetDecrypter{};
 		snowflake guildId{};
 		float currentGain{};
 		float increment{};
@@ -272,6 +339,7 @@ namespace discord_core_api {
 	class DiscordCoreAPI_Dll voice_connection : public discord_core_internal::websocket_core {
 	  public:
 		friend class discord_core_internal::base_socket_agent;
+		friend class discord_core_internal::song_stream_sink;
 		friend class discord_core_internal::sound_cloud_api;
 		friend class discord_core_internal::you_tube_api;
 		friend class voice_connection_bridge;
@@ -307,12 +375,13 @@ namespace discord_core_api {
 		std::atomic<voice_active_state> activeState{ voice_active_state::connecting };
 		discord_core_internal::voice_connection_data voiceConnectionData{};
 		unordered_map<uint64_t, unique_ptr<voice_user>> voiceUsers{};
-		discord_core_internal::opus_encoder_wrapper encoder{};
+		unique_ptr<discord_core_internal::opus_encoder_wrapper> encoder{};
 		discord_core_internal::websocket_client* baseShard{};
 		unique_ptr<voice_connection_bridge> streamSocket{};
 		jsonifier::string_base<uint8_t> encryptionKey{};
+		jsonifier::string_base<uint8_t> silenceBuffer{};
 		voice_connect_init_data voiceConnectInitData{};
-		jsonifier::string audioEncryptionMode{};
+		voice_encryption_mode audioEncryptionMode{};
 		rtppacket_encrypter packetEncrypter{};
 		int64_t sampleRatePerSecond{ 48000 };
 		co_routine<void, false> taskThread{};
@@ -341,6 +410,8 @@ namespace discord_core_api {
 
 		void checkForAndSendHeartBeat(const bool isImmedate);
 
+		audio_encoder_settings getEncoderSettings();
+
 		void sendSpeakingMessage(const bool isSpeaking);
 
 		co_routine<void, false> runVoice();
@@ -135,7 +135,7 @@ namespace discord_core_api {
 	co_routine<application_command_data> application_commands::editGlobalApplicationCommandAsync(edit_global_application_command_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Patch_Global_Application_Command };
 		co_await newThreadAwaitable<application_command_data>();
-		jsonifier::vector<application_command_data> appCommands = getGlobalApplicationCommandsAsync({ .applicationId = dataPackage.applicationId }).get();
+		jsonifier::vector<application_command_data> appCommands = co_await getGlobalApplicationCommandsAsync({ .applicationId = dataPackage.applicationId });
 		bool isItFound{};
 		snowflake appCommandId{};
 		for (auto& value: appCommands) {
@@ -159,7 +159,7 @@ namespace discord_core_api {
 	co_routine<void> application_commands::deleteGlobalApplicationCommandAsync(delete_global_application_command_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Delete_Global_Application_Command };
 		co_await newThreadAwaitable<void>();
-		jsonifier::vector<application_command_data> appCommands = getGlobalApplicationCommandsAsync({ .applicationId = dataPackage.applicationId }).get();
+		jsonifier::vector<application_command_data> appCommands = co_await getGlobalApplicationCommandsAsync({ .applicationId = dataPackage.applicationId });
 		snowflake commandId{};
 		bool isItFound = false;
 		for (auto& value: appCommands) {
@@ -233,7 +233,7 @@ namespace discord_core_api {
 	co_routine<application_command_data> application_commands::editGuildApplicationCommandAsync(edit_guild_application_command_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Patch_Guild_Application_Command };
 		co_await newThreadAwaitable<application_command_data>();
-		jsonifier::vector<application_command_data> appCommands = getGuildApplicationCommandsAsync({ .guildId = dataPackage.guildId }).get();
+		jsonifier::vector<application_command_data> appCommands = co_await getGuildApplicationCommandsAsync({ .guildId = dataPackage.guildId });
 		bool isItFound											= false;
 		snowflake appCommandId{};
 		for (auto& value: appCommands) {
@@ -257,7 +257,7 @@ namespace discord_core_api {
 	co_routine<void> application_commands::deleteGuildApplicationCommandAsync(delete_guild_application_command_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Delete_Guild_Application_Command };
 		co_await newThreadAwaitable<void>();
-		jsonifier::vector<application_command_data> appCommands = getGuildApplicationCommandsAsync({ .guildId = dataPackage.guildId }).get();
+		jsonifier::vector<application_command_data> appCommands = co_await getGuildApplicationCommandsAsync({ .guildId = dataPackage.guildId });
 		snowflake commandId;
 		bool isItFound = false;
 		for (auto& value: appCommands) {
@@ -304,7 +304,7 @@ namespace discord_core_api {
 	co_routine<guild_application_command_permissions_data> application_commands::getApplicationCommandPermissionsAsync(get_application_command_permissions_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Get_Guild_Application_Command_Permissions };
 		co_await newThreadAwaitable<guild_application_command_permissions_data>();
-		jsonifier::vector<application_command_data> appCommands = getGuildApplicationCommandsAsync({ .guildId = dataPackage.guildId }).get();
+		jsonifier::vector<application_command_data> appCommands = co_await getGuildApplicationCommandsAsync({ .guildId = dataPackage.guildId });
 		snowflake commandId;
 		bool isItFound = false;
 		for (auto& value: appCommands) {
@@ -328,7 +328,7 @@ namespace discord_core_api {
 		edit_guild_application_command_permissions_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Put_Guild_Application_Command_Permissions };
 		co_await newThreadAwaitable<guild_application_command_permissions_data>();
-		jsonifier::vector<application_command_data> appCommands = getGuildApplicationCommandsAsync({ .guildId = dataPackage.guildId }).get();
+		jsonifier::vector<application_command_data> appCommands = co_await getGuildApplicationCommandsAsync({ .guildId = dataPackage.guildId });
 		snowflake commandId;
 		bool isItFound = false;
 		for (auto& value: appCommands) {
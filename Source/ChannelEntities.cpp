@@ -108,6 +108,9 @@ namespace discord_core_api {
 		if (other.memberCount != 0) {
 			memberCount = other.memberCount;
 		}
+		if (other.bitrate != 0) {
+			bitrate = other.bitrate;
+		}
 		if (other.parentId != 0) {
 			parentId = other.parentId;
 		}
@@ -149,6 +152,9 @@ namespace discord_core_api {
 		if (other.memberCount != 0) {
 			memberCount = other.memberCount;
 		}
+		if (other.bitrate != 0) {
+			bitrate = other.bitrate;
+		}
 		if (other.topic != "") {
 			topic = std::move(other.topic);
 		}
@@ -182,6 +188,7 @@ namespace discord_core_api {
 		returnData.topic				= topic;
 		returnData.name					= name;
 		returnData.memberCount			= memberCount;
+		returnData.bitrate				= bitrate;
 		returnData.parentId				= parentId;
 		returnData.position				= position;
 		returnData.guildId				= guildId;
@@ -0,0 +1,527 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ClusterCoordinator.cpp - Source file for the multi-process shard cluster.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file ClusterCoordinator.cpp
+
+#include <discordcoreapi/Utilities/ClusterCoordinator.hpp>
+#include <discordcoreapi/GuildMemberEntities.hpp>
+#include <discordcoreapi/GuildEntities.hpp>
+#include <charconv>
+#include <cstring>
+#include <cstdio>
+
+#if defined(_WIN32)
+	#include <afunix.h>
+#else
+	#include <sys/un.h>
+#endif
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+#if defined(MSG_NOSIGNAL)
+		static constexpr int32_t sendFlags{ MSG_NOSIGNAL };
+#else
+		static constexpr int32_t sendFlags{};
+#endif
+
+		static constexpr uint64_t receiveSize{ 16384 };
+
+		/// Splits the next space-separated token off of the front of a line.
+		static jsonifier::string_view nextToken(jsonifier::string_view& line) {
+			uint64_t end{ std::min(line.find(" "), line.size()) };
+			jsonifier::string_view returnData{ line.substr(0, end) };
+			line = line.substr(std::min(end + 1, line.size()));
+			return returnData;
+		}
+
+		static uint64_t parseNumber(jsonifier::string_view value) {
+			uint64_t returnData{};
+			std::from_chars(value.data(), value.data() + value.size(), returnData);
+			return returnData;
+		}
+
+		static bool makeSocketAddress(jsonifier::string_view path, sockaddr_un& address) {
+			address.sun_family = AF_UNIX;
+			if (path.size() >= sizeof(address.sun_path)) {
+				message_printer::printError<print_message_type::general>("The cluster's socket path is too long: " + path);
+				return false;
+			}
+			std::memcpy(address.sun_path, path.data(), path.size());
+			address.sun_path[path.size()] = '\0';
+			return true;
+		}
+
+		/// Reads whatever is waiting on a socket, and hands each complete line to the handler.
+		template<typename function_type> static bool receiveLines(SOCKET socket, jsonifier::string& buffer, uint64_t maxLineSize, function_type&& handler) {
+			uint64_t oldSize{ buffer.size() };
+			buffer.resize(oldSize + receiveSize);
+			auto bytesRead = recv(socket, buffer.data() + oldSize, static_cast<int32_t>(receiveSize), 0);
+			buffer.resize(oldSize + static_cast<uint64_t>(std::max(static_cast<int64_t>(bytesRead), int64_t{ 0 })));
+			if (bytesRead <= 0) {
+				return false;
+			}
+			uint64_t lineStart{};
+			for (uint64_t lineEnd = buffer.find("\n"); lineEnd != jsonifier::string::npos; lineEnd = buffer.find("\n", lineStart)) {
+				handler(jsonifier::string_view{ buffer.data() + lineStart, lineEnd - lineStart });
+				lineStart = lineEnd + 1;
+			}
+			buffer = buffer.substr(lineStart);
+			return buffer.size() <= maxLineSize;
+		}
+
+		cluster_coordinator::cluster_coordinator(jsonifier::string_view socketPathNew, uint64_t processCountNew, uint64_t totalShardsNew, uint64_t maxConcurrencyNew,
+			jsonifier::string_view gatewayUrlNew)
+			: socketPath{ socketPathNew }, gatewayUrl{ gatewayUrlNew } {
+			totalShards	   = std::max(totalShardsNew, uint64_t{ 1 });
+			maxConcurrency = std::max(maxConcurrencyNew, uint64_t{ 1 });
+			slotOwners.resize(std::clamp(processCountNew, uint64_t{ 1 }, totalShards));
+			nextIdentifyTimes.resize(maxConcurrency);
+			if (!startListening()) {
+				return;
+			}
+			worker = std::jthread{ [this](std::stop_token token) {
+				run(token);
+			} };
+			message_printer::printSuccess<print_message_type::general>("Coordinating " + jsonifier::toString(totalShards) + " shards across " +
+				jsonifier::toString(slotOwners.size()) + " processes, on " + socketPath + ".");
+		}
+
+		bool cluster_coordinator::isListening() {
+			return isValidSocket(listener.operator SOCKET());
+		}
+
+		bool cluster_coordinator::startListening() {
+			sockaddr_un address{};
+			if (!makeSocketAddress(socketPath, address)) {
+				return false;
+			}
+			// A socket file left behind by a coordinator that didn't shut down cleanly would make bind() fail.
+			std::remove(socketPath.data());
+
+			if (listener = ::socket(AF_UNIX, SOCK_STREAM, 0); !isValidSocket(listener.operator SOCKET())) {
+				message_printer::printError<print_message_type::general>(reportError("cluster_coordinator::socket(), on: " + socketPath));
+				listener = INVALID_SOCKET;
+				return false;
+			}
+
+			if (::bind(listener, reinterpret_cast<sockaddr*>(&address), static_cast<int32_t>(sizeof(address))) == SOCKET_ERROR) {
+				message_printer::printError<print_message_type::general>(reportError("cluster_coordinator::bind(), on: " + socketPath));
+				listener = INVALID_SOCKET;
+				return false;
+			}
+
+			if (::listen(listener, SOMAXCONN) == SOCKET_ERROR) {
+				message_printer::printError<print_message_type::general>(reportError("cluster_coordinator::listen(), on: " + socketPath));
+				listener = INVALID_SOCKET;
+				return false;
+			}
+			return true;
+		}
+
+		void cluster_coordinator::run(std::stop_token token) {
+			std::vector<uint64_t> connectionIds{};
+			std::vector<pollfd> readFds{};
+			while (!token.stop_requested()) {
+				readFds.clear();
+				connectionIds.clear();
+				pollfd listenerFd{};
+				listenerFd.fd	  = listener;
+				listenerFd.events = POLLIN;
+				readFds.emplace_back(listenerFd);
+				for (auto& [key, value]: connections) {
+					pollfd connectionFd{};
+					connectionFd.fd		= value.socket;
+					connectionFd.events = POLLIN;
+					readFds.emplace_back(connectionFd);
+					connectionIds.emplace_back(key);
+				}
+				if (poll(readFds.data(), static_cast<u_long>(readFds.size()), 100) <= 0) {
+					continue;
+				}
+				for (uint64_t x = 1; x < readFds.size(); ++x) {
+					if (readFds[x].revents & (POLLIN | POLLHUP | POLLERR | POLLNVAL) && connections.contains(connectionIds[x - 1]) &&
+						!readConnection(connectionIds[x - 1])) {
+						dropConnection(connectionIds[x - 1]);
+					}
+				}
+				if (readFds[0].revents & POLLIN) {
+					SOCKET socketNew{ ::accept(listener, nullptr, nullptr) };
+					if (isValidSocket(socketNew)) {
+						connections[nextConnectionId++].socket = socketNew;
+					}
+				}
+			}
+		}
+
+		bool cluster_coordinator::readConnection(uint64_t connectionId) {
+			auto& connection = connections[connectionId];
+			return receiveLines(connection.socket, connection.inputBuffer, maxLineSize, [&](jsonifier::string_view line) {
+				handleLine(connectionId, line);
+			});
+		}
+
+		void cluster_coordinator::handleLine(uint64_t connectionId, jsonifier::string_view line) {
+			jsonifier::string_view command{ nextToken(line) };
+			jsonifier::string_view requestId{ nextToken(line) };
+			if (command == "hello") {
+				auto& connection = connections[connectionId];
+				for (uint64_t x = 0; x < slotOwners.size() && connection.slot == std::numeric_limits<uint64_t>::max(); ++x) {
+					if (slotOwners[x] == 0) {
+						slotOwners[x]	= connectionId;
+						connection.slot = x;
+					}
+				}
+				uint64_t startingShard{}, shardCount{};
+				if (connection.slot != std::numeric_limits<uint64_t>::max()) {
+					startingShard = getSlotStart(connection.slot);
+					shardCount	  = getSlotStart(connection.slot + 1) - startingShard;
+					message_printer::printSuccess<print_message_type::general>("Handing shards " + jsonifier::toString(startingShard) + " to " +
+						jsonifier::toString(startingShard + shardCount - 1) + " to a cluster process.");
+				} else {
+					message_printer::printError<print_message_type::general>("A cluster process connected, but every slice of the shards is taken.");
+				}
+				sendLine(connectionId,
+					"assign " + requestId + " " + jsonifier::toString(startingShard) + " " + jsonifier::toString(shardCount) + " " + jsonifier::toString(totalShards) + " " +
+						jsonifier::toString(maxConcurrency) + " " + gatewayUrl);
+			} else if (command == "identify") {
+				auto& nextIdentifyTime = nextIdentifyTimes[parseNumber(nextToken(line)) % maxConcurrency];
+				hrclock::time_point now{ hrclock::now() };
+				bool mayIdentify{ now >= nextIdentifyTime };
+				if (mayIdentify) {
+					nextIdentifyTime = now + identifyInterval;
+				}
+				sendLine(connectionId, "identify " + requestId + (mayIdentify ? " 1" : " 0"));
+			} else if (command == "query") {
+				jsonifier::string_view arguments{ line };
+				uint64_t shardId{ (parseNumber(nextToken(line)) >> 22) % totalShards };
+				uint64_t slot{ slotOwners.size() - 1 };
+				while (slot > 0 && getSlotStart(slot) > shardId) {
+					--slot;
+				}
+				uint64_t ownerId{ slotOwners[slot] };
+				if (ownerId == 0 || !connections.contains(ownerId)) {
+					sendLine(connectionId, "result " + requestId + " ");
+					return;
+				}
+				uint64_t queryId{ nextQueryId++ };
+				routedQueries[queryId] = routed_query{ connectionId, parseNumber(requestId), ownerId };
+				sendLine(ownerId, "query " + jsonifier::toString(queryId) + " " + arguments);
+			} else if (command == "result") {
+				uint64_t queryId{ parseNumber(requestId) };
+				if (!routedQueries.contains(queryId)) {
+					return;
+				}
+				routed_query query{ routedQueries[queryId] };
+				routedQueries.erase(queryId);
+				if (connections.contains(query.connectionId)) {
+					sendLine(query.connectionId, "result " + jsonifier::toString(query.requestId) + " " + line);
+				}
+			}
+		}
+
+		void cluster_coordinator::sendLine(uint64_t connectionId, jsonifier::string_view line) {
+			jsonifier::string lineNew{ line };
+			lineNew.pushBack('\n');
+			SOCKET socketNew{ connections[connectionId].socket };
+			uint64_t bytesWritten{};
+			while (bytesWritten < lineNew.size()) {
+				auto result = send(socketNew, lineNew.data() + bytesWritten, static_cast<int32_t>(lineNew.size() - bytesWritten), sendFlags);
+				if (result <= 0) {
+					// The connection is dropped on its next poll, rather than here, since the caller may still be using it.
+					shutdown(socketNew, SHUT_RDWR);
+					return;
+				}
+				bytesWritten += static_cast<uint64_t>(result);
+			}
+		}
+
+		void cluster_coordinator::dropConnection(uint64_t connectionId) {
+			auto& connection = connections[connectionId];
+			if (connection.slot != std::numeric_limits<uint64_t>::max()) {
+				slotOwners[connection.slot] = 0;
+				message_printer::printError<print_message_type::general>("A cluster process disconnected, freeing shards " +
+					jsonifier::toString(getSlotStart(connection.slot)) + " to " + jsonifier::toString(getSlotStart(connection.slot + 1) - 1) + ".");
+			}
+			connections.erase(connectionId);
+			// Queries that were waiting on the process are answered empty, rather than left to time out.
+			std::vector<uint64_t> abandonedQueries{};
+			for (auto& [key, value]: routedQueries) {
+				if (value.ownerId == connectionId || value.connectionId == connectionId) {
+					abandonedQueries.emplace_back(key);
+				}
+			}
+			for (auto& value: abandonedQueries) {
+				routed_query query{ routedQueries[value] };
+				routedQueries.erase(value);
+				if (query.connectionId != connectionId && connections.contains(query.connectionId)) {
+					sendLine(query.connectionId, "result " + jsonifier::toString(query.requestId) + " ");
+				}
+			}
+		}
+
+		uint64_t cluster_coordinator::getSlotStart(uint64_t slot) {
+			return slot * totalShards / slotOwners.size();
+		}
+
+		cluster_coordinator::~cluster_coordinator() {
+			if (worker.joinable()) {
+				worker.request_stop();
+				worker.join();
+			}
+			if (isListening()) {
+				std::remove(socketPath.data());
+			}
+		}
+
+		cluster_client::cluster_client(jsonifier::string_view socketPathNew) : socketPath{ socketPathNew } {
+			registerQueryHandler("guild", [](snowflake guildId, jsonifier::string_view) {
+				jsonifier::string returnData{};
+				try {
+					guild_data data{ guilds::getCachedGuild({ .guildId = guildId }) };
+					parser.serializeJson(data, returnData);
+				} catch (const dca_exception& error) {
+					message_printer::printError<print_message_type::general>(error.what());
+				}
+				return returnData;
+			});
+			registerQueryHandler("guild_member", [](snowflake guildId, jsonifier::string_view argument) {
+				jsonifier::string returnData{};
+				try {
+					guild_member_data data{ guild_members::getCachedGuildMember({ .guildMemberId = parseNumber(argument), .guildId = guildId }) };
+					parser.serializeJson(data, returnData);
+				} catch (const dca_exception& error) {
+					message_printer::printError<print_message_type::general>(error.what());
+				}
+				return returnData;
+			});
+		}
+
+		bool cluster_client::connect(milliseconds timeout) {
+			sockaddr_un address{};
+			if (!makeSocketAddress(socketPath, address)) {
+				return false;
+			}
+			hrclock::time_point deadline{ hrclock::now() + timeout };
+			while (true) {
+				socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+				if (isValidSocket(socket.operator SOCKET()) &&
+					::connect(socket, reinterpret_cast<sockaddr*>(&address), static_cast<int32_t>(sizeof(address))) != SOCKET_ERROR) {
+					break;
+				}
+				socket = INVALID_SOCKET;
+				if (hrclock::now() >= deadline) {
+					message_printer::printError<print_message_type::general>(reportError("cluster_client::connect(), on: " + socketPath));
+					return false;
+				}
+				// The coordinator's process may still be starting up.
+				std::this_thread::sleep_for(250ms);
+			}
+			areWeConnected.store(true, std::memory_order_release);
+			readerThread = std::jthread{ [this](std::stop_token token) {
+				runReader(token);
+			} };
+			queryHandlerThread = std::jthread{ [this](std::stop_token token) {
+				runQueryHandlers(token);
+			} };
+			return true;
+		}
+
+		bool cluster_client::requestAssignment(cluster_assignment& assignmentNew) {
+			jsonifier::string response{ sendRequest("hello", "") };
+			jsonifier::string_view arguments{ response };
+			assignment.startingShard  = parseNumber(nextToken(arguments));
+			assignment.shardCount	  = parseNumber(nextToken(arguments));
+			assignment.totalShards	  = parseNumber(nextToken(arguments));
+			assignment.maxConcurrency = parseNumber(nextToken(arguments));
+			assignment.gatewayUrl	  = arguments;
+			assignmentNew			  = assignment;
+			return assignment.shardCount > 0;
+		}
+
+		bool cluster_client::tryAcquireIdentify(uint64_t shardId) {
+			if (!areWeConnected.load(std::memory_order_acquire)) {
+				return true;
+			}
+			std::unique_lock lock{ accessMutex };
+			if (auto iterator = identifyRequests.find(shardId); iterator != identifyRequests.end()) {
+				identify_request request{ iterator->second };
+				auto requestIterator = pendingRequests.find(request.requestId);
+				bool isItAnswered{ requestIterator != pendingRequests.end() && requestIterator->second.completed };
+				if (!isItAnswered && hrclock::now() - request.sentAt < requestTimeout) {
+					return false;
+				}
+				bool mayIdentify{ isItAnswered && requestIterator->second.response == "1" };
+				identifyRequests.erase(shardId);
+				pendingRequests.erase(request.requestId);
+				if (isItAnswered) {
+					return mayIdentify;
+				}
+				message_printer::printError<print_message_type::general>("The cluster's coordinator didn't answer an identify request in time, for shard " +
+					jsonifier::toString(shardId) + "... asking again.");
+			}
+			uint64_t requestId{ nextRequestId.fetch_add(1, std::memory_order_relaxed) };
+			pendingRequests.emplace(requestId, pending_request{});
+			identifyRequests.emplace(shardId, identify_request{ hrclock::now(), requestId });
+			lock.unlock();
+			sendLine("identify " + jsonifier::toString(requestId) + " " + jsonifier::toString(shardId));
+			return false;
+		}
+
+		jsonifier::string cluster_client::query(jsonifier::string_view name, snowflake guildId, jsonifier::string_view argument) {
+			uint64_t guildIdNew{ guildId.operator const uint64_t&() };
+			uint64_t shardId{ assignment.totalShards > 0 ? (guildIdNew >> 22) % assignment.totalShards : 0 };
+			if (assignment.totalShards == 0 || (shardId >= assignment.startingShard && shardId < assignment.startingShard + assignment.shardCount)) {
+				return runQuery(name, guildId, argument);
+			}
+			return sendRequest("query", jsonifier::toString(guildIdNew) + " " + name + " " + argument);
+		}
+
+		void cluster_client::registerQueryHandler(jsonifier::string_view name, query_handler handler) {
+			std::unique_lock lock{ handlersMutex };
+			queryHandlers[jsonifier::string{ name }] = std::move(handler);
+		}
+
+		jsonifier::string cluster_client::sendRequest(jsonifier::string_view command, jsonifier::string_view arguments) {
+			uint64_t requestId{ nextRequestId.fetch_add(1, std::memory_order_relaxed) };
+			std::unique_lock lock{ accessMutex };
+			pendingRequests.emplace(requestId, pending_request{});
+			lock.unlock();
+			jsonifier::string response{};
+			if (sendLine(jsonifier::string{ command } + " " + jsonifier::toString(requestId) + " " + arguments)) {
+				lock.lock();
+				if (!responseCondition.wait_for(lock, requestTimeout, [&] {
+						return pendingRequests.find(requestId)->second.completed;
+					})) {
+					message_printer::printError<print_message_type::general>("The cluster's coordinator didn't answer a " + command + " request in time.");
+				}
+				response = std::move(pendingRequests.find(requestId)->second.response);
+			} else {
+				lock.lock();
+			}
+			pendingRequests.erase(requestId);
+			return response;
+		}
+
+		bool cluster_client::sendLine(jsonifier::string_view line) {
+			jsonifier::string lineNew{ line };
+			lineNew.pushBack('\n');
+			std::unique_lock lock{ sendMutex };
+			uint64_t bytesWritten{};
+			while (bytesWritten < lineNew.size()) {
+				auto result = send(socket, lineNew.data() + bytesWritten, static_cast<int32_t>(lineNew.size() - bytesWritten), sendFlags);
+				if (result <= 0) {
+					message_printer::printError<print_message_type::general>(reportError("cluster_client::send(), on: " + socketPath));
+					return false;
+				}
+				bytesWritten += static_cast<uint64_t>(result);
+			}
+			return true;
+		}
+
+		void cluster_client::runReader(std::stop_token token) {
+			jsonifier::string buffer{};
+			while (!token.stop_requested()) {
+				pollfd readFd{};
+				readFd.fd	  = socket;
+				readFd.events = POLLIN;
+				if (poll(&readFd, 1, 100) <= 0) {
+					continue;
+				}
+				bool isItOpen{ receiveLines(socket, buffer, cluster_coordinator::maxLineSize, [&](jsonifier::string_view line) {
+					if (line.substr(0, line.find(" ")) == "query") {
+						std::unique_lock lock{ handlersMutex };
+						queries.emplace_back(line);
+						lock.unlock();
+						queryCondition.notify_one();
+						return;
+					}
+					nextToken(line);
+					uint64_t requestId{ parseNumber(nextToken(line)) };
+					std::unique_lock lock{ accessMutex };
+					if (auto iterator = pendingRequests.find(requestId); iterator != pendingRequests.end()) {
+						iterator->second.response  = line;
+						iterator->second.completed = true;
+						lock.unlock();
+						responseCondition.notify_all();
+					}
+				}) };
+				if (!isItOpen) {
+					message_printer::printError<print_message_type::general>("Lost the connection to the cluster's coordinator, on: " + socketPath +
+						" - shards will identify as this process's own buckets allow.");
+					areWeConnected.store(false, std::memory_order_release);
+					std::unique_lock lock{ accessMutex };
+					for (auto& [key, value]: pendingRequests) {
+						value.completed = true;
+					}
+					lock.unlock();
+					responseCondition.notify_all();
+					return;
+				}
+			}
+		}
+
+		void cluster_client::runQueryHandlers(std::stop_token token) {
+			while (!token.stop_requested()) {
+				std::unique_lock lock{ handlersMutex };
+				if (!queryCondition.wait(lock, token, [&] {
+						return queries.size() > 0;
+					})) {
+					return;
+				}
+				jsonifier::string line{ std::move(queries.front()) };
+				queries.pop_front();
+				lock.unlock();
+				jsonifier::string_view arguments{ line };
+				nextToken(arguments);
+				jsonifier::string_view queryId{ nextToken(arguments) };
+				snowflake guildId{ parseNumber(nextToken(arguments)) };
+				jsonifier::string_view name{ nextToken(arguments) };
+				sendLine("result " + queryId + " " + runQuery(name, guildId, arguments));
+			}
+		}
+
+		jsonifier::string cluster_client::runQuery(jsonifier::string_view name, snowflake guildId, jsonifier::string_view argument) {
+			std::unique_lock lock{ handlersMutex };
+			jsonifier::string nameNew{ name };
+			if (!queryHandlers.contains(nameNew)) {
+				return {};
+			}
+			query_handler handler{ queryHandlers[nameNew] };
+			lock.unlock();
+			return handler(guildId, argument);
+		}
+
+		cluster_client::~cluster_client() {
+			// The threads are stopped before the socket is closed underneath them.
+			queryHandlerThread = std::jthread{};
+			readerThread	   = std::jthread{};
+		}
+	}
+}
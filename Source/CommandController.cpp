@@ -30,19 +30,132 @@
 
 #include <discordcoreapi/CommandController.hpp>
 #include <discordcoreapi/DiscordCoreClient.hpp>
+#include <shared_mutex>
 
 namespace discord_core_api {
 
+	namespace discord_core_internal {
+
+		/// @brief A case-folded trie of every registered command name and alias, so that dispatch walks the name once instead of scanning every command.
+		class command_index {
+		  public:
+			inline command_index() {
+				nodes.emplace_back();
+			}
+
+			inline void insert(jsonifier::string_view name, base_function* function) {
+				uint64_t currentIndex{};
+				for (auto& value: name) {
+					const uint8_t byte{ foldByte(value) };
+					auto& children = nodes[currentIndex].children;
+					auto iterator  = std::lower_bound(children.begin(), children.end(), byte, compareChild);
+					if (iterator != children.end() && iterator->first == byte) {
+						currentIndex = iterator->second;
+					} else {
+						const uint64_t newIndex{ nodes.size() };
+						children.insert(iterator, std::make_pair(byte, newIndex));
+						nodes.emplace_back();
+						currentIndex = newIndex;
+					}
+				}
+				nodes[currentIndex].function = function;
+				nodes[currentIndex].name	 = convertToLowerCase(name);
+			}
+
+			/// @return the function registered under exactly this name or alias, ignoring case, or nullptr.
+			inline base_function* find(jsonifier::string_view name) const {
+				const uint64_t index{ findNode(name) };
+				return index == npos ? nullptr : nodes[index].function;
+			}
+
+			/// @brief Collects the names that start with a prefix, ignoring case, in alphabetical order.
+			inline jsonifier::vector<jsonifier::string> collectByPrefix(jsonifier::string_view prefix, uint64_t limit) const {
+				jsonifier::vector<jsonifier::string> returnData{};
+				const uint64_t index{ findNode(prefix) };
+				if (index == npos) {
+					return returnData;
+				}
+				jsonifier::vector<uint64_t> pendingNodes{};
+				pendingNodes.emplace_back(index);
+				while (pendingNodes.size() > 0 && returnData.size() < limit) {
+					const auto& currentNode = nodes[pendingNodes.back()];
+					pendingNodes.pop_back();
+					if (currentNode.function) {
+						returnData.emplace_back(currentNode.name);
+					}
+					for (auto iterator = currentNode.children.rbegin(); iterator != currentNode.children.rend(); ++iterator) {
+						pendingNodes.emplace_back(iterator->second);
+					}
+				}
+				return returnData;
+			}
+
+			inline void clear() {
+				nodes.clear();
+				nodes.emplace_back();
+			}
+
+		  protected:
+			struct node {
+				jsonifier::vector<std::pair<uint8_t, uint64_t>> children{};
+				base_function* function{};
+				jsonifier::string name{};
+			};
+
+			static constexpr uint64_t npos{ std::numeric_limits<uint64_t>::max() };
+
+			jsonifier::vector<node> nodes{};
+
+			inline static bool compareChild(const std::pair<uint8_t, uint64_t>& child, uint8_t byte) {
+				return child.first < byte;
+			}
+
+			inline static uint8_t foldByte(char value) {
+				return static_cast<uint8_t>(tolower(static_cast<uint8_t>(value)));
+			}
+
+			inline uint64_t findNode(jsonifier::string_view name) const {
+				uint64_t currentIndex{};
+				for (auto& value: name) {
+					const uint8_t byte{ foldByte(value) };
+					const auto& children = nodes[currentIndex].children;
+					auto iterator		 = std::lower_bound(children.begin(), children.end(), byte, compareChild);
+					if (iterator == children.end() || iterator->first != byte) {
+						return npos;
+					}
+					currentIndex = iterator->second;
+				}
+				return currentIndex;
+			}
+		};
+
+	}
+
 	unordered_map<jsonifier::vector<jsonifier::string>, unique_ptr<base_function>> functions{};
+	discord_core_internal::command_index commandIndex{};
+	std::shared_mutex commandIndexMutex{};
 
 	void command_controller::registerFunction(const jsonifier::vector<jsonifier::string>& functionNames, unique_ptr<base_function> baseFunction) {
+		std::unique_lock lock{ commandIndexMutex };
 		functions[functionNames] = std::move(baseFunction);
+		// Re-registering a name replaces its function, so the index is rebuilt rather than patched.
+		commandIndex.clear();
+		for (auto& [key, value]: functions) {
+			for (auto& valueNew: key) {
+				commandIndex.insert(valueNew, value.get());
+			}
+		}
 	}
 
 	unordered_map<jsonifier::vector<jsonifier::string>, unique_ptr<base_function>>& command_controller::getFunctions() {
 		return functions;
 	};
 
+	jsonifier::vector<jsonifier::string> command_controller::getCommandNamesByPrefix(jsonifier::string_view prefix, uint64_t limit) {
+		std::shared_lock lock{ commandIndexMutex };
+		return commandIndex.collectByPrefix(prefix, limit);
+	}
+
 	co_routine<void> command_controller::checkForAndRunCommand(command_data&& commandData) {
 		unique_ptr<base_function_arguments> theArgsNew{ makeUnique<base_function_arguments>(commandData) };
 		co_await newThreadAwaitable<void>();
@@ -56,33 +169,16 @@ namespace discord_core_api {
 	}
 
 	unique_ptr<base_function> command_controller::getCommand(jsonifier::string_view commandName) {
-		jsonifier::string functionName{};
-		bool isItFound{};
 		if (commandName.size() > 0) {
-			for (auto const& [keyFirst, value]: functions) {
-				for (auto& key: keyFirst) {
-					if (key.find(convertToLowerCase(commandName)) != jsonifier::string::npos) {
-						isItFound	 = true;
-						functionName = convertToLowerCase(commandName.substr(0, key.size()));
-						break;
-					}
-				}
-			}
-		}
-		if (isItFound) {
-			unique_ptr<base_function> newValue = createFunction(functionName);
-			return newValue;
+			return createFunction(commandName);
 		}
 		return nullptr;
 	}
 
 	unique_ptr<base_function> command_controller::createFunction(jsonifier::string_view functionName) {
-		for (auto& [key01, value01]: functions) {
-			for (auto& value02: key01) {
-				if (functionName == value02) {
-					return value01->create();
-				}
-			}
+		std::shared_lock lock{ commandIndexMutex };
+		if (auto function = commandIndex.find(functionName); function) {
+			return function->create();
 		}
 		return nullptr;
 	}
@@ -30,6 +30,8 @@
 
 #include <atomic>
 #include <csignal>
+#include <cstdio>
+#include <fstream>
 #include <discordcoreapi/CommandController.hpp>
 #include <discordcoreapi/DiscordCoreClient.hpp>
 
@@ -39,6 +41,7 @@ namespace discord_core_api {
 	sound_cloud_apimap soundCloudAPIMap{};
 	you_tube_apimap youtubeAPIMap{};
 	song_apimap songAPIMap{};
+	std::atomic_bool doWeSaveSessions{};
 	std::atomic_bool doWeQuit{};
 
 	discord_core_internal::sound_cloud_api& discord_core_client::getSoundCloudAPI(snowflake guildId) {
@@ -79,11 +82,18 @@ namespace discord_core_api {
 
 	void atexitHandler() noexcept {
 		doWeQuit.store(true, std::memory_order_release);
+		doWeQuit.notify_all();
 	}
 
 	void signalHandler(int32_t value) noexcept {
 		switch (value) {
 			case SIGTERM: {
+				if (doWeSaveSessions.load(std::memory_order_acquire)) {
+					// runBot() saves the shards' sessions on its way out.
+					doWeQuit.store(true, std::memory_order_release);
+					doWeQuit.notify_all();
+					return;
+				}
 				message_printer::printError<print_message_type::general>("SIGTERM ERROR.");
 				exit(EXIT_FAILURE);
 			}
@@ -92,6 +102,11 @@ namespace discord_core_api {
 				exit(EXIT_FAILURE);
 			}
 			case SIGINT: {
+				if (doWeSaveSessions.load(std::memory_order_acquire)) {
+					doWeQuit.store(true, std::memory_order_release);
+					doWeQuit.notify_all();
+					return;
+				}
 				message_printer::printError<print_message_type::general>("SIGINT ERROR.");
 				exit(EXIT_SUCCESS);
 			}
@@ -120,6 +135,7 @@ namespace discord_core_api {
 		std::signal(SIGABRT, &signalHandler);
 		std::signal(SIGFPE, &signalHandler);
 		message_printer::initialize(configManager);
+		doWeSaveSessions.store(configManager.doWeConnectToTheGateway() && configManager.getSessionStateFile() != "", std::memory_order_release);
 		if (!discord_core_internal::ssl_context_holder::initialize()) {
 			message_printer::printError<print_message_type::general>("Failed to initialize the SSL_CTX structure!");
 			return;
@@ -128,7 +144,8 @@ namespace discord_core_api {
 			message_printer::printError<print_message_type::general>("Lib_sodium failed to initialize!");
 			return;
 		}
-		httpsClient = makeUnique<discord_core_internal::https_client>(jsonifier::string{ configManager.getBotToken() });
+		httpsClient = makeUnique<discord_core_internal::https_client>(jsonifier::string{ configManager.getBotToken() }, configManager.getHttp2ConnectionCount(),
+			configManager.getThreadPlacementOptions().httpsCores);
 		application_commands::initialize(httpsClient.get());
 		auto_moderation_rules::initialize(httpsClient.get());
 		channels::initialize(httpsClient.get(), &configManager);
@@ -144,6 +161,16 @@ namespace discord_core_api {
 		threads::initialize(httpsClient.get());
 		web_hooks::initialize(httpsClient.get());
 		users::initialize(httpsClient.get(), &configManager);
+		gatewayEventExecutor =
+			makeUnique<discord_core_internal::gateway_event_executor>(configManager.getGatewayEventLaneCount(), &discord_core_internal::websocket_client::processDispatch);
+		guildMemberChunkRequester = makeUnique<discord_core_internal::guild_member_chunk_requester>();
+		if (configManager.getClusterOptions().socketPath != "") {
+			clusterClient = makeUnique<discord_core_internal::cluster_client>(configManager.getClusterOptions().socketPath);
+		}
+		if (configManager.getInteractionEndpointOptions().port != 0) {
+			interactionEndpoint = makeUnique<discord_core_internal::interaction_endpoint>(configManager.getInteractionEndpointOptions(),
+				configManager.getInteractionEndpointThreadCount(), httpsClient->getInteractionResponseLane(), *gatewayEventExecutor);
+		}
 	}
 
 	const config_manager& discord_core_client::getConfigManager() const {
@@ -156,16 +183,34 @@ namespace discord_core_api {
 
 	void discord_core_client::runBot() {
 		try {
-			if (!instantiateWebSockets()) {
-				doWeQuit.store(true, std::memory_order_release);
-				return;
-			}
-			while (getBotUser().id == 0) {
-				std::this_thread::sleep_for(1ms);
+			if (configManager.doWeConnectToTheGateway()) {
+				if (!instantiateWebSockets()) {
+					doWeQuit.store(true, std::memory_order_release);
+					doWeQuit.notify_all();
+					return;
+				}
+				// instantiateWebSockets() has already waited, on the startup scheduler, for every shard to be ready - but shards that resumed a saved
+				// session get no ready event to learn the bot's user from, so it's fetched over rest when none of them identified.
+				if (getBotUser().id == 0) {
+					user_data userData{ users::getCurrentUserAsync().get() };
+					currentUser = bot_user{ userData, baseSocketAgentsMap[0].get() };
+				}
+			} else {
+				if (!interactionEndpoint || !interactionEndpoint->isListening()) {
+					doWeQuit.store(true, std::memory_order_release);
+					doWeQuit.notify_all();
+					return;
+				}
+				// Without a ready event to learn it from, the bot's user is fetched over rest instead.
+				user_data userData{ users::getCurrentUserAsync().get() };
+				currentUser = bot_user{ userData, nullptr };
+				startFunctionsToExecute();
 			}
 			registerFunctionsInternal();
-			while (!doWeQuit.load(std::memory_order_acquire)) {
-				std::this_thread::sleep_for(1ms);
+			// Every store to doWeQuit notifies, so this sleeps until one of them.
+			doWeQuit.wait(false, std::memory_order_acquire);
+			if (doWeSaveSessions.load(std::memory_order_acquire)) {
+				saveSessionState();
 			}
 		} catch (const dca_exception& error) {
 			message_printer::printError<print_message_type::general>(error.what());
@@ -187,6 +232,32 @@ namespace discord_core_api {
 		return eventManager;
 	}
 
+	jsonifier::vector<gateway_lane_metrics> discord_core_client::getGatewayLaneMetrics() {
+		return gatewayEventExecutor ? gatewayEventExecutor->getLaneMetrics() : jsonifier::vector<gateway_lane_metrics>{};
+	}
+
+	interaction_response_metrics discord_core_client::getInteractionResponseMetrics() {
+		return httpsClient ? httpsClient->getInteractionResponseLane().getMetrics() : interaction_response_metrics{};
+	}
+
+	jsonifier::string discord_core_client::queryCluster(jsonifier::string_view name, snowflake guildId, jsonifier::string_view argument) {
+		return clusterClient ? clusterClient->query(name, guildId, argument) : jsonifier::string{};
+	}
+
+	void discord_core_client::registerClusterQueryHandler(jsonifier::string_view name, discord_core_internal::cluster_client::query_handler handler) {
+		if (clusterClient) {
+			clusterClient->registerQueryHandler(name, std::move(handler));
+		}
+	}
+
+	jsonifier::vector<cpu_core_data> discord_core_client::getCpuTopology() {
+		return discord_core_internal::getCpuTopology();
+	}
+
+	shard_startup_progress discord_core_client::getShardStartupProgress() {
+		return shardStartupScheduler ? shardStartupScheduler->getProgress() : shard_startup_progress{};
+	}
+
 	milliseconds discord_core_client::getTotalUpTime() {
 		return std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()) - startupTimeSinceEpoch;
 	}
@@ -252,19 +323,52 @@ namespace discord_core_api {
 		return data;
 	}
 
-	bool discord_core_client::instantiateWebSockets() {
-		gateway_bot_data gatewayData{};
-		try {
-			gatewayData = getGateWayBot();
-		} catch (const discord_core_internal::https_error& error) {
-			message_printer::printError<print_message_type::general>(error.what());
+	bool discord_core_client::joinCluster(gateway_bot_data& gatewayData) {
+		const cluster_options& clusterOptions{ configManager.getClusterOptions() };
+		if (clusterOptions.hostCoordinator) {
+			uint64_t totalShards{ std::max(configManager.getTotalShardCount(), static_cast<uint64_t>(gatewayData.shards)) };
+			clusterCoordinator = makeUnique<discord_core_internal::cluster_coordinator>(clusterOptions.socketPath, clusterOptions.processCount, totalShards,
+				gatewayData.sessionStartLimit.maxConcurrency, gatewayData.url);
+			if (!clusterCoordinator->isListening()) {
+				return false;
+			}
+		}
+		discord_core_internal::cluster_assignment assignment{};
+		if (!clusterClient->connect(30s)) {
 			return false;
 		}
+		if (!clusterClient->requestAssignment(assignment)) {
+			message_printer::printError<print_message_type::general>("The cluster's coordinator had no shards left for this process!");
+			return false;
+		}
+		configManager.setShardingOptions(sharding_options{ .numberOfShardsForThisProcess = static_cast<uint32_t>(assignment.shardCount),
+			.totalNumberOfShards = static_cast<uint32_t>(assignment.totalShards), .startingShard = static_cast<uint32_t>(assignment.startingShard) });
+		gatewayData.sessionStartLimit.maxConcurrency = static_cast<uint32_t>(assignment.maxConcurrency);
+		gatewayData.url								 = assignment.gatewayUrl;
+		message_printer::printSuccess<print_message_type::general>("Running shards " + jsonifier::toString(assignment.startingShard) + " to " +
+			jsonifier::toString(assignment.startingShard + assignment.shardCount - 1) + " of " + jsonifier::toString(assignment.totalShards) + ", as part of a cluster.");
+		return true;
+	}
 
-		if (gatewayData.url == "") {
-			message_printer::printError<print_message_type::general>("Failed to collect the connection url! closing! did you remember to "
-																	 "properly set your bot token?");
-			std::this_thread::sleep_for(5s);
+	bool discord_core_client::instantiateWebSockets() {
+		gateway_bot_data gatewayData{};
+		// In a cluster, only the coordinator's process asks discord for the gateway - the others are handed it along with their shards.
+		if (!clusterClient || configManager.getClusterOptions().hostCoordinator) {
+			try {
+				gatewayData = getGateWayBot();
+			} catch (const discord_core_internal::https_error& error) {
+				message_printer::printError<print_message_type::general>(error.what());
+				return false;
+			}
+
+			if (gatewayData.url == "") {
+				message_printer::printError<print_message_type::general>("Failed to collect the connection url! closing! did you remember to "
+																		 "properly set your bot token?");
+				std::this_thread::sleep_for(5s);
+				return false;
+			}
+		}
+		if (clusterClient && !joinCluster(gatewayData)) {
 			return false;
 		}
 		if (configManager.getStartingShard() + configManager.getShardCountForThisProcess() > configManager.getTotalShardCount()) {
@@ -272,8 +376,9 @@ namespace discord_core_api {
 			std::this_thread::sleep_for(5s);
 			return false;
 		}
-		uint64_t workerCount = configManager.getTotalShardCount() <= std::jthread::hardware_concurrency() ? configManager.getTotalShardCount()
-																										  : static_cast<uint64_t>(std::jthread::hardware_concurrency());
+		jsonifier::vector<uint32_t> shardCores{ configManager.getShardCores() };
+		uint64_t workerCount = std::clamp(configManager.getShardCountForThisProcess(), uint64_t{ 1 },
+			shardCores.size() > 0 ? static_cast<uint64_t>(shardCores.size()) : static_cast<uint64_t>(std::jthread::hardware_concurrency()));
 
 		if (configManager.getConnectionAddress() == "") {
 			configManager.setConnectionAddress(gatewayData.url.substr(gatewayData.url.find("wss://") + jsonifier::string{ "wss://" }.size()));
@@ -281,35 +386,144 @@ namespace discord_core_api {
 		if (configManager.getConnectionPort() == 0) {
 			configManager.setConnectionPort(443);
 		}
+		if (gatewayData.sessionStartLimit.total > 0 && gatewayData.sessionStartLimit.remaining < configManager.getTotalShardCount()) {
+			message_printer::printError<print_message_type::general>("Only " + jsonifier::toString(gatewayData.sessionStartLimit.remaining) +
+				" session starts remain, the limit resets in " + jsonifier::toString(gatewayData.sessionStartLimit.resetAfter) + "ms.");
+		}
 		areWeReadyToConnect.store(false, std::memory_order_release);
+		jsonifier::vector<uint64_t> shardIds{};
+		for (uint64_t x = configManager.getStartingShard(); x < configManager.getStartingShard() + configManager.getShardCountForThisProcess(); ++x) {
+			shardIds.emplace_back(x);
+		}
+		std::function<bool(uint64_t)> remoteAcquire{};
+		if (clusterClient) {
+			remoteAcquire = [this](uint64_t shardId) {
+				return clusterClient->tryAcquireIdentify(shardId);
+			};
+		}
+		shardStartupScheduler =
+			makeUnique<discord_core_internal::shard_startup_scheduler>(shardIds, gatewayData.sessionStartLimit.maxConcurrency, std::move(remoteAcquire));
 		baseSocketAgentsMap.reserve(workerCount);
-		for (uint64_t x = 0; x < configManager.getTotalShardCount(); ++x) {
-			if (baseSocketAgentsMap.size() < workerCount) {
-				baseSocketAgentsMap[x] = makeUnique<discord_core_internal::base_socket_agent>(&doWeQuit);
-				baseSocketAgentsMap[x]->shardMap.reserve(configManager.getTotalShardCount() / workerCount);
+		for (uint64_t x = 0; x < workerCount; ++x) {
+			baseSocketAgentsMap[x] = makeUnique<discord_core_internal::base_socket_agent>(&doWeQuit);
+			baseSocketAgentsMap[x]->shardMap.reserve(shardIds.size() / workerCount + 1);
+		}
+		if (shardCores.size() > 0) {
+			// Each agent gets a cpu of its own, and the gateway event lanes are split the same way, so that a shard's events are parsed beside its socket.
+			jsonifier::vector<uint32_t> agentCores{};
+			for (uint64_t x = 0; x < workerCount; ++x) {
+				jsonifier::vector<uint32_t> cpu{};
+				cpu.emplace_back(shardCores[x]);
+				if (!discord_core_internal::setThreadAffinity(baseSocketAgentsMap[x]->taskThread.native_handle(), cpu)) {
+					message_printer::printError<print_message_type::general>("Failed to pin websocket agent " + jsonifier::toString(x) + " to cpu " +
+						jsonifier::toString(shardCores[x]) + ".");
+				}
+				agentCores.emplace_back(shardCores[x]);
 			}
-			baseSocketAgentsMap[x % workerCount]->shardMap[x] = discord_core_internal::websocket_client{ x, &doWeQuit };
+			gatewayEventExecutor->placeLanes(agentCores, configManager.getTotalShardCount());
 		}
-		areWeReadyToConnect.store(true, std::memory_order_release);
-		while (!areWeFullyConnected()) {
-			std::this_thread::sleep_for(1ms);
+		for (auto& value: shardIds) {
+			baseSocketAgentsMap[value % workerCount]->shardMap[value] = discord_core_internal::websocket_client{ value, &doWeQuit };
 		}
-		for (auto& value: configManager.getFunctionsToExecute()) {
-			executeFunctionAfterTimePeriod(value.function, value.intervalInMs, value.repeated, false, this);
+		if (doWeSaveSessions.load(std::memory_order_acquire)) {
+			loadSessionState();
 		}
-		startupTimeSinceEpoch = std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch());
+		areWeReadyToConnect.store(true, std::memory_order_release);
+		shard_startup_progress progress{ shardStartupScheduler->getProgress() };
+		while (progress.readyShards < progress.totalShards) {
+			if (doWeQuit.load(std::memory_order_acquire)) {
+				return false;
+			}
+			progress = shardStartupScheduler->waitForProgress(progress.readyShards, 1000ms);
+		}
+		message_printer::printSuccess<print_message_type::general>(
+			"All " + jsonifier::toString(progress.totalShards) + " shards are ready, after " + jsonifier::toString(progress.elapsedTime.count()) + "ms.");
+		startFunctionsToExecute();
 		return true;
 	}
 
-	bool discord_core_client::areWeFullyConnected() {
+	void discord_core_client::loadSessionState() {
+		jsonifier::string fileContents{ loadFileContents(configManager.getSessionStateFile()) };
+		if (fileContents == "") {
+			return;
+		}
+		// A saved session can only be resumed once, so the file is removed as soon as it's read.
+		std::remove(configManager.getSessionStateFile().data());
+		discord_core_internal::session_state_data stateData{};
+		parser.parseJson(stateData, fileContents);
+		if (auto result = parser.getErrors(); result.size() > 0) {
+			for (auto& value: result) {
+				message_printer::printError<print_message_type::general>(value.reportError());
+			}
+			return;
+		}
+		uint64_t resumingCount{};
+		for (auto& value: stateData.shards) {
+			if (value.shardCount != configManager.getTotalShardCount() || value.sessionId == "" || value.resumeUrl == "") {
+				continue;
+			}
+			auto& agent = baseSocketAgentsMap[value.shardId % baseSocketAgentsMap.size()];
+			if (!agent->shardMap.contains(value.shardId)) {
+				continue;
+			}
+			auto& shard				 = agent->shardMap[value.shardId];
+			shard.lastNumberReceived = static_cast<uint32_t>(value.lastNumberReceived);
+			shard.sessionId			 = std::move(value.sessionId);
+			shard.resumeUrl			 = std::move(value.resumeUrl);
+			shard.areWeResuming		 = true;
+			++resumingCount;
+		}
+		message_printer::printSuccess<print_message_type::general>("Resuming " + jsonifier::toString(resumingCount) + " saved sessions, from " +
+			configManager.getSessionStateFile() + ".");
+	}
+
+	void discord_core_client::saveSessionState() {
+		discord_core_internal::session_state_data stateData{};
 		for (auto& [key, value]: baseSocketAgentsMap) {
+			// The agent's thread is stopped first, so that its shards can be read and closed from here.
+			value->taskThread.request_stop();
+			if (value->taskThread.joinable()) {
+				value->taskThread.join();
+			}
 			for (auto& [keyNew, valueNew]: value->shardMap) {
-				if (!valueNew.areWeConnected()) {
-					return false;
+				if (!valueNew.areWeConnected() || valueNew.sessionId == "" || valueNew.resumeUrl == "") {
+					continue;
 				}
+				discord_core_internal::shard_session_data sessionData{};
+				sessionData.lastNumberReceived = valueNew.lastNumberReceived;
+				sessionData.shardCount		   = valueNew.shard.at(1);
+				sessionData.shardId			   = valueNew.shard.at(0);
+				sessionData.sessionId		   = valueNew.sessionId;
+				sessionData.resumeUrl		   = valueNew.resumeUrl;
+				stateData.shards.emplace_back(std::move(sessionData));
+				valueNew.suspend();
 			}
 		}
-		return true;
+		jsonifier::string fileContents{};
+		parser.serializeJson(stateData, fileContents);
+		// Written to a temporary file first, and then renamed over the old one, so that a crash part way through can't leave a truncated file.
+		jsonifier::string tempPath{ configManager.getSessionStateFile() + ".tmp" };
+		{
+			std::ofstream file(tempPath.data(), std::ios::out | std::ios::binary | std::ios::trunc);
+			file.write(fileContents.data(), static_cast<std::streamsize>(fileContents.size()));
+			if (!file.good()) {
+				message_printer::printError<print_message_type::general>("Failed to write the session state to " + tempPath + ".");
+				return;
+			}
+		}
+		if (std::rename(tempPath.data(), configManager.getSessionStateFile().data()) != 0) {
+			message_printer::printError<print_message_type::general>("Failed to move the session state to " + configManager.getSessionStateFile() + ".");
+			return;
+		}
+		message_printer::printSuccess<print_message_type::general>("Saved " + jsonifier::toString(stateData.shards.size()) + " sessions to " +
+			configManager.getSessionStateFile() + ".");
+	}
+
+	void discord_core_client::startFunctionsToExecute() {
+		for (auto& value: configManager.getFunctionsToExecute()) {
+			executeFunctionAfterTimePeriod(value.function, value.intervalInMs, value.repeated, false, this);
+		}
+		startupTimeSinceEpoch = std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch());
 	}
 
 	discord_core_client::~discord_core_client() {
@@ -181,9 +181,9 @@ namespace jsonifier {
 
 namespace discord_core_api {
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<message_data>*> object_collector<message_data>::objectsBuffersMap;
+	template<> discord_core_internal::collector_registry<message_data> object_collector<message_data>::objectsRegistry;
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<reaction_data>*> object_collector<reaction_data>::objectsBuffersMap;
+	template<> discord_core_internal::collector_registry<reaction_data> object_collector<reaction_data>::objectsRegistry;
 
 	on_input_event_creation_data::on_input_event_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson<true>(*static_cast<event_data*>(this), dataToParse);
@@ -559,6 +559,29 @@ namespace discord_core_api {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
+		// A chunk carries up to 1000 members, so they're cached in one go rather than taking the cache's lock for each of them.
+		if (guild_members::doWeCacheGuildMembers() && value.guildId != 0) {
+			guild_members::insertGuildMembers(value.guildId, value.members);
+		}
+		if (guilds::doWeCacheGuilds() && guilds::getCache().contains(value.guildId)) {
+			// Members that are already listed - from the guild create, or an earlier request - aren't listed twice.
+			auto& guild{ guilds::getCache()[value.guildId] };
+			unordered_set<snowflake> memberIds{};
+			for (auto& valueNew: guild.members) {
+				memberIds.emplace(valueNew);
+			}
+			for (auto& valueNew: value.members) {
+				if (valueNew.user.id != 0 && !memberIds.contains(valueNew.user.id)) {
+					memberIds.emplace(valueNew.user.id);
+					guild.members.emplace_back(valueNew.user.id);
+				}
+			}
+		}
+		if (users::doWeCacheUsers()) {
+			users::insertUsers(value.members, [](const guild_member_data& valueNew) -> const user_data& {
+				return valueNew.user;
+			});
+		}
 	}
 
 	on_role_creation_data::on_role_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
@@ -728,12 +751,7 @@ namespace discord_core_api {
 					case component_type::Button: {
 						eventData->responseType	   = input_event_response_type::unset;
 						eventData->interactionData = makeUnique<interaction_data>(value);
-						if (button_collector::buttonInteractionBuffersMap.contains(
-								eventData->getChannelData().id.operator jsonifier::string() + eventData->getMessageData().id.operator jsonifier::string())) {
-							button_collector::buttonInteractionBuffersMap[eventData->getChannelData().id.operator jsonifier::string() +
-								eventData->getMessageData().id.operator jsonifier::string()]
-								->send(value);
-						}
+						button_collector::buttonInteractionRegistry.send(eventData->getMessageData().id, value);
 						button_collector::buttonInteractionEventsMap.operator()(*eventData->interactionData);
 						break;
 					}
@@ -748,12 +766,7 @@ namespace discord_core_api {
 					case component_type::String_Select: {
 						eventData->responseType		= input_event_response_type::unset;
 						eventData->interactionData = makeUnique<interaction_data>(value);
-						if (select_menu_collector::selectMenuInteractionBuffersMap.contains(
-								eventData->getChannelData().id.operator jsonifier::string() + eventData->getMessageData().id.operator jsonifier::string())) {
-							select_menu_collector::selectMenuInteractionBuffersMap[eventData->getChannelData().id.operator jsonifier::string() +
-								eventData->getMessageData().id.operator jsonifier::string()]
-								->send(value);
-						}
+						select_menu_collector::selectMenuInteractionRegistry.send(eventData->getMessageData().id, value);
 						select_menu_collector::selectMenuInteractionEventsMap.operator()(*eventData->interactionData);
 						break;
 					}
@@ -768,8 +781,7 @@ namespace discord_core_api {
 				eventData->interactionData = makeUnique<interaction_data>(value);
 				unique_ptr<on_input_event_creation_data> eventCreationData{ makeUnique<on_input_event_creation_data>(parser, dataToParse) };
 				eventCreationData->value = *eventData;
-				if (modal_collector::modalInteractionBuffersMap.contains(eventData->getChannelData().id.operator jsonifier::string())) {
-					modal_collector::modalInteractionBuffersMap[eventData->getChannelData().id.operator jsonifier::string()]->send(eventData->getInteractionData());
+				if (modal_collector::modalInteractionRegistry.send(eventData->getChannelData().id, eventData->getInteractionData())) {
 					modal_collector::modalInteractionEventsMap.operator()(*eventData->interactionData);
 				}
 				break;
@@ -813,9 +825,8 @@ namespace discord_core_api {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
-		for (auto& [key, valueNew]: message_collector::objectsBuffersMap) {
-			valueNew->send(value);
-		}
+		message_collector::objectsRegistry.send(value.channelId, value);
+		message_collector::objectsRegistry.send(snowflake{}, value);
 	}
 
 	on_message_update_data::on_message_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
@@ -825,9 +836,8 @@ namespace discord_core_api {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
-		for (auto& [key, valueNew]: message_collector::objectsBuffersMap) {
-			valueNew->send(value);
-		}
+		message_collector::objectsRegistry.send(value.channelId, value);
+		message_collector::objectsRegistry.send(snowflake{}, value);
 	}
 
 	on_message_deletion_data::on_message_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
@@ -855,9 +865,8 @@ namespace discord_core_api {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
-		for (auto& [key, valueNew]: reaction_collector::objectsBuffersMap) {
-			valueNew->send(value);
-		}
+		reaction_collector::objectsRegistry.send(value.channelId, value);
+		reaction_collector::objectsRegistry.send(snowflake{}, value);
 	}
 
 	on_reaction_remove_data::on_reaction_remove_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
@@ -142,6 +142,22 @@ namespace discord_core_api {
 		return data;
 	}
 
+	request_guild_members_payload::operator discord_core_internal::etf_serializer() {
+		discord_core_internal::etf_serializer data{};
+		data["guild_id"] = guildId.operator jsonifier::string();
+		if (userIds.size() > 0) {
+			for (auto& value: userIds) {
+				data["user_ids"].emplaceBack(value.operator jsonifier::string());
+			}
+		} else {
+			data["query"] = query;
+			data["limit"] = limit;
+		}
+		data["presences"] = presences;
+		data["nonce"]	  = nonce;
+		return data;
+	}
+
 	voice_state_data_light guild_member_data::getVoiceStateData() {
 		return guild_members::getVoiceStateData(*this);
 	}
@@ -0,0 +1,124 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GuildMemberChunkRequester.cpp - Source file for requesting guild members over the gateway.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file GuildMemberChunkRequester.cpp
+
+#include <discordcoreapi/Utilities/GuildMemberChunkRequester.hpp>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		collector_channel_ptr<request_guild_members_result> guild_member_chunk_requester::submit(const request_guild_members_data& dataPackage, uint64_t shardId,
+			jsonifier::string& nonce) {
+			request_guild_members_payload payload{};
+			payload.presences = dataPackage.presences;
+			payload.guildId	  = dataPackage.guildId;
+			payload.userIds	  = dataPackage.userIds;
+			payload.query	  = dataPackage.query;
+			payload.limit	  = dataPackage.limit;
+			std::unique_lock lock{ accessMutex };
+			nonce		  = jsonifier::toString(++nextNonce);
+			payload.nonce = nonce;
+			auto& request{ pendingRequests[nonce] };
+			request.channel			= makeCollectorChannel<request_guild_members_result>();
+			request.result.guildId	= dataPackage.guildId;
+			shardQueues[shardId].requests.emplace_back(std::move(payload));
+			return request.channel;
+		}
+
+		bool guild_member_chunk_requester::tryPop(uint64_t shardId, request_guild_members_payload& payload) {
+			std::unique_lock lock{ accessMutex };
+			if (!shardQueues.contains(shardId)) {
+				return false;
+			}
+			auto& queue{ shardQueues[shardId] };
+			hrclock::time_point now{ hrclock::now() };
+			while (queue.sendTimes.size() > 0 && now - queue.sendTimes.front() >= requestWindow) {
+				queue.sendTimes.pop_front();
+			}
+			if (queue.requests.empty() || queue.sendTimes.size() >= requestsPerWindow) {
+				return false;
+			}
+			payload = std::move(queue.requests.front());
+			queue.requests.pop_front();
+			queue.sendTimes.emplace_back(now);
+			return true;
+		}
+
+		void guild_member_chunk_requester::requeueFront(uint64_t shardId, request_guild_members_payload&& payload) {
+			std::unique_lock lock{ accessMutex };
+			auto& queue{ shardQueues[shardId] };
+			if (queue.sendTimes.size() > 0) {
+				queue.sendTimes.pop_back();
+			}
+			// A request cancelled while it was out is dropped, rather than sent after all.
+			if (pendingRequests.contains(payload.nonce)) {
+				queue.requests.emplace_front(std::move(payload));
+			}
+		}
+
+		void guild_member_chunk_requester::onChunk(const guild_members_chunk_event_data& chunk) {
+			std::unique_lock lock{ accessMutex };
+			if (chunk.nonce == "" || !pendingRequests.contains(chunk.nonce)) {
+				return;
+			}
+			auto& request{ pendingRequests[chunk.nonce] };
+			request.result.memberCount += chunk.members.size();
+			++request.result.chunkCount;
+			for (auto& value: chunk.notFound) {
+				request.result.notFound.emplace_back(value);
+			}
+			if (request.result.chunkCount < chunk.chunkCount) {
+				return;
+			}
+			request.result.completed = true;
+			pending_request requestNew{ std::move(request) };
+			pendingRequests.erase(chunk.nonce);
+			lock.unlock();
+			requestNew.channel->send(requestNew.result);
+		}
+
+		bool guild_member_chunk_requester::cancel(jsonifier::string_view nonce, request_guild_members_result& result) {
+			std::unique_lock lock{ accessMutex };
+			jsonifier::string nonceNew{ nonce };
+			if (!pendingRequests.contains(nonceNew)) {
+				return false;
+			}
+			result = std::move(pendingRequests[nonceNew].result);
+			pendingRequests.erase(nonceNew);
+			for (auto& [key, value]: shardQueues) {
+				std::erase_if(value.requests, [&](const request_guild_members_payload& payload) {
+					return payload.nonce == nonceNew;
+				});
+			}
+			return true;
+		}
+
+	}
+}
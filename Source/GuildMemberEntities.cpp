@@ -168,6 +168,31 @@ namespace discord_core_api {
 		co_return data;
 	}
 
+	co_routine<jsonifier::vector<request_guild_members_result>> guild_members::requestGuildMembersAsync(jsonifier::vector<request_guild_members_data> dataPackages) {
+		co_await newThreadAwaitable<jsonifier::vector<request_guild_members_result>>();
+		auto& requester = *discord_core_client::getInstance()->guildMemberChunkRequester;
+		uint64_t totalShardCount{ discord_core_client::getInstance()->configManager.getTotalShardCount() };
+		jsonifier::vector<discord_core_internal::collector_channel_ptr<request_guild_members_result>> channels{};
+		jsonifier::vector<jsonifier::string> nonces{};
+		hrclock::time_point startTime{ hrclock::now() };
+		for (auto& value: dataPackages) {
+			jsonifier::string nonce{};
+			channels.emplace_back(requester.submit(value, (value.guildId.operator const uint64_t&() >> 22) % totalShardCount, nonce));
+			nonces.emplace_back(std::move(nonce));
+		}
+		jsonifier::vector<request_guild_members_result> returnData{};
+		for (uint64_t x = 0; x < dataPackages.size(); ++x) {
+			request_guild_members_result result{};
+			milliseconds remainingTime{ std::chrono::duration_cast<milliseconds>(startTime + milliseconds{ dataPackages[x].maxTimeInMs } - hrclock::now()) };
+			// A request that's cancelled after its last chunk has already been handed over still has its result waiting in the channel.
+			if (!co_await channels[x]->receive(result, remainingTime) && !requester.cancel(nonces[x], result)) {
+				co_await channels[x]->receive(result, milliseconds{});
+			}
+			returnData.emplace_back(std::move(result));
+		}
+		co_return returnData;
+	}
+
 	guild_member_cache_data guild_members::getCachedGuildMember(get_guild_member_data dataPackage) {
 		guild_member_cache_data data{};
 		data.user.id = dataPackage.guildMemberId;
@@ -334,7 +359,7 @@ namespace discord_core_api {
 				break;
 			}
 		}
-		guild_members::modifyGuildMemberAsync(dataPackage01).get();
+		co_await guild_members::modifyGuildMemberAsync(dataPackage01);
 		co_return guildMember;
 	}
 
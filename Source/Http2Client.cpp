@@ -0,0 +1,903 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// Http2Client.cpp - Source file for the http/2 rest transport.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file Http2Client.cpp
+
+#include <discordcoreapi/Utilities/Http2Client.hpp>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		constexpr std::array<std::pair<jsonifier::string_view, jsonifier::string_view>, hpack_table::staticTableSize> hpackStaticTable{ {
+			{ ":authority", "" }, { ":method", "GET" }, { ":method", "POST" }, { ":path", "/" }, { ":path", "/index.html" }, { ":scheme", "http" },
+			{ ":scheme", "https" }, { ":status", "200" }, { ":status", "204" }, { ":status", "206" }, { ":status", "304" }, { ":status", "400" }, { ":status", "404" },
+			{ ":status", "500" }, { "accept-charset", "" }, { "accept-encoding", "gzip, deflate" }, { "accept-language", "" }, { "accept-ranges", "" }, { "accept", "" },
+			{ "access-control-allow-origin", "" }, { "age", "" }, { "allow", "" }, { "authorization", "" }, { "cache-control", "" }, { "content-disposition", "" },
+			{ "content-encoding", "" }, { "content-language", "" }, { "content-length", "" }, { "content-location", "" }, { "content-range", "" },
+			{ "content-type", "" }, { "cookie", "" }, { "date", "" }, { "etag", "" }, { "expect", "" }, { "expires", "" }, { "from", "" }, { "host", "" },
+			{ "if-match", "" }, { "if-modified-since", "" }, { "if-none-match", "" }, { "if-range", "" }, { "if-unmodified-since", "" }, { "last-modified", "" },
+			{ "link", "" }, { "location", "" }, { "max-forwards", "" }, { "proxy-authenticate", "" }, { "proxy-authorization", "" }, { "range", "" }, { "referer", "" },
+			{ "refresh", "" }, { "retry-after", "" }, { "server", "" }, { "set-cookie", "" }, { "strict-transport-security", "" }, { "transfer-encoding", "" },
+			{ "user-agent", "" }, { "vary", "" }, { "via", "" }, { "www-authenticate", "" } } };
+
+		/// The length of each symbol's code in the hpack huffman code, with the end-of-string symbol last - the code is canonical, so the codes themselves
+		/// follow from their lengths.
+		constexpr std::array<uint8_t, 257> huffmanCodeLengths{ 13, 23, 28, 28, 28, 28, 28, 28, 28, 24, 30, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28, 28,
+			28, 28, 28, 6, 10, 10, 12, 13, 6, 8, 11, 10, 10, 8, 11, 8, 6, 6, 6, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 8, 15, 6, 12, 10, 13, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+			7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 7, 8, 13, 19, 13, 14, 6, 15, 5, 6, 5, 6, 5, 6, 6, 6, 5, 7, 7, 6, 6, 6, 5, 6, 7, 6, 5, 5, 6, 7, 7, 7, 7, 7, 15, 11, 14, 13, 28, 20, 22,
+			20, 20, 22, 22, 22, 23, 22, 23, 23, 23, 23, 23, 24, 23, 24, 24, 22, 23, 24, 23, 23, 23, 23, 21, 22, 23, 22, 23, 23, 24, 22, 21, 20, 22, 22, 23, 23, 21, 23, 22, 22,
+			24, 21, 22, 23, 23, 21, 21, 22, 21, 23, 22, 23, 23, 20, 22, 22, 22, 23, 22, 22, 23, 26, 26, 20, 19, 22, 23, 22, 25, 26, 26, 26, 27, 27, 26, 24, 25, 19, 21, 26, 27,
+			27, 26, 27, 24, 21, 21, 26, 26, 28, 27, 27, 27, 20, 24, 20, 21, 22, 21, 21, 23, 22, 22, 25, 25, 24, 24, 26, 23, 26, 27, 26, 26, 27, 27, 27, 27, 27, 28, 27, 27, 27,
+			27, 27, 26, 30 };
+
+		constexpr jsonifier::string_view http2Preface{ "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n" };
+		constexpr jsonifier::string_view discordBaseUrl{ "https://discord.com/api/v10" };
+		constexpr uint64_t maxHuffmanCodeLength{ 30 };
+		constexpr uint16_t huffmanEndOfString{ 256 };
+		constexpr uint32_t protocolErrorCode{ 1 };
+		constexpr uint32_t refusedStreamCode{ 7 };
+		constexpr uint8_t endStreamFlag{ 0x1 };
+		constexpr uint8_t endHeadersFlag{ 0x4 };
+		constexpr uint8_t paddedFlag{ 0x8 };
+		constexpr uint8_t priorityFlag{ 0x20 };
+		constexpr uint8_t ackFlag{ 0x1 };
+
+		/// @brief The canonical huffman code, arranged for decoding a bit at a time - the codes of each length are consecutive, so a code is found by
+		/// checking it against the range of its length.
+		struct huffman_decode_table {
+			std::array<uint32_t, maxHuffmanCodeLength + 1> firstCode{};
+			std::array<uint32_t, maxHuffmanCodeLength + 1> firstIndex{};
+			std::array<uint32_t, maxHuffmanCodeLength + 1> count{};
+			std::array<uint16_t, 257> symbols{};
+
+			inline huffman_decode_table() {
+				for (uint64_t x = 0; x < huffmanCodeLengths.size(); ++x) {
+					++count[huffmanCodeLengths[x]];
+				}
+				uint32_t code{};
+				uint32_t index{};
+				for (uint64_t x = 1; x <= maxHuffmanCodeLength; ++x) {
+					firstCode[x]  = code;
+					firstIndex[x] = index;
+					code		  = (code + count[x]) << 1;
+					index += count[x];
+				}
+				std::array<uint32_t, maxHuffmanCodeLength + 1> nextIndex{ firstIndex };
+				for (uint64_t x = 0; x < huffmanCodeLengths.size(); ++x) {
+					symbols[nextIndex[huffmanCodeLengths[x]]++] = static_cast<uint16_t>(x);
+				}
+			}
+		};
+
+		const huffman_decode_table& getHuffmanDecodeTable() {
+			static const huffman_decode_table table{};
+			return table;
+		}
+
+		bool decodeHuffman(jsonifier::string_view input, jsonifier::string& output) {
+			const huffman_decode_table& table{ getHuffmanDecodeTable() };
+			uint32_t code{};
+			uint32_t length{};
+			for (uint64_t x = 0; x < input.size(); ++x) {
+				for (int32_t bit = 7; bit >= 0; --bit) {
+					code = (code << 1) | ((static_cast<uint8_t>(input[x]) >> bit) & 1u);
+					++length;
+					if (code >= table.firstCode[length] && code - table.firstCode[length] < table.count[length]) {
+						uint16_t symbol{ table.symbols[table.firstIndex[length] + code - table.firstCode[length]] };
+						if (symbol == huffmanEndOfString) {
+							return false;
+						}
+						output.push_back(static_cast<char>(symbol));
+						code   = 0;
+						length = 0;
+					} else if (length >= maxHuffmanCodeLength) {
+						return false;
+					}
+				}
+			}
+			// Whatever is left must be padding - fewer than eight bits, all set, as the start of the end-of-string code.
+			return length < 8 && code == (1u << length) - 1;
+		}
+
+		void encodeInteger(jsonifier::string& output, uint64_t value, uint8_t prefixBits, uint8_t flags) {
+			uint64_t maxPrefix{ (1ull << prefixBits) - 1 };
+			if (value < maxPrefix) {
+				output.push_back(static_cast<char>(flags | static_cast<uint8_t>(value)));
+				return;
+			}
+			output.push_back(static_cast<char>(flags | static_cast<uint8_t>(maxPrefix)));
+			value -= maxPrefix;
+			while (value >= 128) {
+				output.push_back(static_cast<char>((value & 127) | 128));
+				value >>= 7;
+			}
+			output.push_back(static_cast<char>(value));
+		}
+
+		bool decodeInteger(jsonifier::string_view input, uint64_t& offset, uint8_t prefixBits, uint64_t& value) {
+			if (offset >= input.size()) {
+				return false;
+			}
+			uint64_t maxPrefix{ (1ull << prefixBits) - 1 };
+			value = static_cast<uint8_t>(input[offset++]) & maxPrefix;
+			if (value < maxPrefix) {
+				return true;
+			}
+			for (uint64_t shift = 0; shift <= 56; shift += 7) {
+				if (offset >= input.size()) {
+					return false;
+				}
+				uint8_t byte{ static_cast<uint8_t>(input[offset++]) };
+				value += static_cast<uint64_t>(byte & 127) << shift;
+				if (!(byte & 128)) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void encodeString(jsonifier::string& output, jsonifier::string_view value) {
+			encodeInteger(output, value.size(), 7, 0);
+			output += value;
+		}
+
+		bool decodeString(jsonifier::string_view input, uint64_t& offset, jsonifier::string& output) {
+			if (offset >= input.size()) {
+				return false;
+			}
+			bool huffmanCoded{ (static_cast<uint8_t>(input[offset]) & 0x80) != 0 };
+			uint64_t length{};
+			if (!decodeInteger(input, offset, 7, length) || length > input.size() - offset) {
+				return false;
+			}
+			jsonifier::string_view value{ input.substr(offset, length) };
+			offset += length;
+			output.clear();
+			if (huffmanCoded) {
+				return decodeHuffman(value, output);
+			}
+			output = value;
+			return true;
+		}
+
+		void appendUint32(jsonifier::string& output, uint32_t value) {
+			output.push_back(static_cast<char>(value >> 24));
+			output.push_back(static_cast<char>(value >> 16));
+			output.push_back(static_cast<char>(value >> 8));
+			output.push_back(static_cast<char>(value));
+		}
+
+		uint32_t readUint32(const char* data) {
+			return (static_cast<uint32_t>(static_cast<uint8_t>(data[0])) << 24) | (static_cast<uint32_t>(static_cast<uint8_t>(data[1])) << 16) |
+				(static_cast<uint32_t>(static_cast<uint8_t>(data[2])) << 8) | static_cast<uint32_t>(static_cast<uint8_t>(data[3]));
+		}
+
+		bool hpack_table::get(uint64_t index, jsonifier::string_view& name, jsonifier::string_view& value) const {
+			if (index == 0) {
+				return false;
+			} else if (index <= staticTableSize) {
+				name  = hpackStaticTable[index - 1].first;
+				value = hpackStaticTable[index - 1].second;
+				return true;
+			} else if (index - staticTableSize - 1 < entries.size()) {
+				const hpack_header& entry{ entries[index - staticTableSize - 1] };
+				name  = entry.name;
+				value = entry.value;
+				return true;
+			}
+			return false;
+		}
+
+		uint64_t hpack_table::find(jsonifier::string_view name, jsonifier::string_view value, bool& nameOnly) const {
+			uint64_t nameIndex{};
+			for (uint64_t x = 0; x < staticTableSize; ++x) {
+				if (hpackStaticTable[x].first == name) {
+					if (hpackStaticTable[x].second == value) {
+						nameOnly = false;
+						return x + 1;
+					} else if (nameIndex == 0) {
+						nameIndex = x + 1;
+					}
+				}
+			}
+			for (uint64_t x = 0; x < entries.size(); ++x) {
+				if (entries[x].name == name) {
+					if (entries[x].value == value) {
+						nameOnly = false;
+						return x + staticTableSize + 1;
+					} else if (nameIndex == 0) {
+						nameIndex = x + staticTableSize + 1;
+					}
+				}
+			}
+			nameOnly = true;
+			return nameIndex;
+		}
+
+		void hpack_table::insert(jsonifier::string_view name, jsonifier::string_view value) {
+			uint64_t entrySize{ name.size() + value.size() + entryOverhead };
+			if (entrySize > maxSize) {
+				entries.clear();
+				currentSize = 0;
+				return;
+			}
+			// The entry is copied out first, since its name may refer to an entry that's about to be evicted.
+			hpack_header entry{ static_cast<jsonifier::string>(value), static_cast<jsonifier::string>(name) };
+			evict(entrySize);
+			entries.emplace_front(std::move(entry));
+			currentSize += entrySize;
+		}
+
+		void hpack_table::setMaxSize(uint64_t maxSizeNew) {
+			maxSize = maxSizeNew;
+			evict(0);
+		}
+
+		uint64_t hpack_table::getMaxSize() const {
+			return maxSize;
+		}
+
+		void hpack_table::evict(uint64_t incomingSize) {
+			while (currentSize + incomingSize > maxSize && entries.size() > 0) {
+				currentSize -= entries.back().name.size() + entries.back().value.size() + entryOverhead;
+				entries.pop_back();
+			}
+		}
+
+		void hpack_encoder::beginBlock(jsonifier::string& output) {
+			if (sizeUpdatePending) {
+				encodeInteger(output, table.getMaxSize(), 5, 0x20);
+				sizeUpdatePending = false;
+			}
+		}
+
+		void hpack_encoder::encode(jsonifier::string& output, jsonifier::string_view name, jsonifier::string_view value, bool indexable) {
+			bool nameOnly{};
+			uint64_t index{ table.find(name, value, nameOnly) };
+			if (index > 0 && !nameOnly) {
+				encodeInteger(output, index, 7, 0x80);
+				return;
+			}
+			if (indexable) {
+				encodeInteger(output, index, 6, 0x40);
+			} else {
+				encodeInteger(output, index, 4, 0);
+			}
+			if (index == 0) {
+				encodeString(output, name);
+			}
+			encodeString(output, value);
+			if (indexable) {
+				table.insert(name, value);
+			}
+		}
+
+		void hpack_encoder::setMaxSize(uint64_t maxSizeNew) {
+			if (maxSizeNew < table.getMaxSize()) {
+				table.setMaxSize(maxSizeNew);
+				sizeUpdatePending = true;
+			}
+		}
+
+		bool hpack_decoder::decode(jsonifier::string_view block, jsonifier::vector<hpack_header>& headers) {
+			uint64_t offset{};
+			while (offset < block.size()) {
+				uint8_t byte{ static_cast<uint8_t>(block[offset]) };
+				uint64_t index{};
+				if (byte & 0x80) {
+					jsonifier::string_view name{};
+					jsonifier::string_view value{};
+					if (!decodeInteger(block, offset, 7, index) || !table.get(index, name, value)) {
+						return false;
+					}
+					headers.emplace_back(hpack_header{ static_cast<jsonifier::string>(value), static_cast<jsonifier::string>(name) });
+					continue;
+				} else if ((byte & 0xE0) == 0x20) {
+					// Our own SETTINGS_HEADER_TABLE_SIZE is left at the default, which caps the size the peer may ask for.
+					if (!decodeInteger(block, offset, 5, index) || index > hpack_table::defaultMaxSize) {
+						return false;
+					}
+					table.setMaxSize(index);
+					continue;
+				}
+				bool indexed{ (byte & 0x40) != 0 };
+				if (!decodeInteger(block, offset, indexed ? 6 : 4, index)) {
+					return false;
+				}
+				hpack_header header{};
+				if (index > 0) {
+					jsonifier::string_view name{};
+					jsonifier::string_view value{};
+					if (!table.get(index, name, value)) {
+						return false;
+					}
+					header.name = name;
+				} else if (!decodeString(block, offset, header.name)) {
+					return false;
+				}
+				if (!decodeString(block, offset, header.value)) {
+					return false;
+				}
+				if (indexed) {
+					table.insert(header.name, header.value);
+				}
+				headers.emplace_back(std::move(header));
+			}
+			return true;
+		}
+
+		http2_connection::http2_connection(const jsonifier::string& baseUrlNew, const uint16_t portNew)
+			: tcp_connection<http2_connection>{ baseUrlNew, portNew, jsonifier::string_view{ "\x02h2", 3 } } {
+			if (!isHttp2()) {
+				return;
+			}
+			outgoing = http2Preface;
+			jsonifier::string settings{};
+			// Server push is turned off, and each stream's window is opened wide, so that responses aren't held up waiting on window updates.
+			settings.push_back(0);
+			settings.push_back(2);
+			appendUint32(settings, 0);
+			settings.push_back(0);
+			settings.push_back(4);
+			appendUint32(settings, static_cast<uint32_t>(receiveWindowSize));
+			writeFrame(http2_frame_type::Settings, 0, 0, settings);
+			jsonifier::string windowUpdate{};
+			appendUint32(windowUpdate, static_cast<uint32_t>(receiveWindowSize - defaultWindowSize));
+			writeFrame(http2_frame_type::Window_Update, 0, 0, windowUpdate);
+		}
+
+		bool http2_connection::isHttp2() {
+			return alpnProtocol == "h2" && currentStatus == connection_status::NO_Error;
+		}
+
+		bool http2_connection::canOpenStream() {
+			return !goingAway && !protocolError && streams.size() < peerMaxConcurrentStreams && nextStreamId < (1u << 31);
+		}
+
+		bool http2_connection::isFinished() {
+			return protocolError || (goingAway && streams.size() == 0);
+		}
+
+		uint64_t http2_connection::getStreamCount() {
+			return streams.size();
+		}
+
+		void http2_connection::openStream(std::shared_ptr<http2_stream> stream) {
+			stream->id		   = nextStreamId;
+			stream->sendWindow = peerInitialWindowSize;
+			nextStreamId += 2;
+			jsonifier::string block{};
+			encoder.beginBlock(block);
+			for (auto& value: stream->headers) {
+				// The headers that repeat on every request are indexed - the path and the per-request headers are not, so they don't churn the table.
+				bool indexable{ value.name == ":authority" || value.name == "authorization" || value.name == "user-agent" || value.name == "content-type" };
+				encoder.encode(block, value.name, value.value, indexable);
+			}
+			bool hasContent{ stream->content.size() > 0 };
+			uint64_t offset{};
+			do {
+				uint64_t length{ std::min(block.size() - offset, peerMaxFrameSize) };
+				bool isLast{ offset + length == block.size() };
+				uint8_t flags{ static_cast<uint8_t>((isLast ? endHeadersFlag : 0) | (offset == 0 && !hasContent ? endStreamFlag : 0)) };
+				writeFrame(offset == 0 ? http2_frame_type::Headers : http2_frame_type::Continuation, flags, stream->id,
+					jsonifier::string_view{ block.data() + offset, length });
+				offset += length;
+			} while (offset < block.size());
+			streams.emplace(stream->id, stream);
+			if (hasContent) {
+				sendingStreams.emplace_back(stream->id);
+			}
+		}
+
+		void http2_connection::flushOutgoing() {
+			// Bodies are sent in turn, a frame at a time, as far as the connection's and each stream's send windows allow.
+			for (uint64_t x = 0; x < sendingStreams.size() && connectionSendWindow > 0;) {
+				auto iterator = streams.find(sendingStreams[x]);
+				if (iterator == streams.end()) {
+					sendingStreams.erase(sendingStreams.begin() + static_cast<int64_t>(x));
+					continue;
+				}
+				http2_stream& stream{ *iterator->second };
+				int64_t window{ std::min(stream.sendWindow, connectionSendWindow) };
+				if (window <= 0) {
+					++x;
+					continue;
+				}
+				uint64_t length{ std::min({ stream.content.size() - stream.contentOffset, static_cast<uint64_t>(window), peerMaxFrameSize }) };
+				bool isLast{ stream.contentOffset + length == stream.content.size() };
+				writeFrame(http2_frame_type::Data, isLast ? endStreamFlag : 0, stream.id, jsonifier::string_view{ stream.content.data() + stream.contentOffset, length });
+				stream.contentOffset += length;
+				stream.sendWindow -= static_cast<int64_t>(length);
+				connectionSendWindow -= static_cast<int64_t>(length);
+				if (isLast) {
+					sendingStreams.erase(sendingStreams.begin() + static_cast<int64_t>(x));
+				}
+			}
+			// The output buffer overwrites its oldest slice once it's full, so it's only fed while it has room.
+			while (outgoingOffset < outgoing.size() && !outputBuffer.isItFull()) {
+				uint64_t length{ std::min(outgoing.size() - outgoingOffset, maxBufferSize - 1) };
+				outputBuffer.writeData(outgoing.data() + outgoingOffset, length);
+				outgoingOffset += length;
+			}
+			if (outgoingOffset == outgoing.size()) {
+				outgoing.clear();
+				outgoingOffset = 0;
+			}
+		}
+
+		void http2_connection::failStreams() {
+			jsonifier::vector<uint32_t> streamIds{};
+			for (auto& [key, value]: streams) {
+				streamIds.emplace_back(key);
+			}
+			for (auto& value: streamIds) {
+				completeStream(value, false);
+			}
+			sendingStreams.clear();
+		}
+
+		void http2_connection::handleBuffer() {
+			for (auto newData = getInputBuffer(); newData.size() > 0; newData = getInputBuffer()) {
+				inputBufferReal += newData;
+			}
+			uint64_t offset{};
+			while (!protocolError && inputBufferReal.size() - offset >= 9) {
+				const char* header{ inputBufferReal.data() + offset };
+				uint64_t length{ (static_cast<uint64_t>(static_cast<uint8_t>(header[0])) << 16) | (static_cast<uint64_t>(static_cast<uint8_t>(header[1])) << 8) |
+					static_cast<uint64_t>(static_cast<uint8_t>(header[2])) };
+				if (length > defaultFrameSize) {
+					failConnection(protocolErrorCode);
+					break;
+				}
+				if (inputBufferReal.size() - offset - 9 < length) {
+					break;
+				}
+				auto type = static_cast<http2_frame_type>(header[3]);
+				uint8_t flags{ static_cast<uint8_t>(header[4]) };
+				uint32_t streamId{ readUint32(header + 5) & 0x7FFFFFFF };
+				if (!processFrame(type, flags, streamId, jsonifier::string_view{ header + 9, length })) {
+					failConnection(protocolErrorCode);
+					break;
+				}
+				offset += 9 + length;
+			}
+			if (offset > 0) {
+				uint64_t leftover{ inputBufferReal.size() - offset };
+				if (leftover > 0) {
+					std::memmove(inputBufferReal.data(), inputBufferReal.data() + offset, leftover);
+				}
+				inputBufferReal.resize(leftover);
+			}
+		}
+
+		void http2_connection::writeFrame(http2_frame_type type, uint8_t flags, uint32_t streamId, jsonifier::string_view payload) {
+			outgoing.push_back(static_cast<char>(payload.size() >> 16));
+			outgoing.push_back(static_cast<char>(payload.size() >> 8));
+			outgoing.push_back(static_cast<char>(payload.size()));
+			outgoing.push_back(static_cast<char>(type));
+			outgoing.push_back(static_cast<char>(flags));
+			appendUint32(outgoing, streamId);
+			outgoing += payload;
+		}
+
+		bool http2_connection::processFrame(http2_frame_type type, uint8_t flags, uint32_t streamId, jsonifier::string_view payload) {
+			// A header block may only be followed by its own CONTINUATION frames.
+			if (headerStreamId != 0 && (type != http2_frame_type::Continuation || streamId != headerStreamId)) {
+				return false;
+			}
+			switch (type) {
+				case http2_frame_type::Data: {
+					if (streamId == 0) {
+						return false;
+					}
+					uint64_t padding{};
+					if (flags & paddedFlag) {
+						if (payload.size() < 1 || static_cast<uint8_t>(payload[0]) >= payload.size()) {
+							return false;
+						}
+						padding = static_cast<uint8_t>(payload[0]);
+						payload = payload.substr(1, payload.size() - 1 - padding);
+					}
+					// The whole frame counts against the windows, padding included.
+					uint64_t frameSize{ payload.size() + padding + ((flags & paddedFlag) ? 1 : 0) };
+					connectionReceivedSinceUpdate += frameSize;
+					if (connectionReceivedSinceUpdate >= receiveWindowSize / 2) {
+						jsonifier::string windowUpdate{};
+						appendUint32(windowUpdate, static_cast<uint32_t>(connectionReceivedSinceUpdate));
+						writeFrame(http2_frame_type::Window_Update, 0, 0, windowUpdate);
+						connectionReceivedSinceUpdate = 0;
+					}
+					auto iterator = streams.find(streamId);
+					if (iterator == streams.end()) {
+						return true;
+					}
+					http2_stream& stream{ *iterator->second };
+					stream.response.responseData += payload;
+					stream.receivedSinceUpdate += frameSize;
+					if (flags & endStreamFlag) {
+						stream.response.contentLength = stream.response.responseData.size();
+						completeStream(streamId, true);
+					} else if (stream.receivedSinceUpdate >= receiveWindowSize / 2) {
+						jsonifier::string windowUpdate{};
+						appendUint32(windowUpdate, static_cast<uint32_t>(stream.receivedSinceUpdate));
+						writeFrame(http2_frame_type::Window_Update, 0, streamId, windowUpdate);
+						stream.receivedSinceUpdate = 0;
+					}
+					return true;
+				}
+				case http2_frame_type::Headers: {
+					if (streamId == 0) {
+						return false;
+					}
+					uint64_t start{};
+					uint64_t padding{};
+					if (flags & paddedFlag) {
+						if (payload.size() < 1) {
+							return false;
+						}
+						padding = static_cast<uint8_t>(payload[0]);
+						start	= 1;
+					}
+					if (flags & priorityFlag) {
+						start += 5;
+					}
+					if (start + padding > payload.size()) {
+						return false;
+					}
+					headerBlock		= payload.substr(start, payload.size() - start - padding);
+					headerBlockEnds = (flags & endStreamFlag) != 0;
+					if (!(flags & endHeadersFlag)) {
+						headerStreamId = streamId;
+						return true;
+					}
+					return processHeaderBlock(streamId, headerBlockEnds);
+				}
+				case http2_frame_type::Continuation: {
+					if (headerStreamId == 0) {
+						return false;
+					}
+					headerBlock += payload;
+					if (flags & endHeadersFlag) {
+						headerStreamId = 0;
+						return processHeaderBlock(streamId, headerBlockEnds);
+					}
+					return true;
+				}
+				case http2_frame_type::Rst_Stream: {
+					if (streamId == 0 || payload.size() != 4) {
+						return false;
+					}
+					if (readUint32(payload.data()) == refusedStreamCode && streams.contains(streamId)) {
+						streams[streamId]->state.store(http2_stream_state::Refused, std::memory_order_release);
+					}
+					completeStream(streamId, false);
+					return true;
+				}
+				case http2_frame_type::Settings: {
+					return streamId == 0 && processSettings(flags, payload);
+				}
+				case http2_frame_type::Ping: {
+					if (streamId != 0 || payload.size() != 8) {
+						return false;
+					}
+					if (!(flags & ackFlag)) {
+						writeFrame(http2_frame_type::Ping, ackFlag, 0, payload);
+					}
+					return true;
+				}
+				case http2_frame_type::Goaway: {
+					if (streamId != 0 || payload.size() < 8) {
+						return false;
+					}
+					// Streams past the last one the server processed were never acted on - they fail, to be retried over http/1.1.
+					uint32_t lastStreamId{ readUint32(payload.data()) & 0x7FFFFFFF };
+					goingAway = true;
+					jsonifier::vector<uint32_t> streamIds{};
+					for (auto& [key, value]: streams) {
+						if (key > lastStreamId) {
+							value->state.store(http2_stream_state::Refused, std::memory_order_release);
+							streamIds.emplace_back(key);
+						}
+					}
+					for (auto& value: streamIds) {
+						completeStream(value, false);
+					}
+					return true;
+				}
+				case http2_frame_type::Window_Update: {
+					if (payload.size() != 4) {
+						return false;
+					}
+					int64_t increment{ static_cast<int64_t>(readUint32(payload.data()) & 0x7FFFFFFF) };
+					if (streamId == 0) {
+						connectionSendWindow += increment;
+					} else if (auto iterator = streams.find(streamId); iterator != streams.end()) {
+						iterator->second->sendWindow += increment;
+					}
+					return true;
+				}
+				case http2_frame_type::Push_Promise: {
+					// Push was turned off in our settings.
+					return false;
+				}
+				case http2_frame_type::Priority:
+					[[fallthrough]];
+				default: {
+					return true;
+				}
+			}
+		}
+
+		bool http2_connection::processHeaderBlock(uint32_t streamId, bool endsStream) {
+			jsonifier::vector<hpack_header> headers{};
+			// The block is decoded even if its stream is gone, since it still updates the dynamic table.
+			if (!decoder.decode(headerBlock, headers)) {
+				return false;
+			}
+			headerBlock.clear();
+			auto iterator = streams.find(streamId);
+			if (iterator == streams.end()) {
+				return true;
+			}
+			https_response_data& response{ iterator->second->response };
+			for (auto& value: headers) {
+				if (value.name == ":status") {
+					uint64_t code{ jsonifier::strToUint64(value.value.data()) };
+					// An informational response is followed by the real one.
+					if (code >= 100 && code < 200) {
+						return true;
+					}
+					response.responseCode = code;
+				} else if (value.name.size() > 0 && value.name[0] != ':') {
+					response.responseHeaders.emplace(value.name, value.value);
+				}
+			}
+			if (endsStream) {
+				completeStream(streamId, true);
+			}
+			return true;
+		}
+
+		bool http2_connection::processSettings(uint8_t flags, jsonifier::string_view payload) {
+			if (flags & ackFlag) {
+				return payload.size() == 0;
+			}
+			if (payload.size() % 6 != 0) {
+				return false;
+			}
+			for (uint64_t x = 0; x < payload.size(); x += 6) {
+				uint16_t identifier{ static_cast<uint16_t>((static_cast<uint8_t>(payload[x]) << 8) | static_cast<uint8_t>(payload[x + 1])) };
+				uint32_t value{ readUint32(payload.data() + x + 2) };
+				switch (identifier) {
+					case 1: {
+						encoder.setMaxSize(value);
+						break;
+					}
+					case 3: {
+						peerMaxConcurrentStreams = value;
+						break;
+					}
+					case 4: {
+						if (value > 0x7FFFFFFF) {
+							return false;
+						}
+						// A change to the initial window applies to every open stream, as a delta.
+						int64_t delta{ static_cast<int64_t>(value) - peerInitialWindowSize };
+						peerInitialWindowSize = value;
+						for (auto& [key, valueNew]: streams) {
+							valueNew->sendWindow += delta;
+						}
+						break;
+					}
+					case 5: {
+						if (value < defaultFrameSize || value > 0xFFFFFF) {
+							return false;
+						}
+						peerMaxFrameSize = value;
+						break;
+					}
+					default: {
+						break;
+					}
+				}
+			}
+			writeFrame(http2_frame_type::Settings, ackFlag, 0, jsonifier::string_view{});
+			return true;
+		}
+
+		void http2_connection::completeStream(uint32_t streamId, bool ended) {
+			if (auto iterator = streams.find(streamId); iterator != streams.end()) {
+				std::shared_ptr<http2_stream> stream{ iterator->second };
+				streams.erase(streamId);
+				// A stream that was reset, or cut off with its connection, fails - even if some of its response had arrived.
+				if (ended && stream->response.responseCode != std::numeric_limits<uint32_t>::max()) {
+					stream->response.currentState = https_state::complete;
+				}
+				stream->completed.release();
+			}
+		}
+
+		void http2_connection::failConnection(uint32_t errorCode) {
+			jsonifier::string goaway{};
+			appendUint32(goaway, nextStreamId > 1 ? nextStreamId - 2 : 0);
+			appendUint32(goaway, errorCode);
+			writeFrame(http2_frame_type::Goaway, 0, 0, goaway);
+			protocolError = true;
+		}
+
+		http2_session::http2_session(http2_client& clientNew, const jsonifier::vector<uint32_t>& cpus) : client{ &clientNew } {
+			worker = std::jthread{ [this](std::stop_token token) {
+				run(token);
+			} };
+			setThreadAffinity(worker.native_handle(), cpus);
+		}
+
+		void http2_session::submit(std::shared_ptr<http2_stream> stream) {
+			std::unique_lock lock{ accessMutex };
+			pending.emplace_back(std::move(stream));
+			lock.unlock();
+			workCondition.notify_one();
+		}
+
+		void http2_session::failPending() {
+			for (auto& value: pending) {
+				value->completed.release();
+			}
+			pending.clear();
+		}
+
+		void http2_session::run(std::stop_token token) {
+			while (!token.stop_requested()) {
+				std::unique_lock lock{ accessMutex };
+				if (!connection) {
+					if (!workCondition.wait(lock, token, [&] {
+							return pending.size() > 0;
+						})) {
+						return;
+					}
+					lock.unlock();
+					auto connectionNew = makeUnique<http2_connection>(static_cast<jsonifier::string>(discordBaseUrl), static_cast<uint16_t>(443));
+					lock.lock();
+					if (!connectionNew->isHttp2()) {
+						if (connectionNew->areWeStillConnected()) {
+							message_printer::printError<print_message_type::https>("The server didn't negotiate http/2 - falling back to http/1.1.");
+							client->unsupported.store(true, std::memory_order_release);
+						}
+						failPending();
+						continue;
+					}
+					connection = std::move(connectionNew);
+				}
+				while (pending.size() > 0 && connection->canOpenStream()) {
+					auto stream = std::move(pending.front());
+					pending.pop_front();
+					http2_stream_state expected{ http2_stream_state::Queued };
+					if (stream->state.compare_exchange_strong(expected, http2_stream_state::Opened, std::memory_order_acq_rel)) {
+						connection->openStream(std::move(stream));
+					}
+				}
+				if (connection->getStreamCount() == 0) {
+					// Idle - the connection is only serviced now and then, for its pings, until there's something to send.
+					workCondition.wait_for(lock, token, 100ms, [&] {
+						return pending.size() > 0;
+					});
+				}
+				lock.unlock();
+				connection->flushOutgoing();
+				auto status = connection->processIO(1);
+				if (status != connection_status::NO_Error || !connection->areWeStillConnected() || connection->isFinished()) {
+					connection->flushOutgoing();
+					connection->processIO(0);
+					connection->failStreams();
+					connection.reset();
+				}
+			}
+		}
+
+		http2_session::~http2_session() {
+			worker.request_stop();
+			if (worker.joinable()) {
+				worker.join();
+			}
+			if (connection) {
+				connection->failStreams();
+			}
+			failPending();
+		}
+
+		http2_client::http2_client(jsonifier::string_view botTokenNew, uint64_t connectionCount, const jsonifier::vector<uint32_t>& cpus) {
+			authorization = "Bot " + static_cast<jsonifier::string>(botTokenNew);
+			for (uint64_t x = 0; x < std::max(connectionCount, uint64_t{ 1 }); ++x) {
+				sessions.emplace_back(makeUnique<http2_session>(*this, cpus));
+			}
+		}
+
+		http2_submit_result http2_client::submit(const https_workload_data& workload, https_response_data& response) {
+			if (unsupported.load(std::memory_order_acquire) || workload.baseUrl != discordBaseUrl) {
+				return http2_submit_result::Not_Sent;
+			}
+			auto stream = std::make_shared<http2_stream>();
+			switch (workload.workloadClass) {
+				case https_workload_class::Get: {
+					stream->headers.emplace_back(hpack_header{ "GET", ":method" });
+					break;
+				}
+				case https_workload_class::Put: {
+					stream->headers.emplace_back(hpack_header{ "PUT", ":method" });
+					break;
+				}
+				case https_workload_class::Post: {
+					stream->headers.emplace_back(hpack_header{ "POST", ":method" });
+					break;
+				}
+				case https_workload_class::Patch: {
+					stream->headers.emplace_back(hpack_header{ "PATCH", ":method" });
+					break;
+				}
+				case https_workload_class::Delete: {
+					stream->headers.emplace_back(hpack_header{ "DELETE", ":method" });
+					break;
+				}
+			}
+			stream->headers.emplace_back(hpack_header{ "https", ":scheme" });
+			stream->headers.emplace_back(hpack_header{ "discord.com", ":authority" });
+			stream->headers.emplace_back(hpack_header{ "/api/v10" + workload.relativePath, ":path" });
+			stream->headers.emplace_back(hpack_header{ authorization, "authorization" });
+			stream->headers.emplace_back(hpack_header{ static_cast<jsonifier::string>(https_client_core::userAgent), "user-agent" });
+			stream->headers.emplace_back(hpack_header{ workload.payloadType == payload_type::Multipart_Form ? "multipart/form-data; boundary=boundary25" : "application/json",
+				"content-type" });
+			for (auto& [key, value]: workload.headersToInsert) {
+				// Field names are lower case in http/2.
+				jsonifier::string name{ key };
+				for (auto& valueNew: name) {
+					valueNew = static_cast<char>(std::tolower(static_cast<uint8_t>(valueNew)));
+				}
+				stream->headers.emplace_back(hpack_header{ value, std::move(name) });
+			}
+			if (workload.workloadClass != https_workload_class::Get && workload.workloadClass != https_workload_class::Delete) {
+				stream->headers.emplace_back(hpack_header{ jsonifier::toString(workload.content.size()), "content-length" });
+				stream->content = workload.content;
+			}
+			std::shared_ptr<http2_stream> streamNew{ stream };
+			sessions[nextSession.fetch_add(1, std::memory_order_relaxed) % sessions.size()]->submit(std::move(streamNew));
+			if (!stream->completed.try_acquire_for(responseTimeout)) {
+				// A stream that no session has opened yet can still be taken back - once opened, the server may have acted on it.
+				http2_stream_state expected{ http2_stream_state::Queued };
+				return stream->state.compare_exchange_strong(expected, http2_stream_state::Abandoned, std::memory_order_acq_rel) ? http2_submit_result::Not_Sent
+																																: http2_submit_result::Failed;
+			}
+			if (stream->response.currentState != https_state::complete) {
+				auto state = stream->state.load(std::memory_order_acquire);
+				return (state == http2_stream_state::Queued || state == http2_stream_state::Refused) ? http2_submit_result::Not_Sent : http2_submit_result::Failed;
+			}
+			response = std::move(stream->response);
+			return http2_submit_result::Completed;
+		}
+	}
+}
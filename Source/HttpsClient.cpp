@@ -29,8 +29,11 @@
 /// \file HttpsClient.cpp
 
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <discordcoreapi/Utilities/Http2Client.hpp>
+#include <discordcoreapi/Utilities/TimerWheel.hpp>
 #include <discordcoreapi/CoRoutine.hpp>
 #include <discordcoreapi/DiscordCoreClient.hpp>
+#include <charconv>
 
 namespace discord_core_api {
 
@@ -40,75 +43,84 @@ namespace discord_core_api {
 			: tcp_connection<https_connection>{ baseUrlNew, portNew } {
 		}
 
-		jsonifier::vector<jsonifier::string_view> tokenize(jsonifier::string_view in, const char* sep = "\r\n") {
-			jsonifier::string_view::size_type b = 0;
-			jsonifier::vector<jsonifier::string_view> result{};
-
-			while ((b = in.findFirstNotOf(sep, b)) != jsonifier::string_view::npos) {
-				auto e = in.find(sep, b);
-				if (b + (e - b) > in.size()) {
-					break;
+		bool equalsIgnoreCase(jsonifier::string_view lhs, jsonifier::string_view rhs) {
+			if (lhs.size() != rhs.size()) {
+				return false;
+			}
+			for (uint64_t x = 0; x < lhs.size(); ++x) {
+				if (std::tolower(static_cast<uint8_t>(lhs[x])) != std::tolower(static_cast<uint8_t>(rhs[x]))) {
+					return false;
 				}
-				result.emplace_back(in.substr(b, e - b));
-				b = e;
 			}
-			return result;
+			return true;
 		}
 
-		uint64_t parseCode(jsonifier::string_view string) {
-			uint64_t start = string.find(' ');
-			if (start == jsonifier::string_view::npos) {
-				return 0;
+		jsonifier::string_view trimWhitespace(jsonifier::string_view value) {
+			while (value.size() > 0 && (value[0] == ' ' || value[0] == '\t')) {
+				value = value.substr(1);
 			}
+			while (value.size() > 0 && (value[value.size() - 1] == ' ' || value[value.size() - 1] == '\t')) {
+				value = value.substr(0, value.size() - 1);
+			}
+			return value;
+		}
 
-			while (std::isspace(string[start])) {
-				start++;
+		int32_t hexValue(char value) {
+			if (value >= '0' && value <= '9') {
+				return value - '0';
+			} else if (value >= 'a' && value <= 'f') {
+				return value - 'a' + 10;
+			} else if (value >= 'A' && value <= 'F') {
+				return value - 'A' + 10;
 			}
+			return -1;
+		}
+
+		bool https_response_headers::contains(jsonifier::string_view name) const {
+			return find(name) != nullptr;
+		}
 
-			uint64_t end = start;
-			while (std::isdigit(string[end])) {
-				end++;
+		jsonifier::string_view https_response_headers::at(jsonifier::string_view name) const {
+			if (auto entry = find(name); entry) {
+				return jsonifier::string_view{ block.data() + entry->valueOffset, entry->valueLength };
 			}
-			jsonifier::string_view codeStr = string.substr(start, end - start);
-			uint64_t code				   = jsonifier::strToUint64(codeStr.data());
-			return code;
+			return jsonifier::string_view{};
 		}
 
-		void https_connection::handleBuffer() {
-			stop_watch<milliseconds> stopWatch{ 9500 };
-			stopWatch.reset();
-			do {
-				inputBufferReal += getInputBuffer();
-				switch (data.currentState) {
-					case https_state::Collecting_Headers: {
-						if (!parseHeaders()) {
-							return;
-						}
-						break;
-					}
-					case https_state::Collecting_Contents: {
-						if (!parseContents()) {
-							return;
-						}
-						break;
-					}
-					case https_state::Collecting_Chunked_Contents: {
-						if (!parseChunk()) {
-							return;
-						}
-						break;
-					}
-					case https_state::complete: {
-						inputBufferReal.clear();
-						return;
-					}
+		uint64_t https_response_headers::size() const {
+			return entries.size();
+		}
+
+		const https_response_headers::header_entry* https_response_headers::find(jsonifier::string_view name) const {
+			for (auto& value: entries) {
+				if (equalsIgnoreCase(jsonifier::string_view{ block.data() + value.nameOffset, value.nameLength }, name)) {
+					return &value;
 				}
-			} while (inputBufferReal.size() > 0 && !stopWatch.hasTimeElapsed());
-			return;
+			}
+			return nullptr;
+		}
+
+		void https_response_headers::emplace(jsonifier::string_view name, jsonifier::string_view value) {
+			// Each header is laid out as it would be in an http/1.1 block, so that its value is followed by a line ending, as it would be there.
+			uint32_t nameOffset{ static_cast<uint32_t>(block.size()) };
+			block += name;
+			block += ": ";
+			uint32_t valueOffset{ static_cast<uint32_t>(block.size()) };
+			block += value;
+			block += "\r\n";
+			entries.emplace_back(header_entry{ valueOffset, static_cast<uint32_t>(value.size()), nameOffset, static_cast<uint32_t>(name.size()) });
+		}
+
+		void https_connection::handleBuffer() {
+			for (auto newData = getInputBuffer(); newData.size() > 0; newData = getInputBuffer()) {
+				inputBufferReal += newData;
+			}
+			parseResponse();
 		}
 
 		https_client_core::https_client_core(jsonifier::string_view botTokenNew) {
-			botToken = botTokenNew;
+			botToken	  = botTokenNew;
+			clientHeaders = "Authorization: Bot " + botToken + "\r\nUser-Agent: " + static_cast<jsonifier::string>(userAgent) + "\r\n";
 		}
 
 		void https_rnr_builder::updateRateLimitData(rate_limit_data& rateLimitData) {
@@ -131,169 +143,338 @@ namespace discord_core_api {
 
 		https_response_data https_rnr_builder::finalizeReturnValues(rate_limit_data& rateLimitData) {
 			auto connection{ static_cast<https_connection*>(this) };
-			if (connection->data.responseData.size() >= connection->data.contentLength && connection->data.contentLength > 0) {
-				connection->data.responseData = connection->data.responseData.substr(0, connection->data.contentLength);
-			} else {
-				auto pos1 = connection->data.responseData.findFirstOf('{');
-				auto pos2 = connection->data.responseData.findLastOf('}');
-				auto pos3 = connection->data.responseData.findFirstOf('[');
-				auto pos4 = connection->data.responseData.findLastOf(']');
-				if (pos1 != jsonifier::string_view::npos && pos2 != jsonifier::string_view::npos && pos1 < pos3) {
-					connection->data.responseData = connection->data.responseData.substr(pos1, pos2 + 1);
-				} else if (pos3 != jsonifier::string_view::npos && pos4 != jsonifier::string_view::npos) {
-					connection->data.responseData = connection->data.responseData.substr(pos3, pos4 + 1);
-				}
-			}
 			updateRateLimitData(rateLimitData);
 			return std::move(connection->data);
 		}
 
-		jsonifier::string https_rnr_builder::buildRequest(const https_workload_data& workload) {
-			jsonifier::string baseUrlNew{};
-			if (workload.baseUrl.find(".com") != jsonifier::string_view::npos) {
-				baseUrlNew = workload.baseUrl.substr(workload.baseUrl.find("https://") + jsonifier::string_view("https://").size(),
-					workload.baseUrl.find(".com") + jsonifier::string_view(".com").size() - jsonifier::string_view("https://").size());
-			} else if (workload.baseUrl.find(".org") != jsonifier::string_view::npos) {
-				baseUrlNew = workload.baseUrl.substr(workload.baseUrl.find("https://") + jsonifier::string_view("https://").size(),
-					workload.baseUrl.find(".org") + jsonifier::string_view(".org").size() - jsonifier::string_view("https://").size());
-			}
-			jsonifier::string returnString{};
-			if (workload.workloadClass == https_workload_class::Get || workload.workloadClass == https_workload_class::Delete) {
-				if (workload.workloadClass == https_workload_class::Get) {
-					returnString += "GET " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				} else if (workload.workloadClass == https_workload_class::Delete) {
-					returnString += "DELETE " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
+		constexpr jsonifier::string_view multipartContentType{ "Content-Type: multipart/form-data; boundary=boundary25\r\n" };
+		constexpr jsonifier::string_view jsonContentType{ "Content-Type: application/json\r\n" };
+		constexpr jsonifier::string_view discordBaseUrl{ "https://discord.com/api/v10" };
+		constexpr jsonifier::string_view contentLengthName{ "Content-Length: " };
+		constexpr jsonifier::string_view requestLineEnd{ " HTTP/1.1\r\n" };
+
+		void https_rnr_builder::buildRequestTemplate(jsonifier::string_view clientHeaders) {
+			auto connection{ static_cast<https_connection*>(this) };
+			const https_workload_data& workload{ connection->workload };
+			switch (workload.workloadClass) {
+				case https_workload_class::Get: {
+					requestPrefix = "GET ";
+					break;
 				}
-				for (auto& [key, value]: workload.headersToInsert) {
-					returnString += key + ": " + value + "\r\n";
+				case https_workload_class::Put: {
+					requestPrefix = "PUT ";
+					break;
 				}
-				returnString += "Pragma: no-cache\r\n";
-				returnString += "Connection: keep-alive\r\n";
-				returnString += "Host: " + baseUrlNew + "\r\n\r\n";
-			} else {
-				if (workload.workloadClass == https_workload_class::Patch) {
-					returnString += "PATCH " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				} else if (workload.workloadClass == https_workload_class::Post) {
-					returnString += "POST " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				} else if (workload.workloadClass == https_workload_class::Put) {
-					returnString = "PUT " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
+				case https_workload_class::Post: {
+					requestPrefix = "POST ";
+					break;
 				}
-				for (auto& [key, value]: workload.headersToInsert) {
-					returnString += key + ": " + value + "\r\n";
+				case https_workload_class::Patch: {
+					requestPrefix = "PATCH ";
+					break;
+				}
+				case https_workload_class::Delete: {
+					requestPrefix = "DELETE ";
+					break;
 				}
-				returnString += "Pragma: no-cache\r\n";
-				returnString += "Connection: keep-alive\r\n";
-				returnString += "Host: " + baseUrlNew + "\r\n";
-				returnString += "Content-Length: " + jsonifier::toString(workload.content.size()) + "\r\n\r\n";
-				returnString += workload.content;
 			}
-			return returnString;
+			requestPrefix += workload.baseUrl;
+			jsonifier::string_view host{ workload.baseUrl };
+			if (auto schemeEnd = host.find("://"); schemeEnd != jsonifier::string_view::npos) {
+				host = host.substr(schemeEnd + 3);
+			}
+			if (auto pathStart = host.find("/"); pathStart != jsonifier::string_view::npos) {
+				host = host.substr(0, pathStart);
+			}
+			requestHeaders = workload.baseUrl == discordBaseUrl ? static_cast<jsonifier::string>(clientHeaders) : jsonifier::string{};
+			requestHeaders += "Pragma: no-cache\r\nConnection: keep-alive\r\nHost: " + static_cast<jsonifier::string>(host) + "\r\n";
+			templateBaseUrl = workload.baseUrl;
+			templateClass	= workload.workloadClass;
 		}
 
-		bool https_rnr_builder::parseHeaders() {
+		void https_rnr_builder::writeRequest(jsonifier::string_view clientHeaders) {
 			auto connection{ static_cast<https_connection*>(this) };
-			jsonifier::string& stringViewNew = connection->inputBufferReal;
-			if (stringViewNew.find("\r\n\r\n") != jsonifier::string_view::npos) {
-				auto headers = tokenize(stringViewNew);
-				if (headers.size() && (headers.at(0).find("HTTP/1") != jsonifier::string_view::npos)) {
-					uint64_t parseCodeNew{};
-					try {
-						parseCodeNew = parseCode(headers.at(0));
-					} catch (const std::invalid_argument& error) {
-						message_printer::printError<print_message_type::https>(error.what());
-						connection->data.currentState = https_state::complete;
-					}
-					headers.erase(headers.begin());
-					if (headers.size() >= 3 && parseCodeNew) {
-						for (uint64_t x = 0; x < headers.size(); ++x) {
-							jsonifier::string_view::size_type sep = headers.at(x).find(": ");
-							if (sep != jsonifier::string_view::npos) {
-								jsonifier::string key		 = static_cast<jsonifier::string>(headers.at(x).substr(0, sep));
-								jsonifier::string_view value = headers.at(x).substr(sep + 2, headers.at(x).size());
-								for (auto& valueNew: key) {
-									valueNew = static_cast<char>(std::tolower(static_cast<int32_t>(valueNew)));
-								}
-								connection->data.responseHeaders.emplace(key, value);
-							}
-						}
-						if (connection->data.responseHeaders.contains("content-length")) {
-							connection->data.contentLength = jsonifier::strToUint64(connection->data.responseHeaders.at("content-length").data());
-						} else {
-							connection->data.contentLength = std::numeric_limits<uint32_t>::max();
-							connection->data.currentState  = https_state::Collecting_Chunked_Contents;
-						}
-						connection->data.isItChunked = false;
-						if (connection->data.responseHeaders.contains("transfer-encoding")) {
-							if (connection->data.responseHeaders.at("transfer-encoding").find("chunked") != jsonifier::string_view::npos) {
-								connection->data.isItChunked   = true;
-								connection->data.contentLength = 0;
-								connection->data.currentState  = https_state::Collecting_Chunked_Contents;
-							}
-						}
-						connection->data.responseCode = parseCodeNew;
-						if (connection->data.responseCode == 302) {
-							connection->workload.baseUrl = connection->data.responseHeaders.at("location");
-							connection->disconnect();
-							return false;
-						}
-						if (connection->data.responseCode != 200 && connection->data.responseCode != 201 && connection->data.responseCode != std::numeric_limits<uint32_t>::max()) {
-							connection->inputBufferReal.erase(connection->inputBufferReal.begin() + static_cast<int64_t>(stringViewNew.find("\r\n\r\n")) + 4);
-							connection->data.currentState = https_state::complete;
-							return true;
-						} else if (!connection->data.isItChunked) {
-							connection->data.currentState = https_state::Collecting_Contents;
-							connection->inputBufferReal.erase(connection->inputBufferReal.begin() + static_cast<int64_t>(stringViewNew.find("\r\n\r\n")) + 4);
-							return true;
-						} else {
-							connection->inputBufferReal.erase(connection->inputBufferReal.begin() + static_cast<int64_t>(stringViewNew.find("\r\n\r\n")) + 4);
-							return true;
-						}
+			const https_workload_data& workload{ connection->workload };
+			// The connection serves a single route, so its method and base url - and with them everything but the path, the extra headers and the
+			// body - rarely change between requests.
+			if (requestPrefix.empty() || templateClass != workload.workloadClass || templateBaseUrl != workload.baseUrl) {
+				buildRequestTemplate(clientHeaders);
+			}
+			bool hasBody{ workload.workloadClass != https_workload_class::Get && workload.workloadClass != https_workload_class::Delete };
+			jsonifier::string_view contentType{};
+			if (workload.baseUrl == discordBaseUrl) {
+				contentType = workload.payloadType == payload_type::Multipart_Form ? multipartContentType : jsonContentType;
+			}
+			std::array<char, 24> lengthDigits{};
+			uint64_t lengthSize{};
+			if (hasBody) {
+				auto lengthEnd = std::to_chars(lengthDigits.data(), lengthDigits.data() + lengthDigits.size(), workload.content.size()).ptr;
+				lengthSize	   = static_cast<uint64_t>(lengthEnd - lengthDigits.data());
+			}
+
+			uint64_t size{ requestPrefix.size() + workload.relativePath.size() + requestLineEnd.size() + requestHeaders.size() + contentType.size() + 2 };
+			for (auto& [key, value]: workload.headersToInsert) {
+				size += key.size() + value.size() + 4;
+			}
+			if (hasBody) {
+				size += contentLengthName.size() + lengthSize + 2 + workload.content.size();
+			}
+
+			auto writeParts = [&](auto output) {
+				auto append = [&](const char* data, uint64_t length) {
+					if (length > 0) {
+						std::memcpy(output, data, length);
+						output += length;
 					}
+				};
+				append(requestPrefix.data(), requestPrefix.size());
+				append(workload.relativePath.data(), workload.relativePath.size());
+				append(requestLineEnd.data(), requestLineEnd.size());
+				for (auto& [key, value]: workload.headersToInsert) {
+					append(key.data(), key.size());
+					append(": ", 2);
+					append(value.data(), value.size());
+					append("\r\n", 2);
 				}
-				return true;
+				append(requestHeaders.data(), requestHeaders.size());
+				append(contentType.data(), contentType.size());
+				if (hasBody) {
+					append(contentLengthName.data(), contentLengthName.size());
+					append(lengthDigits.data(), lengthSize);
+					append("\r\n", 2);
+				}
+				append("\r\n", 2);
+				if (hasBody) {
+					append(workload.content.data(), workload.content.size());
+				}
+			};
+
+			if (!connection->writeDataInPlace(size, writeParts)) {
+				requestBuffer.resize(size);
+				writeParts(requestBuffer.data());
+				connection->writeData(static_cast<jsonifier::string_view>(requestBuffer), true);
 			}
-			return false;
 		}
 
-		bool https_rnr_builder::parseChunk() {
+		void https_rnr_builder::parseResponse() {
 			auto connection{ static_cast<https_connection*>(this) };
-			jsonifier::string_view stringViewNew01{ connection->inputBufferReal };
-			if (auto finalPosition = stringViewNew01.find("\r\n0\r\n\r\n"); finalPosition != jsonifier::string_view::npos) {
-				uint64_t pos{ 0 };
-				while (pos < stringViewNew01.size()) {
-					uint64_t lineEnd = stringViewNew01.find("\r\n", pos);
-					if (lineEnd == jsonifier::string_view::npos) {
+			bool progressed{ true };
+			while (progressed) {
+				switch (connection->data.currentState) {
+					case https_state::Collecting_Headers: {
+						progressed = parseHeaders();
 						break;
 					}
+					case https_state::Collecting_Contents: {
+						progressed = parseContents();
+						break;
+					}
+					case https_state::Collecting_Chunked_Contents: {
+						progressed = parseChunk();
+						break;
+					}
+					case https_state::complete: {
+						progressed = false;
+						break;
+					}
+				}
+			}
+			// Past the headers, everything before the cursor has been decoded - what's left is at most a partial chunk-size or trailer line.
+			if (connection->data.currentState != https_state::Collecting_Headers && parseOffset > 0) {
+				uint64_t leftover{ connection->inputBufferReal.size() - parseOffset };
+				if (leftover > 0) {
+					std::memmove(connection->inputBufferReal.data(), connection->inputBufferReal.data() + parseOffset, leftover);
+				}
+				connection->inputBufferReal.resize(leftover);
+				parseOffset = 0;
+			}
+		}
 
-					jsonifier::string_view sizeLine{ stringViewNew01.data() + pos, lineEnd - pos };
-					uint64_t chunkSize = jsonifier::strToUint64<16>(static_cast<jsonifier::string>(sizeLine));
+		bool https_rnr_builder::finishOnClose() {
+			auto connection{ static_cast<https_connection*>(this) };
+			if (!readUntilClose || connection->data.currentState != https_state::Collecting_Contents) {
+				return false;
+			}
+			connection->data.currentState = https_state::complete;
+			return true;
+		}
 
-					if (chunkSize == 0) {
-						break;
+		void https_rnr_builder::resetParser() {
+			chunkState		 = chunk_state::Size;
+			readUntilClose	 = false;
+			headerScanOffset = 0;
+			parseOffset		 = 0;
+			remaining		 = 0;
+		}
+
+		bool https_rnr_builder::parseHeaders() {
+			auto connection{ static_cast<https_connection*>(this) };
+			jsonifier::string_view stringViewNew{ connection->inputBufferReal };
+			// Only what arrived since the last call is searched, backing up far enough to catch a terminator that was split across two reads.
+			uint64_t headerEnd{ stringViewNew.find("\r\n\r\n", headerScanOffset >= 3 ? headerScanOffset - 3 : 0) };
+			if (headerEnd == jsonifier::string_view::npos) {
+				headerScanOffset = stringViewNew.size();
+				return false;
+			}
+			parseOffset = headerEnd + 4;
+			if (!parseHeaderBlock(stringViewNew.substr(0, parseOffset))) {
+				message_printer::printError<print_message_type::https>("Received a malformed response from: " + connection->workload.baseUrl);
+				connection->data.currentState = https_state::complete;
+				connection->disconnect();
+				return false;
+			}
+			if (connection->data.responseCode == 302) {
+				connection->workload.baseUrl = connection->data.responseHeaders.at("location");
+				connection->disconnect();
+				return false;
+			}
+			return true;
+		}
+
+		bool https_rnr_builder::parseHeaderBlock(jsonifier::string_view headerBlock) {
+			auto connection{ static_cast<https_connection*>(this) };
+			https_response_data& data{ connection->data };
+			uint64_t lineEnd{ headerBlock.find("\r\n") };
+			jsonifier::string_view statusLine{ headerBlock.substr(0, lineEnd) };
+			if (statusLine.size() < 12 || statusLine.substr(0, 7) != "HTTP/1.") {
+				return false;
+			}
+			uint64_t code{};
+			for (uint64_t x = 9; x < 12; ++x) {
+				if (statusLine[x] < '0' || statusLine[x] > '9') {
+					return false;
+				}
+				code = code * 10 + static_cast<uint64_t>(statusLine[x] - '0');
+			}
+
+			// The block is copied once, and every header is recorded as offsets into it.
+			data.responseHeaders.block = static_cast<jsonifier::string>(headerBlock);
+			data.responseHeaders.entries.clear();
+			data.contentLength = 0;
+			data.isItChunked   = false;
+			bool hasContentLength{};
+			for (uint64_t lineStart = lineEnd + 2; lineStart < headerBlock.size(); lineStart = lineEnd + 2) {
+				lineEnd = headerBlock.find("\r\n", lineStart);
+				if (lineEnd == jsonifier::string_view::npos || lineEnd == lineStart) {
+					break;
+				}
+				jsonifier::string_view line{ headerBlock.substr(lineStart, lineEnd - lineStart) };
+				uint64_t separator{ line.find(':') };
+				if (separator == jsonifier::string_view::npos) {
+					continue;
+				}
+				jsonifier::string_view name{ trimWhitespace(line.substr(0, separator)) };
+				jsonifier::string_view value{ trimWhitespace(line.substr(separator + 1)) };
+				data.responseHeaders.entries.emplace_back(https_response_headers::header_entry{ static_cast<uint32_t>(value.data() - headerBlock.data()),
+					static_cast<uint32_t>(value.size()), static_cast<uint32_t>(name.data() - headerBlock.data()), static_cast<uint32_t>(name.size()) });
+				if (equalsIgnoreCase(name, "content-length")) {
+					for (uint64_t x = 0; x < value.size() && value[x] >= '0' && value[x] <= '9'; ++x) {
+						data.contentLength = data.contentLength * 10 + static_cast<uint64_t>(value[x] - '0');
 					}
+					hasContentLength = true;
+				} else if (equalsIgnoreCase(name, "transfer-encoding")) {
+					data.isItChunked = value.find("chunked") != jsonifier::string_view::npos;
+				}
+			}
 
-					pos = lineEnd + 2;
+			data.responseCode = code;
+			chunkState		  = chunk_state::Size;
+			readUntilClose	  = false;
+			remaining		  = 0;
+			if ((code >= 100 && code < 200) || code == 204 || code == 304) {
+				data.currentState = https_state::complete;
+			} else if (data.isItChunked) {
+				data.currentState = https_state::Collecting_Chunked_Contents;
+			} else if (hasContentLength) {
+				remaining = data.contentLength;
+				data.responseData.reserve(data.contentLength);
+				data.currentState = remaining > 0 ? https_state::Collecting_Contents : https_state::complete;
+			} else {
+				readUntilClose	  = true;
+				data.currentState = https_state::Collecting_Contents;
+			}
+			return true;
+		}
 
-					jsonifier::string_view newString{ stringViewNew01.data() + pos, chunkSize };
-					connection->data.responseData += newString;
-					pos += chunkSize + 2;
+		bool https_rnr_builder::parseChunk() {
+			auto connection{ static_cast<https_connection*>(this) };
+			jsonifier::string_view stringViewNew{ connection->inputBufferReal };
+			switch (chunkState) {
+				case chunk_state::Size: {
+					uint64_t lineEnd{ stringViewNew.find("\r\n", parseOffset) };
+					if (lineEnd == jsonifier::string_view::npos) {
+						return false;
+					}
+					uint64_t chunkSize{};
+					uint64_t digitCount{};
+					// Anything after the hex digits is a chunk extension, which is ignored.
+					for (uint64_t x = parseOffset; x < lineEnd && hexValue(stringViewNew[x]) >= 0; ++x, ++digitCount) {
+						chunkSize = (chunkSize << 4) | static_cast<uint64_t>(hexValue(stringViewNew[x]));
+					}
+					if (digitCount == 0 || digitCount > 15) {
+						message_printer::printError<print_message_type::https>("Received a malformed chunk from: " + connection->workload.baseUrl);
+						connection->data.currentState = https_state::complete;
+						connection->disconnect();
+						return false;
+					}
+					parseOffset = lineEnd + 2;
+					remaining	= chunkSize;
+					chunkState	= chunkSize > 0 ? chunk_state::Data : chunk_state::Trailers;
+					return true;
+				}
+				case chunk_state::Data: {
+					uint64_t length{ std::min(stringViewNew.size() - parseOffset, remaining) };
+					if (length > 0) {
+						connection->data.responseData += stringViewNew.substr(parseOffset, length);
+						parseOffset += length;
+						remaining -= length;
+					}
+					if (remaining > 0) {
+						return false;
+					}
+					chunkState = chunk_state::Data_End;
+					return true;
+				}
+				case chunk_state::Data_End: {
+					if (stringViewNew.size() - parseOffset < 2) {
+						return false;
+					}
+					parseOffset += 2;
+					chunkState = chunk_state::Size;
+					return true;
+				}
+				case chunk_state::Trailers: {
+					uint64_t lineEnd{ stringViewNew.find("\r\n", parseOffset) };
+					if (lineEnd == jsonifier::string_view::npos) {
+						return false;
+					}
+					bool isLastLine{ lineEnd == parseOffset };
+					parseOffset = lineEnd + 2;
+					if (isLastLine) {
+						connection->data.currentState = https_state::complete;
+					}
+					return true;
 				}
-				connection->data.currentState = https_state::complete;
-				return true;
 			}
 			return false;
 		}
 
 		bool https_rnr_builder::parseContents() {
 			auto connection{ static_cast<https_connection*>(this) };
-			if (connection->inputBufferReal.size() >= connection->data.contentLength || !connection->data.contentLength) {
-				connection->data.responseData += jsonifier::string_view{ connection->inputBufferReal.data(), connection->data.contentLength };
+			uint64_t available{ connection->inputBufferReal.size() - parseOffset };
+			uint64_t length{ readUntilClose ? available : std::min(available, remaining) };
+			if (length > 0) {
+				connection->data.responseData += jsonifier::string_view{ connection->inputBufferReal.data() + parseOffset, length };
+				parseOffset += length;
+				if (!readUntilClose) {
+					remaining -= length;
+				}
+			}
+			if (!readUntilClose && remaining == 0) {
 				connection->data.currentState = https_state::complete;
 				return true;
-			} else {
-				return false;
 			}
+			return false;
 		}
 
 		bool https_connection::areWeConnected() {
@@ -317,6 +498,7 @@ namespace discord_core_api {
 			}
 			inputBufferReal.clear();
 			data = https_response_data{};
+			resetParser();
 		}
 
 		https_connection_manager::https_connection_manager(rate_limit_queue* rateLimitDataQueueNew) {
@@ -357,8 +539,272 @@ namespace discord_core_api {
 			return *connection;
 		}
 
-		https_client::https_client(jsonifier::string_view botTokenNew) : https_client_core(botTokenNew), connectionManager(&rateLimitQueue) {
+		https_client::https_client(jsonifier::string_view botTokenNew, uint64_t http2ConnectionCount, const jsonifier::vector<uint32_t>& cpus)
+			: https_client_core(botTokenNew), interactionResponseLane(*this, 2, cpus), connectionManager(&rateLimitQueue) {
 			rateLimitQueue.initialize();
+			if (http2ConnectionCount > 0) {
+				http2Client = makeUnique<http2_client>(botTokenNew, http2ConnectionCount, cpus);
+				http2Transport.store(http2Client.get(), std::memory_order_release);
+			}
+		}
+
+		https_client::~https_client() {
+			// The lane's workers send over http/2 - they're joined before the members that they use are torn down.
+			http2Transport.store(nullptr, std::memory_order_release);
+			interactionResponseLane.stop();
+		}
+
+		interaction_response_awaiter https_client::submitInteractionResponse(https_workload_data&& workload, snowflake interactionId) {
+			return interactionResponseLane.submit(std::move(workload), interactionId);
+		}
+
+		interaction_response_lane& https_client::getInteractionResponseLane() {
+			return interactionResponseLane;
+		}
+
+		interaction_response_awaiter::interaction_response_awaiter(interaction_response_lane& laneNew, https_workload_data&& workloadNew, snowflake interactionIdNew)
+			: lane{ &laneNew }, workload{ std::move(workloadNew) }, interactionId{ interactionIdNew } {
+		}
+
+		void interaction_response_awaiter::await_suspend(std::coroutine_handle<> coroHandleNew) {
+			waiter = coroHandleNew;
+			lane->enqueue(this);
+		}
+
+		https_response_data interaction_response_awaiter::await_resume() {
+			if (exception) {
+				std::rethrow_exception(exception);
+			}
+			return std::move(response);
+		}
+
+		interaction_response_lane::interaction_response_lane(https_client_core& clientNew, uint64_t connectionCount, const jsonifier::vector<uint32_t>& cpus)
+			: client{ &clientNew } {
+			for (uint64_t x = 0; x < std::max(connectionCount, uint64_t{ 1 }); ++x) {
+				workers.emplace_back([this](std::stop_token token) {
+					run(token);
+				});
+				setThreadAffinity(workers.back().native_handle(), cpus);
+			}
+		}
+
+		void interaction_response_lane::recordReceipt(snowflake interactionId, hrclock::time_point receivedAt) {
+			milliseconds untilWarning{ warningThreshold - std::chrono::duration_cast<milliseconds>(hrclock::now() - receivedAt) };
+			// The timer is scheduled under the lock, so that it can't fire before the receipt it looks for is recorded.
+			std::unique_lock lock{ accessMutex };
+			receipts[interactionId] = receipt_data{ receivedAt, timer_wheel_base::timerWheel.schedule(untilWarning, [this, interactionId] {
+				warnIfUnacknowledged(interactionId);
+			}) };
+		}
+
+		interaction_response_awaiter interaction_response_lane::submit(https_workload_data&& workload, snowflake interactionId) {
+			return interaction_response_awaiter{ *this, std::move(workload), interactionId };
+		}
+
+		interaction_response_metrics interaction_response_lane::getMetrics() {
+			std::unique_lock lock{ accessMutex };
+			interaction_response_metrics returnData{ metrics };
+			uint64_t trackedCount{ metrics.responsesSent - metrics.untracked };
+			returnData.averageLatency = trackedCount > 0 ? totalLatency / static_cast<int64_t>(trackedCount) : milliseconds{};
+			return returnData;
+		}
+
+		void interaction_response_lane::recordDeferral(snowflake interactionId) {
+			// Forgotten once the interaction's token expires, since nothing can respond to it after that.
+			std::unique_lock lock{ accessMutex };
+			deferrals[interactionId] = timer_wheel_base::timerWheel.schedule(tokenLifetime, [this, interactionId] {
+				std::unique_lock lock{ accessMutex };
+				deferrals.erase(interactionId);
+			});
+		}
+
+		bool interaction_response_lane::takeDeferral(snowflake interactionId) {
+			std::unique_lock lock{ accessMutex };
+			if (auto iterator = deferrals.find(interactionId); iterator != deferrals.end()) {
+				timer_wheel_base::timerWheel.cancel(iterator->second);
+				deferrals.erase(interactionId);
+				return true;
+			}
+			return false;
+		}
+
+		void interaction_response_lane::registerInlineReply(snowflake interactionId, inline_interaction_reply& reply) {
+			std::unique_lock lock{ accessMutex };
+			inlineReplies[interactionId] = &reply;
+		}
+
+		interaction_response_awaiter* interaction_response_lane::waitForInlineReply(snowflake interactionId, inline_interaction_reply& reply, milliseconds timeout) {
+			std::unique_lock lock{ accessMutex };
+			reply.condition.wait_for(lock, timeout, [&] {
+				return reply.response != nullptr;
+			});
+			inlineReplies.erase(interactionId);
+			return reply.response;
+		}
+
+		void interaction_response_lane::completeInlineReply(interaction_response_awaiter* response, bool sent) {
+			if (!sent) {
+				enqueue(response);
+				return;
+			}
+			std::unique_lock lock{ accessMutex };
+			hrclock::time_point receivedAt{};
+			uint64_t timerId{};
+			bool tracked{ takeReceipt(response->interactionId, receivedAt, timerId) };
+			lock.unlock();
+			if (tracked) {
+				timer_wheel_base::timerWheel.cancel(timerId);
+			}
+			response->response.responseCode = 204;
+			recordLatency(tracked, receivedAt);
+			new_thread_awaiter_base::threadPool.submitTask(response->waiter);
+		}
+
+		void interaction_response_lane::enqueue(interaction_response_awaiter* response) {
+			std::unique_lock lock{ accessMutex };
+			if (response->workload.getWorkloadType() == https_workload_type::Post_Interaction_Response) {
+				if (auto iterator = inlineReplies.find(response->interactionId); iterator != inlineReplies.end()) {
+					// The endpoint's worker is still holding the interaction's http request open - so the callback is written back on it instead.
+					iterator->second->response = response;
+					iterator->second->condition.notify_one();
+					inlineReplies.erase(response->interactionId);
+					return;
+				}
+			}
+			if (stopped) {
+				lock.unlock();
+				failResponse(response);
+				return;
+			}
+			responses.emplace_back(response);
+			lock.unlock();
+			workCondition.notify_one();
+		}
+
+		void interaction_response_lane::failResponse(interaction_response_awaiter* response) {
+			response->exception = std::make_exception_ptr(https_error{ "The interaction response lane was stopped before the response was sent." });
+			new_thread_awaiter_base::threadPool.submitTask(response->waiter);
+		}
+
+		void interaction_response_lane::warnIfUnacknowledged(snowflake interactionId) {
+			std::unique_lock lock{ accessMutex };
+			if (auto iterator = receipts.find(interactionId); iterator != receipts.end()) {
+				milliseconds elapsed{ std::chrono::duration_cast<milliseconds>(hrclock::now() - iterator->second.receivedAt) };
+				iterator->second.timerId = timer_wheel_base::timerWheel.schedule(responseDeadline - elapsed, [this, interactionId] {
+					expireReceipt(interactionId);
+				});
+				lock.unlock();
+				message_printer::printError<print_message_type::https>("Interaction " + interactionId + " hasn't been responded to after " +
+					jsonifier::toString(elapsed.count()) + "ms, of its " + jsonifier::toString(responseDeadline.count()) + "ms deadline.");
+			}
+		}
+
+		void interaction_response_lane::expireReceipt(snowflake interactionId) {
+			std::unique_lock lock{ accessMutex };
+			if (receipts.contains(interactionId)) {
+				receipts.erase(interactionId);
+				++metrics.unanswered;
+			}
+		}
+
+		bool interaction_response_lane::takeReceipt(snowflake interactionId, hrclock::time_point& receivedAt, uint64_t& timerId) {
+			if (auto iterator = receipts.find(interactionId); iterator != receipts.end()) {
+				receivedAt = iterator->second.receivedAt;
+				timerId	   = iterator->second.timerId;
+				receipts.erase(interactionId);
+				return true;
+			}
+			return false;
+		}
+
+		void interaction_response_lane::recordLatency(bool tracked, hrclock::time_point receivedAt) {
+			milliseconds latency{ std::chrono::duration_cast<milliseconds>(hrclock::now() - receivedAt) };
+			std::unique_lock lock{ accessMutex };
+			++metrics.responsesSent;
+			if (!tracked) {
+				++metrics.untracked;
+				return;
+			}
+			totalLatency += latency;
+			metrics.longestLatency = std::max(metrics.longestLatency, latency);
+			if (latency > responseDeadline) {
+				++metrics.missedDeadlines;
+			} else if (latency > warningThreshold) {
+				++metrics.nearMisses;
+			}
+		}
+
+		void interaction_response_lane::run(std::stop_token token) {
+			https_connection connection{};
+			rate_limit_data rateLimitData{};
+			while (!token.stop_requested()) {
+				std::unique_lock lock{ accessMutex };
+				if (!workCondition.wait(lock, token, [&] {
+						return responses.size() > 0;
+					})) {
+					return;
+				}
+				interaction_response_awaiter* response{ responses.front() };
+				responses.pop_front();
+				hrclock::time_point receivedAt{};
+				uint64_t timerId{};
+				bool tracked{ takeReceipt(response->interactionId, receivedAt, timerId) };
+				lock.unlock();
+				if (tracked) {
+					timer_wheel_base::timerWheel.cancel(timerId);
+				}
+				connection.currentReconnectTries = 0;
+				connection.resetValues(std::move(response->workload), &rateLimitData);
+				try {
+					https_response_data returnData{ client->httpsRequestInternal(connection) };
+					if (returnData.responseCode != 200 && returnData.responseCode != 204 && returnData.responseCode != 201) {
+						https_error theError{ connection.workload.callStack + " Https error: " + returnData.responseCode.operator jsonifier::string() +
+							"\nThe request: base url: " + connection.workload.baseUrl + "\nRelative Url: " + connection.workload.relativePath + "\nThe Response: " +
+							static_cast<jsonifier::string>(returnData.responseData) };
+						theError.errorCode	= returnData.responseCode;
+						response->exception = std::make_exception_ptr(theError);
+					} else {
+						message_printer::printSuccess<print_message_type::https>(
+							connection.workload.callStack + " success: " + static_cast<jsonifier::string>(returnData.responseCode) + ": " + returnData.responseData);
+						response->response = std::move(returnData);
+					}
+				} catch (...) {
+					response->exception = std::current_exception();
+				}
+				recordLatency(tracked, receivedAt);
+				new_thread_awaiter_base::threadPool.submitTask(response->waiter);
+			}
+		}
+
+		void interaction_response_lane::stop() {
+			for (auto& value: workers) {
+				value.request_stop();
+			}
+			for (auto& value: workers) {
+				if (value.joinable()) {
+					value.join();
+				}
+			}
+			// Nothing is left to send the queued responses, so their awaiters are resumed with an error rather than left suspended.
+			std::unique_lock lock{ accessMutex };
+			stopped = true;
+			std::deque<interaction_response_awaiter*> responsesNew{ std::move(responses) };
+			responses.clear();
+			lock.unlock();
+			for (auto& value: responsesNew) {
+				failResponse(value);
+			}
+		}
+
+		interaction_response_lane::~interaction_response_lane() {
+			stop();
+			std::unique_lock lock{ accessMutex };
+			for (auto& [key, value]: receipts) {
+				timer_wheel_base::timerWheel.cancel(value.timerId);
+			}
+			for (auto& [key, value]: deferrals) {
+				timer_wheel_base::timerWheel.cancel(value);
+			}
 		}
 
 		https_response_data https_client::httpsRequest(https_connection& connection) {
@@ -367,13 +813,21 @@ namespace discord_core_api {
 		}
 
 		https_response_data https_client_core::httpsRequestInternal(https_connection& connection) {
-			if (connection.workload.baseUrl == "https://discord.com/api/v10") {
-				connection.workload.headersToInsert.emplace("Authorization", "Bot " + botToken);
-				connection.workload.headersToInsert.emplace("User-Agent", "DiscordCoreAPI (https://discordcoreapi.com/1.0)");
-				if (connection.workload.payloadType == payload_type::Application_Json) {
-					connection.workload.headersToInsert.emplace("Content-Type", "application/json");
-				} else if (connection.workload.payloadType == payload_type::Multipart_Form) {
-					connection.workload.headersToInsert.emplace("Content-Type", "multipart/form-data; boundary=boundary25");
+			// A request goes over http/2 first, when it's enabled - it only falls back to the connection's own http/1.1 path, retries and all, if the
+			// server provably never acted on it. Otherwise sending it again could run a POST, PATCH or DELETE twice.
+			http2_client* transport{ http2Transport.load(std::memory_order_acquire) };
+			if (transport && connection.currentReconnectTries == 0 && connection.workload.baseUrl == discordBaseUrl) {
+				switch (transport->submit(connection.workload, connection.data)) {
+					case http2_submit_result::Completed: {
+						return connection.finalizeReturnValues(*connection.currentRateLimitData);
+					}
+					case http2_submit_result::Failed: {
+						message_printer::printError<print_message_type::https>("An http/2 request failed after it was sent - it won't be sent again.");
+						return https_response_data{};
+					}
+					case http2_submit_result::Not_Sent: {
+						break;
+					}
 				}
 			}
 			if (connection.currentReconnectTries >= connection.maxReconnectTries) {
@@ -389,9 +843,8 @@ namespace discord_core_api {
 					return httpsRequestInternal(connection);
 				}
 			}
-			auto request = connection.buildRequest(connection.workload);
 			if (connection.areWeConnected()) {
-				connection.writeData(static_cast<jsonifier::string_view>(request), true);
+				connection.writeRequest(clientHeaders);
 				if (connection.currentStatus != connection_status::NO_Error || !connection.areWeConnected()) {
 					++connection.currentReconnectTries;
 					connection.disconnect();
@@ -504,6 +957,10 @@ namespace discord_core_api {
 						case connection_status::SOCKET_Error:
 							[[fallthrough]];
 						default: {
+							if (connection.finishOnClose()) {
+								connection.disconnect();
+								return connection.finalizeReturnValues(*connection.currentRateLimitData);
+							}
 							return recoverFromError(connection);
 						}
 					}
@@ -44,7 +44,7 @@ namespace discord_core_api {
 			} else {
 				dataPackage02.type = interaction_callback_type::Update_Message;
 			}
-			input_event_data newEvent = respondToInputEvent(dataPackage02);
+			input_event_data newEvent = co_await respondToInputEventAsync(dataPackage02);
 			if (dataPackage.type == input_event_response_type::Interaction_Response || dataPackage.type == input_event_response_type::Ephemeral_Interaction_Response ||
 				dataPackage.type == input_event_response_type::Edit_Interaction_Response) {
 				newEvent.responseType = input_event_response_type::Edit_Interaction_Response;
@@ -56,7 +56,7 @@ namespace discord_core_api {
 		} else if (dataPackage.eventType == interaction_type::Application_Command_Autocomplete) {
 			create_interaction_response_data dataPackage02{ dataPackage };
 			dataPackage02.type		= interaction_callback_type::Application_Command_Autocomplete_Result;
-			input_event_data newEvent =respondToInputEvent(dataPackage02);
+			input_event_data newEvent = co_await respondToInputEventAsync(dataPackage02);
 			newEvent.responseType	= input_event_response_type::Application_Command_AutoComplete_Result;
 			co_return std::move(newEvent);
 		}
@@ -64,15 +64,15 @@ namespace discord_core_api {
 			case input_event_response_type::Ephemeral_Deferred_Response: {
 				create_deferred_interaction_response_data dataPackage02{ dataPackage };
 				dataPackage02.data.flags = 64;
-				co_return respondToInputEvent(dataPackage02);
+				co_return co_await respondToInputEventAsync(dataPackage02);
 			}
 			case input_event_response_type::Deferred_Response: {
 				create_deferred_interaction_response_data dataPackage02{ dataPackage };
-				co_return respondToInputEvent(dataPackage02);
+				co_return co_await respondToInputEventAsync(dataPackage02);
 			}
 			case input_event_response_type::Interaction_Response: {
 				create_interaction_response_data dataPackage02{ dataPackage };
-				co_return respondToInputEvent(dataPackage02);
+				co_return co_await respondToInputEventAsync(dataPackage02);
 			}
 			case input_event_response_type::Edit_Interaction_Response: {
 				edit_interaction_response_data dataPackage02{ dataPackage };
@@ -80,7 +80,7 @@ namespace discord_core_api {
 			}
 			case input_event_response_type::Ephemeral_Interaction_Response: {
 				create_ephemeral_interaction_response_data dataPackage02{ dataPackage };
-				co_return respondToInputEvent(dataPackage02);
+				co_return co_await respondToInputEventAsync(dataPackage02);
 			}
 			case input_event_response_type::Follow_Up_Message: {
 				create_follow_up_message_data dataPackage02{ dataPackage };
@@ -113,26 +113,28 @@ namespace discord_core_api {
 	co_routine<void> input_events::deleteInputEventResponseAsync(input_event_data dataPackage, uint32_t timeDelayNew) {
 		input_event_data newPackage = dataPackage;
 		co_await newThreadAwaitable<void>();
+		// Waiting here, rather than in the nested delete, keeps the pool thread free for the whole delay instead of blocking it on get().
+		co_await after(milliseconds{ timeDelayNew });
 		if (newPackage.responseType == input_event_response_type::Follow_Up_Message || newPackage.responseType == input_event_response_type::Edit_Follow_Up_Message ||
 			newPackage.responseType == input_event_response_type::Ephemeral_Follow_Up_Message) {
 			respond_to_input_event_data dataPackageNew{ newPackage };
 			delete_follow_up_message_data dataPackageNewer{ dataPackageNew };
-			dataPackageNewer.timeDelay = timeDelayNew;
-			interactions::deleteFollowUpMessageAsync(dataPackageNewer).get();
+			dataPackageNewer.timeDelay = 0;
+			co_await interactions::deleteFollowUpMessageAsync(dataPackageNewer);
 		} else if (newPackage.responseType == input_event_response_type::Interaction_Response || newPackage.responseType == input_event_response_type::Edit_Interaction_Response ||
 			newPackage.responseType == input_event_response_type::Ephemeral_Interaction_Response ||
 			newPackage.responseType == input_event_response_type::Ephemeral_Deferred_Response || newPackage.responseType == input_event_response_type::Deferred_Response) {
 			respond_to_input_event_data dataPackageNew{ newPackage };
 			delete_interaction_response_data dataPackageNewer{ dataPackageNew };
-			dataPackageNewer.timeDelay = timeDelayNew;
-			interactions::deleteInteractionResponseAsync(dataPackageNewer).get();
+			dataPackageNewer.timeDelay = 0;
+			co_await interactions::deleteInteractionResponseAsync(dataPackageNewer);
 		}
 		co_return;
 	}
 
-	input_event_data input_events::respondToInputEvent(create_deferred_interaction_response_data dataPackage) {
+	co_routine<input_event_data> input_events::respondToInputEventAsync(create_deferred_interaction_response_data dataPackage) {
 		create_interaction_response_data dataPackageNew{ dataPackage };
-		auto result = interactions::createInteractionResponse(dataPackageNew);
+		auto result = co_await interactions::createInteractionResponseAsync(dataPackageNew);
 		input_event_data dataPackageNewer{};
 		dataPackageNewer.responseType					= input_event_response_type::Deferred_Response;
 		dataPackageNewer.interactionData->applicationId = dataPackage.interactionPackage.applicationId;
@@ -141,11 +143,11 @@ namespace discord_core_api {
 		dataPackageNewer.interactionData->message.id	= result.messageReference.messageId;
 		dataPackageNewer.interactionData->id			= dataPackage.interactionPackage.interactionId;
 		dataPackageNewer.interactionData->user			= result.author;
-		return dataPackageNewer;
+		co_return dataPackageNewer;
 	}
 
-	input_event_data input_events::respondToInputEvent(create_interaction_response_data dataPackage) {
-		message_data messageData = interactions::createInteractionResponse(dataPackage);
+	co_routine<input_event_data> input_events::respondToInputEventAsync(create_interaction_response_data dataPackage) {
+		message_data messageData = co_await interactions::createInteractionResponseAsync(dataPackage);
 		input_event_data dataPackageNewer{};
 		dataPackageNewer.responseType					= input_event_response_type::Interaction_Response;
 		dataPackageNewer.interactionData->applicationId = dataPackage.interactionPackage.applicationId;
@@ -154,7 +156,7 @@ namespace discord_core_api {
 		dataPackageNewer.interactionData->channelId		= messageData.channelId;
 		dataPackageNewer.interactionData->user			= messageData.author;
 		dataPackageNewer.interactionData->message		= messageData;
-		return dataPackageNewer;
+		co_return dataPackageNewer;
 	}
 
 	input_event_data input_events::respondToInputEvent(edit_interaction_response_data dataPackage) {
@@ -196,9 +198,9 @@ namespace discord_core_api {
 		return dataPackageNewer;
 	}
 
-	input_event_data input_events::respondToInputEvent(create_ephemeral_interaction_response_data dataPackage) {
+	co_routine<input_event_data> input_events::respondToInputEventAsync(create_ephemeral_interaction_response_data dataPackage) {
 		create_interaction_response_data dataPackageNew{ dataPackage };
-		message_data messageData = interactions::createInteractionResponse(dataPackageNew);
+		message_data messageData = co_await interactions::createInteractionResponseAsync(dataPackageNew);
 		input_event_data dataPackageNewer{};
 		dataPackageNewer.responseType					= input_event_response_type::Ephemeral_Interaction_Response;
 		dataPackageNewer.interactionData->applicationId = dataPackage.interactionPackage.applicationId;
@@ -207,7 +209,7 @@ namespace discord_core_api {
 		dataPackageNewer.interactionData->channelId		= messageData.channelId;
 		dataPackageNewer.interactionData->user			= messageData.author;
 		dataPackageNewer.interactionData->message		= messageData;
-		return dataPackageNewer;
+		co_return dataPackageNewer;
 	}
 
 	input_event_data input_events::respondToInputEvent(create_ephemeral_follow_up_message_data dataPackage) {
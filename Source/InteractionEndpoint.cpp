@@ -0,0 +1,427 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// InteractionEndpoint.cpp - Source file for the http interactions endpoint.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file InteractionEndpoint.cpp
+
+#include <discordcoreapi/Utilities/InteractionEndpoint.hpp>
+#include <discordcoreapi/CoRoutine.hpp>
+#include <sodium.h>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+#if defined(MSG_NOSIGNAL)
+		static constexpr int32_t sendFlags{ MSG_NOSIGNAL };
+#else
+		static constexpr int32_t sendFlags{};
+#endif
+
+		static constexpr uint64_t receiveSize{ 16384 };
+
+		interaction_endpoint::interaction_endpoint(const interaction_endpoint_options& optionsNew, uint64_t workerCount, interaction_response_lane& laneNew,
+			gateway_event_executor& executorNew)
+			: executor{ &executorNew }, lane{ &laneNew } {
+			size_t keyLength{};
+			if (sodium_hex2bin(publicKey.data(), publicKey.size(), optionsNew.publicKey.data(), optionsNew.publicKey.size(), nullptr, &keyLength, nullptr) != 0 ||
+				keyLength != publicKey.size()) {
+				message_printer::printError<print_message_type::general>("The interactions endpoint's public key isn't a valid hex-encoded ed25519 key!");
+				return;
+			}
+			if (!startListening(optionsNew) || !startWaking()) {
+				listener = INVALID_SOCKET;
+				return;
+			}
+			for (uint64_t x = 0; x < std::max(workerCount, uint64_t{ 1 }); ++x) {
+				workers.emplace_back([this](std::stop_token token) {
+					runWorker(token);
+				});
+			}
+			poller = std::jthread{ [this](std::stop_token token) {
+				pollConnections(token);
+			} };
+			message_printer::printSuccess<print_message_type::general>(
+				"Listening for interactions on " + optionsNew.bindAddress + ":" + jsonifier::toString(optionsNew.port) + ".");
+		}
+
+		bool interaction_endpoint::isListening() {
+			return isValidSocket(listener.operator SOCKET());
+		}
+
+		bool interaction_endpoint::startListening(const interaction_endpoint_options& options) {
+			addrinfo_wrapper hints{}, address{};
+			hints->ai_family   = AF_UNSPEC;
+			hints->ai_socktype = SOCK_STREAM;
+			hints->ai_protocol = IPPROTO_TCP;
+			hints->ai_flags	   = AI_PASSIVE;
+
+			if (getaddrinfo(options.bindAddress.data(), jsonifier::toString(options.port).data(), hints, address)) {
+				message_printer::printError<print_message_type::general>(reportError("interaction_endpoint::getaddrinfo(), on: " + options.bindAddress));
+				return false;
+			}
+
+			if (listener = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol); !isValidSocket(listener.operator SOCKET())) {
+				message_printer::printError<print_message_type::general>(reportError("interaction_endpoint::socket(), on: " + options.bindAddress));
+				listener = INVALID_SOCKET;
+				return false;
+			}
+
+			int32_t optionValue{ 1 };
+			if (setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&optionValue), sizeof(optionValue)) == SOCKET_ERROR) {
+				message_printer::printError<print_message_type::general>(reportError("interaction_endpoint::setsockopt(), on: " + options.bindAddress));
+			}
+
+			if (::bind(listener, address->ai_addr, static_cast<int32_t>(address->ai_addrlen)) == SOCKET_ERROR) {
+				message_printer::printError<print_message_type::general>(reportError("interaction_endpoint::bind(), on: " + options.bindAddress));
+				listener = INVALID_SOCKET;
+				return false;
+			}
+
+			if (::listen(listener, SOMAXCONN) == SOCKET_ERROR) {
+				message_printer::printError<print_message_type::general>(reportError("interaction_endpoint::listen(), on: " + options.bindAddress));
+				listener = INVALID_SOCKET;
+				return false;
+			}
+			return true;
+		}
+
+		bool interaction_endpoint::startWaking() {
+			// A datagram socket on the loopback interface, rather than a pipe, so that the poller can wait on it alongside the connections everywhere.
+			sockaddr_in address{};
+			socklen_t addressLength{ sizeof(address) };
+			address.sin_family		= AF_INET;
+			address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			if (wakeReceiver = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP); !isValidSocket(wakeReceiver.operator SOCKET()) ||
+				::bind(wakeReceiver, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR ||
+				getsockname(wakeReceiver, reinterpret_cast<sockaddr*>(&address), &addressLength) == SOCKET_ERROR) {
+				message_printer::printError<print_message_type::general>(reportError("interaction_endpoint::startWaking()"));
+				return false;
+			}
+			if (wakeSender = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP); !isValidSocket(wakeSender.operator SOCKET()) ||
+				::connect(wakeSender, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR) {
+				message_printer::printError<print_message_type::general>(reportError("interaction_endpoint::startWaking()"));
+				return false;
+			}
+			return true;
+		}
+
+		void interaction_endpoint::pollConnections(std::stop_token token) {
+			std::vector<endpoint_connection> idleConnections{};
+			std::vector<pollfd> readFds{};
+			while (!token.stop_requested()) {
+				std::unique_lock lock{ accessMutex };
+				while (returnedConnections.size() > 0) {
+					idleConnections.emplace_back(std::move(returnedConnections.front()));
+					returnedConnections.pop_front();
+				}
+				lock.unlock();
+				readFds.clear();
+				for (SOCKET value: { listener.operator SOCKET(), wakeReceiver.operator SOCKET() }) {
+					pollfd readFd{};
+					readFd.fd	  = value;
+					readFd.events = POLLIN;
+					readFds.emplace_back(readFd);
+				}
+				for (auto& value: idleConnections) {
+					pollfd readFd{};
+					readFd.fd	  = value.socket;
+					readFd.events = POLLIN;
+					readFds.emplace_back(readFd);
+				}
+				if (poll(readFds.data(), static_cast<u_long>(readFds.size()), 100) < 0) {
+					continue;
+				}
+				if (readFds[1].revents & POLLIN) {
+					char wakeByte{};
+					recv(wakeReceiver, &wakeByte, 1, 0);
+				}
+
+				// A connection that a request has started arriving on goes to a worker, and one that's been idle for too long is closed.
+				hrclock::time_point now{ hrclock::now() };
+				uint64_t readyCount{};
+				lock.lock();
+				for (uint64_t x = idleConnections.size(); x > 0; --x) {
+					if (readFds[x + 1].revents & (POLLIN | POLLHUP | POLLERR | POLLNVAL)) {
+						pendingConnections.emplace_back(std::move(idleConnections[x - 1]));
+						++readyCount;
+					} else if (now - idleConnections[x - 1].idleSince < idleTimeout) {
+						continue;
+					}
+					if (x < idleConnections.size()) {
+						idleConnections[x - 1] = std::move(idleConnections.back());
+					}
+					idleConnections.pop_back();
+				}
+				lock.unlock();
+				if (readyCount > 1) {
+					workCondition.notify_all();
+				} else if (readyCount == 1) {
+					workCondition.notify_one();
+				}
+
+				if (readFds[0].revents & POLLIN) {
+					SOCKET socket{ ::accept(listener, nullptr, nullptr) };
+					if (!isValidSocket(socket)) {
+						continue;
+					}
+					int32_t optionValue{ 1 };
+					setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&optionValue), sizeof(optionValue));
+					endpoint_connection connection{};
+					connection.idleSince = now;
+					connection.socket	 = socket;
+					idleConnections.emplace_back(std::move(connection));
+				}
+			}
+		}
+
+		void interaction_endpoint::runWorker(std::stop_token token) {
+			while (!token.stop_requested()) {
+				std::unique_lock lock{ accessMutex };
+				if (!workCondition.wait(lock, token, [&] {
+						return pendingConnections.size() > 0;
+					})) {
+					return;
+				}
+				endpoint_connection connection{ std::move(pendingConnections.front()) };
+				pendingConnections.pop_front();
+				lock.unlock();
+				interaction_endpoint_request request{};
+				if (!readRequest(connection.socket, connection.buffer, request, token) || !handleRequest(connection.socket, request)) {
+					continue;
+				}
+				// A request that's already been pipelined in behind this one is served next, and otherwise the poller watches for it.
+				connection.idleSince = hrclock::now();
+				bool isItPipelined{ connection.buffer.find("\r\n\r\n") != jsonifier::string::npos };
+				lock.lock();
+				(isItPipelined ? pendingConnections : returnedConnections).emplace_back(std::move(connection));
+				lock.unlock();
+				if (isItPipelined) {
+					workCondition.notify_one();
+				} else {
+					send(wakeSender, "w", 1, 0);
+				}
+			}
+		}
+
+		bool interaction_endpoint::readRequest(SOCKET socket, jsonifier::string& buffer, interaction_endpoint_request& request, std::stop_token token) {
+			hrclock::time_point deadline{ hrclock::now() + idleTimeout };
+			auto receiveMore = [&] {
+				while (!token.stop_requested() && hrclock::now() < deadline) {
+					pollfd readFd{};
+					readFd.fd	  = socket;
+					readFd.events = POLLIN;
+					if (auto result = poll(&readFd, 1, 100); result == 0) {
+						continue;
+					} else if (result < 0) {
+						return false;
+					}
+					uint64_t oldSize{ buffer.size() };
+					buffer.resize(oldSize + receiveSize);
+					auto bytesRead = recv(socket, buffer.data() + oldSize, static_cast<int32_t>(receiveSize), 0);
+					buffer.resize(oldSize + static_cast<uint64_t>(std::max(static_cast<int64_t>(bytesRead), int64_t{ 0 })));
+					return bytesRead > 0;
+				}
+				return false;
+			};
+
+			uint64_t headerEnd{};
+			while ((headerEnd = buffer.find("\r\n\r\n")) == jsonifier::string::npos) {
+				if (buffer.size() > maxRequestSize) {
+					sendResponse(socket, "431 Request Header Fields Too Large", "text/plain", "", false);
+					return false;
+				}
+				if (!receiveMore()) {
+					return false;
+				}
+			}
+
+			jsonifier::string_view headers{ buffer.data(), headerEnd };
+			uint64_t lineEnd{ std::min(headers.find("\r\n"), headers.size()) };
+			jsonifier::string_view requestLine{ headers.substr(0, lineEnd) };
+			request.method	  = static_cast<jsonifier::string>(requestLine.substr(0, requestLine.find(" ")));
+			request.keepAlive = requestLine.find("HTTP/1.0") == jsonifier::string_view::npos;
+			uint64_t contentLength{};
+			bool isItChunked{};
+			while (lineEnd < headers.size()) {
+				uint64_t start{ lineEnd + 2 };
+				lineEnd = std::min(headers.find("\r\n", start), headers.size());
+				jsonifier::string_view line{ headers.substr(start, lineEnd - start) };
+				uint64_t separator{ line.find(":") };
+				if (separator == jsonifier::string_view::npos) {
+					continue;
+				}
+				jsonifier::string key{ static_cast<jsonifier::string>(line.substr(0, separator)) };
+				for (auto& valueNew: key) {
+					valueNew = static_cast<char>(std::tolower(static_cast<int32_t>(valueNew)));
+				}
+				jsonifier::string_view value{ line.substr(separator + 1) };
+				while (value.size() > 0 && value[0] == ' ') {
+					value = value.substr(1);
+				}
+				if (key == "content-length") {
+					contentLength = jsonifier::strToUint64(static_cast<jsonifier::string>(value).data());
+				} else if (key == "x-signature-ed25519") {
+					request.signature = static_cast<jsonifier::string>(value);
+				} else if (key == "x-signature-timestamp") {
+					request.signatureTimestamp = static_cast<jsonifier::string>(value);
+				} else if (key == "transfer-encoding") {
+					isItChunked = value.find("chunked") != jsonifier::string_view::npos;
+				} else if (key == "connection") {
+					request.keepAlive = value.find("close") == jsonifier::string_view::npos;
+				}
+			}
+
+			if (isItChunked) {
+				sendResponse(socket, "411 Length Required", "text/plain", "", false);
+				return false;
+			}
+			if (contentLength > maxRequestSize) {
+				sendResponse(socket, "413 Payload Too Large", "text/plain", "", false);
+				return false;
+			}
+			uint64_t bodyStart{ headerEnd + 4 };
+			while (buffer.size() < bodyStart + contentLength) {
+				if (!receiveMore()) {
+					return false;
+				}
+			}
+			request.body = buffer.substr(bodyStart, contentLength);
+			buffer		 = buffer.substr(bodyStart + contentLength);
+			return true;
+		}
+
+		bool interaction_endpoint::handleRequest(SOCKET socket, interaction_endpoint_request& request) {
+			hrclock::time_point receivedAt{ hrclock::now() };
+			if (request.method != "POST") {
+				sendResponse(socket, "405 Method Not Allowed", "text/plain", "", false);
+				return false;
+			}
+			if (!verifySignature(request)) {
+				return sendResponse(socket, "401 Unauthorized", "text/plain", "invalid request signature", request.keepAlive) && request.keepAlive;
+			}
+			if (!isTimestampFresh(request)) {
+				// A validly signed request from too long ago is a replay.
+				return sendResponse(socket, "401 Unauthorized", "text/plain", "stale request timestamp", request.keepAlive) && request.keepAlive;
+			}
+
+			// The interaction is wrapped up as a gateway dispatch, so that it's routed, parsed and handled exactly as one that arrived on the gateway.
+			jsonifier::string payload{ "{\"op\":0,\"t\":\"INTERACTION_CREATE\",\"d\":" + request.body + "}" };
+			gateway_event eventNew{};
+			eventNew.payload.resize(payload.size());
+			std::memcpy(eventNew.payload.data(), payload.data(), payload.size());
+			eventNew.receivedAt = receivedAt;
+			eventNew.eventType	= 41;
+			jsonifier::string_view_base<uint8_t> payloadView{ eventNew.payload.data(), eventNew.payload.size() };
+			interaction_type type{ static_cast<interaction_type>(gateway_event_executor::findDispatchValue(payloadView, "type")) };
+			if (type == interaction_type::Ping) {
+				return sendResponse(socket, "200 OK", "application/json", "{\"type\":1}", request.keepAlive) && request.keepAlive;
+			}
+			snowflake interactionId{ gateway_event_executor::findDispatchValue(payloadView, "id") };
+			uint64_t guildId{ gateway_event_executor::findDispatchValue(payloadView, "guild_id") };
+			uint64_t routingKey{ guildId != 0 ? guildId : gateway_event_executor::findDispatchValue(payloadView, "channel_id") };
+
+			inline_interaction_reply reply{};
+			lane->registerInlineReply(interactionId, reply);
+			lane->recordReceipt(interactionId, receivedAt);
+			executor->submit(routingKey, executor->getGuildShard(guildId), std::move(eventNew));
+			interaction_response_awaiter* response{ lane->waitForInlineReply(interactionId, reply, interaction_response_lane::warningThreshold) };
+
+			if (!response) {
+				// Acknowledging the interaction keeps it from failing on the user's end - the eventual response then has to be an edit of the original.
+				message_printer::printError<print_message_type::https>("Interaction " + interactionId + " wasn't responded to within " +
+					jsonifier::toString(interaction_response_lane::warningThreshold.count()) + "ms, so it's been deferred.");
+				jsonifier::string_view deferral{ "{\"type\":5}" };
+				if (type == interaction_type::Message_Component) {
+					deferral = "{\"type\":6}";
+				} else if (type == interaction_type::Application_Command_Autocomplete) {
+					deferral = "{\"type\":8,\"data\":{\"choices\":[]}}";
+				}
+				bool sent{ sendResponse(socket, "200 OK", "application/json", deferral, request.keepAlive) };
+				if (sent && type != interaction_type::Application_Command_Autocomplete) {
+					lane->recordDeferral(interactionId);
+				}
+				return sent && request.keepAlive;
+			}
+
+			const https_workload_data& workload{ response->getWorkload() };
+			bool sent{ sendResponse(socket, "200 OK", workload.payloadType == payload_type::Multipart_Form ? "multipart/form-data; boundary=boundary25" : "application/json",
+				workload.content, request.keepAlive) };
+			lane->completeInlineReply(response, sent);
+			return sent && request.keepAlive;
+		}
+
+		bool interaction_endpoint::verifySignature(const interaction_endpoint_request& request) const {
+			std::array<uint8_t, crypto_sign_BYTES> signature{};
+			size_t signatureLength{};
+			if (sodium_hex2bin(signature.data(), signature.size(), request.signature.data(), request.signature.size(), nullptr, &signatureLength, nullptr) != 0 ||
+				signatureLength != signature.size()) {
+				return false;
+			}
+			jsonifier::string message{ request.signatureTimestamp + request.body };
+			return crypto_sign_verify_detached(signature.data(), reinterpret_cast<const uint8_t*>(message.data()), message.size(), publicKey.data()) == 0;
+		}
+
+		bool interaction_endpoint::isTimestampFresh(const interaction_endpoint_request& request) const {
+			if (request.signatureTimestamp.size() == 0) {
+				return false;
+			}
+			seconds timeStamp{ static_cast<int64_t>(jsonifier::strToUint64(request.signatureTimestamp.data())) };
+			seconds currentTime{ std::chrono::duration_cast<seconds>(sys_clock::now().time_since_epoch()) };
+			return timeStamp > currentTime - maxTimestampSkew && timeStamp < currentTime + maxTimestampSkew;
+		}
+
+		bool interaction_endpoint::sendResponse(SOCKET socket, jsonifier::string_view status, jsonifier::string_view contentType, jsonifier::string_view body,
+			bool keepAlive) {
+			jsonifier::string response{ "HTTP/1.1 " + static_cast<jsonifier::string>(status) + "\r\n" };
+			response += "Content-Type: " + static_cast<jsonifier::string>(contentType) + "\r\n";
+			response += "Content-Length: " + jsonifier::toString(body.size()) + "\r\n";
+			response += keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+			response += body;
+			uint64_t bytesWritten{};
+			while (bytesWritten < response.size()) {
+				auto result = send(socket, response.data() + bytesWritten, static_cast<int32_t>(response.size() - bytesWritten), sendFlags);
+				if (result <= 0) {
+					return false;
+				}
+				bytesWritten += static_cast<uint64_t>(result);
+			}
+			return true;
+		}
+
+		interaction_endpoint::~interaction_endpoint() {
+			poller.request_stop();
+			for (auto& value: workers) {
+				value.request_stop();
+			}
+			if (poller.joinable()) {
+				poller.join();
+			}
+			workers.clear();
+		}
+	}
+}
@@ -373,7 +373,6 @@ namespace discord_core_api {
 
 	co_routine<message_data> interactions::createInteractionResponseAsync(create_interaction_response_data dataPackageNew) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Post_Interaction_Response };
-		co_await newThreadAwaitable<message_data>();
 		workload.workloadClass = discord_core_internal::https_workload_class::Post;
 		auto dataPackage{ dataPackageNew };
 		workload.relativePath = "/interactions/" + dataPackage.interactionPackage.interactionId + "/" + dataPackage.interactionPackage.interactionToken + "/callback";
@@ -383,12 +382,48 @@ namespace discord_core_api {
 		}
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::createInteractionResponseAsync()";
-		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		// If the interactions endpoint had to defer the interaction, a message callback would be rejected - it becomes an edit of the deferred response.
+		auto& lane{ interactions::httpsClient->getInteractionResponseLane() };
+		bool isItAMessage{ dataPackage.type == interaction_callback_type::Channel_Message_With_Source || dataPackage.type == interaction_callback_type::Update_Message };
+		bool wasItDeferred{ isItAMessage && lane.takeDeferral(dataPackage.interactionPackage.interactionId) };
+		if (!wasItDeferred) {
+			try {
+				// The callback goes out on the interaction lane, which resumes this co_routine once it's acknowledged, so no thread waits on the round trip.
+				co_await interactions::httpsClient->submitInteractionResponse(std::move(workload), dataPackage.interactionPackage.interactionId);
+			} catch (const discord_core_internal::https_error&) {
+				// The deferral may have gone out while the callback was on its way.
+				if (!isItAMessage || !lane.takeDeferral(dataPackage.interactionPackage.interactionId)) {
+					throw;
+				}
+				wasItDeferred = true;
+			}
+		}
+		if (wasItDeferred) {
+			co_await newThreadAwaitable<message_data>();
+			discord_core_internal::https_workload_data workloadNew{ discord_core_internal::https_workload_type::Patch_Interaction_Response };
+			workloadNew.workloadClass = discord_core_internal::https_workload_class::Patch;
+			workloadNew.relativePath =
+				"/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken + "/messages/@original";
+			if (dataPackage.data.files.size() > 0) {
+				workloadNew.payloadType = discord_core_internal::payload_type::Multipart_Form;
+			}
+			// An edit takes the callback's message fields, and none of the ones that only make sense for a callback.
+			dataPackage.data.jsonifierExcludedKeys.emplace("custom_id");
+			dataPackage.data.jsonifierExcludedKeys.emplace("choices");
+			dataPackage.data.jsonifierExcludedKeys.emplace("title");
+			dataPackage.data.jsonifierExcludedKeys.emplace("flags");
+			dataPackage.data.jsonifierExcludedKeys.emplace("tts");
+			parser.serializeJson(dataPackage.data, workloadNew.content);
+			workloadNew.callStack = "interactions::createInteractionResponseAsync()";
+			message_data returnData{};
+			interactions::httpsClient->submitWorkloadAndGetResult(std::move(workloadNew), returnData);
+			co_return returnData;
+		}
 		get_interaction_response_data dataPackage01{};
 		dataPackage01.applicationId	   = dataPackage.interactionPackage.applicationId;
 		dataPackage01.interactionToken = dataPackage.interactionPackage.interactionToken;
 		if (dataPackage.type != interaction_callback_type::Application_Command_Autocomplete_Result) {
-			co_return interactions::getInteractionResponseAsync(dataPackage01).get();
+			co_return co_await interactions::getInteractionResponseAsync(dataPackage01);
 		} else {
 			co_return message_data{};
 		}
@@ -436,7 +471,7 @@ namespace discord_core_api {
 	co_routine<void> interactions::deleteInteractionResponseAsync(delete_interaction_response_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Delete_Interaction_Response };
 		co_await newThreadAwaitable<void>();
-		std::this_thread::sleep_for(milliseconds{ dataPackage.timeDelay });
+		co_await after(milliseconds{ dataPackage.timeDelay });
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken + "/messages/@original";
 		workload.callStack	   = "interactions::deleteInteractionResponseAsync()";
@@ -493,7 +528,7 @@ namespace discord_core_api {
 	co_routine<void> interactions::deleteFollowUpMessageAsync(delete_follow_up_message_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Delete_Followup_Message };
 		co_await newThreadAwaitable<void>();
-		std::this_thread::sleep_for(milliseconds{ dataPackage.timeDelay });
+		co_await after(milliseconds{ dataPackage.timeDelay });
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken + "/messages/" +
 			dataPackage.messagePackage.messageId;
@@ -503,25 +538,7 @@ namespace discord_core_api {
 	}
 
 	message_data interactions::createInteractionResponse(create_interaction_response_data dataPackageNew) {
-		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Post_Interaction_Response };
-		workload.workloadClass = discord_core_internal::https_workload_class::Post;
-		auto dataPackage{ dataPackageNew };
-		workload.relativePath  = "/interactions/" + dataPackage.interactionPackage.interactionId + "/" + dataPackage.interactionPackage.interactionToken + "/callback";
-		dataPackage.generateExcludedKeys();
-		if (dataPackage.data.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
-		}
-		parser.serializeJson(dataPackage, workload.content);
-		workload.callStack = "interactions::createInteractionResponse()";
-		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
-		get_interaction_response_data dataPackage01{};
-		dataPackage01.applicationId	   = dataPackage.interactionPackage.applicationId;
-		dataPackage01.interactionToken = dataPackage.interactionPackage.interactionToken;
-		if (dataPackage.type != interaction_callback_type::Application_Command_Autocomplete_Result) {
-			return interactions::getInteractionResponse(dataPackage01);
-		} else {
-			return {};
-		}
+		return interactions::createInteractionResponseAsync(dataPackageNew).get();
 	}
 
 	message_data interactions::editInteractionResponse(edit_interaction_response_data dataPackageNew) {
@@ -577,13 +594,12 @@ namespace discord_core_api {
 		channelId		 = dataPackage.getInteractionData().channelId;
 		messageId		 = dataPackage.getMessageData().id;
 		*interactionData = dataPackage.getInteractionData();
-		buffersMapKey	 = channelId.operator jsonifier::string() + messageId.operator jsonifier::string();
 	}
 
 	co_routine<jsonifier::vector<select_menu_response_data>, false> select_menu_collector::collectSelectMenuData(bool getSelectMenuDataForAllNew, uint32_t maxWaitTimeInMsNew,
 		uint32_t maxCollectedSelectMenuCountNew, create_interaction_response_data errorMessageDataNew, snowflake targetUser) {
 		co_await newThreadAwaitable<jsonifier::vector<select_menu_response_data>, false>();
-		select_menu_collector::selectMenuInteractionBuffersMap[buffersMapKey] = &selectMenuIncomingInteractionBuffer;
+		select_menu_collector::selectMenuInteractionRegistry.add(messageId, selectMenuIncomingInteractionBuffer);
 		if (targetUser == 0 && !getSelectMenuDataForAllNew) {
 			getSelectMenuDataForAll = true;
 		} else {
@@ -596,7 +612,15 @@ namespace discord_core_api {
 		getSelectMenuDataForAll		= getSelectMenuDataForAllNew;
 		errorMessageData			= errorMessageDataNew;
 		maxTimeInMs					= maxWaitTimeInMsNew;
-		run();
+		while (!doWeQuit) {
+			auto selectMenuInteractionData = makeUnique<interaction_data>();
+			if (!co_await selectMenuIncomingInteractionBuffer->receive(*selectMenuInteractionData, milliseconds{ maxTimeInMs })) {
+				processTimeout();
+				break;
+			}
+			processInteraction(*selectMenuInteractionData);
+		}
+		select_menu_collector::selectMenuInteractionRegistry.remove(messageId, selectMenuIncomingInteractionBuffer);
 		co_return std::move(responseVector);
 	}
 
@@ -607,111 +631,60 @@ namespace discord_core_api {
 	}
 
 	select_menu_collector::~select_menu_collector() {
-		if (select_menu_collector::selectMenuInteractionBuffersMap.contains(buffersMapKey)) {
-			select_menu_collector::selectMenuInteractionBuffersMap.erase(buffersMapKey);
-		}
-	}
-
-	void select_menu_collector::run() {
-		stop_watch<milliseconds> stopWatch{ milliseconds{ maxTimeInMs } };
-		stopWatch.reset();
-		while (!doWeQuit && !stopWatch.hasTimeElapsed()) {
-			if (!getSelectMenuDataForAll) {
-				auto selectMenuInteractionData = makeUnique<interaction_data>();
-				if (waitForTimeToPass(selectMenuIncomingInteractionBuffer, *selectMenuInteractionData.get(), maxTimeInMs)) {
-					selectMenuId			   = "empty";
-					auto response			   = makeUnique<select_menu_response_data>();
-					response->selectionId	   = selectMenuId;
-					response->channelId		   = channelId;
-					response->messageId		   = messageId;
-					response->userId		   = selectMenuInteractionData->user.id;
-					*response->interactionData = *interactionData;
-					response->values		   = jsonifier::vector<jsonifier::string>{ "empty" };
-					responseVector.emplace_back(*response);
-					break;
-				}
-				if (selectMenuInteractionData->member.user.id != userId) {
-					errorMessageData.interactionPackage.applicationId	 = selectMenuInteractionData->applicationId;
-					errorMessageData.interactionPackage.interactionId	 = selectMenuInteractionData->id;
-					errorMessageData.interactionPackage.interactionToken = selectMenuInteractionData->token;
-					errorMessageData.messagePackage.messageId			 = selectMenuInteractionData->message.id;
-					errorMessageData.messagePackage.channelId			 = selectMenuInteractionData->message.channelId;
-					errorMessageData.type								 = interaction_callback_type::Channel_Message_With_Source;
-					interactions::createInteractionResponseAsync(errorMessageData).get();
-				} else {
-					*interactionData		   = *selectMenuInteractionData;
-					selectMenuId			   = selectMenuInteractionData->data.customId;
-					auto response			   = makeUnique<select_menu_response_data>();
-					response->selectionId	   = selectMenuId;
-					response->channelId		   = channelId;
-					response->messageId		   = messageId;
-					response->userId		   = selectMenuInteractionData->user.id;
-					response->values		   = interactionData->data.values;
-					*response->interactionData = *selectMenuInteractionData;
-					responseVector.emplace_back(*response);
-					++currentCollectedSelectMenuCount;
-					stopWatch.reset();
-					if (maxCollectedSelectMenuCount > 1 && currentCollectedSelectMenuCount < maxCollectedSelectMenuCount - 1) {
-						auto createResponseData	 = makeUnique<create_interaction_response_data>(*selectMenuInteractionData);
-						createResponseData->type = interaction_callback_type::Deferred_Update_Message;
-						interactions::createInteractionResponseAsync(*createResponseData).get();
-					}
-					if (currentCollectedSelectMenuCount >= maxCollectedSelectMenuCount) {
-						for (auto& value: responseVector) {
-							*value.interactionData = *selectMenuInteractionData;
-						}
-						doWeQuit = true;
-					}
-				}
-			} else {
-				auto selectMenuInteractionData = makeUnique<interaction_data>();
-				if (waitForTimeToPass(selectMenuIncomingInteractionBuffer, *selectMenuInteractionData.get(), maxTimeInMs)) {
-					selectMenuId			   = "empty";
-					auto response			   = makeUnique<select_menu_response_data>();
-					response->selectionId	   = selectMenuId;
-					response->channelId		   = channelId;
-					response->messageId		   = messageId;
-					response->userId		   = selectMenuInteractionData->user.id;
-					*response->interactionData = *interactionData;
-					response->values		   = jsonifier::vector<jsonifier::string>{ "empty" };
-					responseVector.emplace_back(*response);
-					break;
-				}
-				*interactionData		   = *selectMenuInteractionData;
-				selectMenuId			   = selectMenuInteractionData->data.customId;
-				auto response			   = makeUnique<select_menu_response_data>();
-				response->selectionId	   = selectMenuId;
-				response->channelId		   = channelId;
-				response->messageId		   = messageId;
-				response->userId		   = selectMenuInteractionData->user.id;
-				*response->interactionData = *selectMenuInteractionData;
-				response->values		   = interactionData->data.values;
-				responseVector.emplace_back(*response);
-				++currentCollectedSelectMenuCount;
-				stopWatch.reset();
-				if (maxCollectedSelectMenuCount > 1 && currentCollectedSelectMenuCount < maxCollectedSelectMenuCount - 1) {
-					auto createResponseData	 = makeUnique<create_interaction_response_data>(*selectMenuInteractionData);
-					createResponseData->type = interaction_callback_type::Deferred_Update_Message;
-					interactions::createInteractionResponseAsync(*createResponseData).get();
-				}
-				if (currentCollectedSelectMenuCount >= maxCollectedSelectMenuCount) {
-					doWeQuit = true;
-					for (auto& value: responseVector) {
-						*value.interactionData = *selectMenuInteractionData;
-					}
-				}
+		select_menu_collector::selectMenuInteractionRegistry.remove(messageId, selectMenuIncomingInteractionBuffer);
+	}
+
+	void select_menu_collector::processInteraction(const interaction_data& selectMenuInteractionData) {
+		if (!getSelectMenuDataForAll && selectMenuInteractionData.member.user.id != userId) {
+			errorMessageData.interactionPackage.applicationId	 = selectMenuInteractionData.applicationId;
+			errorMessageData.interactionPackage.interactionId	 = selectMenuInteractionData.id;
+			errorMessageData.interactionPackage.interactionToken = selectMenuInteractionData.token;
+			errorMessageData.messagePackage.messageId			 = selectMenuInteractionData.message.id;
+			errorMessageData.messagePackage.channelId			 = selectMenuInteractionData.message.channelId;
+			errorMessageData.type								 = interaction_callback_type::Channel_Message_With_Source;
+			interactions::createInteractionResponseAsync(errorMessageData).get();
+			return;
+		}
+		*interactionData		   = selectMenuInteractionData;
+		selectMenuId			   = selectMenuInteractionData.data.customId;
+		auto response			   = makeUnique<select_menu_response_data>();
+		response->selectionId	   = selectMenuId;
+		response->channelId		   = channelId;
+		response->messageId		   = messageId;
+		response->userId		   = selectMenuInteractionData.user.id;
+		response->values		   = interactionData->data.values;
+		*response->interactionData = selectMenuInteractionData;
+		responseVector.emplace_back(*response);
+		++currentCollectedSelectMenuCount;
+		if (maxCollectedSelectMenuCount > 1 && currentCollectedSelectMenuCount < maxCollectedSelectMenuCount - 1) {
+			auto createResponseData	 = makeUnique<create_interaction_response_data>(selectMenuInteractionData);
+			createResponseData->type = interaction_callback_type::Deferred_Update_Message;
+			interactions::createInteractionResponseAsync(*createResponseData).get();
+		}
+		if (currentCollectedSelectMenuCount >= maxCollectedSelectMenuCount) {
+			for (auto& value: responseVector) {
+				*value.interactionData = selectMenuInteractionData;
 			}
-			std::this_thread::sleep_for(1ms);
+			doWeQuit = true;
 		}
-		select_menu_collector::selectMenuInteractionBuffersMap.erase(buffersMapKey);
+	}
+
+	void select_menu_collector::processTimeout() {
+		selectMenuId			   = "empty";
+		auto response			   = makeUnique<select_menu_response_data>();
+		response->selectionId	   = selectMenuId;
+		response->channelId		   = channelId;
+		response->messageId		   = messageId;
+		*response->interactionData = *interactionData;
+		response->values		   = jsonifier::vector<jsonifier::string>{ "empty" };
+		responseVector.emplace_back(*response);
 	}
 
 	button_collector::button_collector(input_event_data dataPackage) {
-		channelId													 = dataPackage.getInteractionData().channelId;
-		messageId													 = dataPackage.getMessageData().id;
-		*interactionData											 = dataPackage.getInteractionData();
-		buffersMapKey												 = channelId.operator jsonifier::string() + messageId.operator jsonifier::string();
-		button_collector::buttonInteractionBuffersMap[buffersMapKey] = &buttonIncomingInteractionBuffer;
+		channelId		 = dataPackage.getInteractionData().channelId;
+		messageId		 = dataPackage.getMessageData().id;
+		*interactionData = dataPackage.getInteractionData();
+		button_collector::buttonInteractionRegistry.add(messageId, buttonIncomingInteractionBuffer);
 	}
 
 	co_routine<jsonifier::vector<button_response_data>, false> button_collector::collectButtonData(bool getButtonDataForAllNew, uint32_t maxWaitTimeInMsNew,
@@ -728,7 +701,15 @@ namespace discord_core_api {
 		getButtonDataForAll		= getButtonDataForAllNew;
 		errorMessageData		= errorMessageDataNew;
 		maxTimeInMs				= maxWaitTimeInMsNew;
-		run();
+		while (!doWeQuit) {
+			auto buttonInteractionData = makeUnique<interaction_data>();
+			if (!co_await buttonIncomingInteractionBuffer->receive(*buttonInteractionData, milliseconds{ maxTimeInMs })) {
+				processTimeout();
+				break;
+			}
+			processInteraction(*buttonInteractionData);
+		}
+		button_collector::buttonInteractionRegistry.remove(messageId, buttonIncomingInteractionBuffer);
 		co_return std::move(responseVector);
 	}
 
@@ -739,113 +720,70 @@ namespace discord_core_api {
 	}
 
 	button_collector::~button_collector() {
-		if (button_collector::buttonInteractionBuffersMap.contains(buffersMapKey)) {
-			button_collector::buttonInteractionBuffersMap.erase(buffersMapKey);
-		}
-	}
-
-	void button_collector::run() {
-		stop_watch<milliseconds> stopWatch{ milliseconds{ maxTimeInMs } };
-		stopWatch.reset();
-		while (!doWeQuit && !stopWatch.hasTimeElapsed()) {
-			if (!getButtonDataForAll) {
-				auto buttonInteractionData = makeUnique<interaction_data>();
-				if (waitForTimeToPass(buttonIncomingInteractionBuffer, *buttonInteractionData.get(), maxTimeInMs)) {
-					buttonId				   = "empty";
-					auto response			   = makeUnique<button_response_data>();
-					response->buttonId		   = buttonId;
-					response->channelId		   = channelId;
-					response->messageId		   = messageId;
-					response->userId		   = buttonInteractionData->user.id;
-					*response->interactionData = *interactionData;
-					responseVector.emplace_back(*response);
-					break;
-				}
-				if (buttonInteractionData->member.user.id != userId) {
-					errorMessageData.interactionPackage.applicationId	 = buttonInteractionData->applicationId;
-					errorMessageData.interactionPackage.interactionId	 = buttonInteractionData->id;
-					errorMessageData.interactionPackage.interactionToken = buttonInteractionData->token;
-					errorMessageData.messagePackage.messageId			 = buttonInteractionData->message.id;
-					errorMessageData.messagePackage.channelId			 = buttonInteractionData->message.channelId;
-					errorMessageData.type								 = interaction_callback_type::Channel_Message_With_Source;
-					interactions::createInteractionResponseAsync(errorMessageData).get();
-				} else {
-					*interactionData		   = *buttonInteractionData;
-					buttonId				   = buttonInteractionData->data.customId;
-					auto response			   = makeUnique<button_response_data>();
-					response->buttonId		   = buttonId;
-					response->channelId		   = channelId;
-					response->messageId		   = messageId;
-					response->emojiName		   = buttonInteractionData->message.components[0].components[0].emoji.name;
-					response->userId		   = buttonInteractionData->user.id;
-					*response->interactionData = *buttonInteractionData;
-					responseVector.emplace_back(*response);
-					++currentCollectedButtonCount;
-					stopWatch.reset();
-					if (maxCollectedButtonCount > 1 && currentCollectedButtonCount < maxCollectedButtonCount) {
-						auto createResponseData	 = makeUnique<create_interaction_response_data>(*buttonInteractionData);
-						createResponseData->type = interaction_callback_type::Deferred_Update_Message;
-						interactions::createInteractionResponseAsync(*createResponseData).get();
-					}
-					if (currentCollectedButtonCount >= maxCollectedButtonCount) {
-						for (auto& value: responseVector) {
-							*value.interactionData = *buttonInteractionData;
-						}
-						doWeQuit = true;
-					}
-				}
-			} else {
-				auto buttonInteractionData = makeUnique<interaction_data>();
-				if (waitForTimeToPass(buttonIncomingInteractionBuffer, *buttonInteractionData.get(), maxTimeInMs)) {
-					buttonId				   = "empty";
-					auto response			   = makeUnique<button_response_data>();
-					response->buttonId		   = buttonId;
-					response->channelId		   = channelId;
-					response->messageId		   = messageId;
-					response->emojiName		   = buttonInteractionData->message.components[0].components[0].emoji.name;
-					response->userId		   = buttonInteractionData->user.id;
-					*response->interactionData = *buttonInteractionData;
-					responseVector.emplace_back(*response);
-					break;
-				}
-				*interactionData		   = *buttonInteractionData;
-				buttonId				   = buttonInteractionData->data.customId;
-				auto response			   = makeUnique<button_response_data>();
-				response->buttonId		   = buttonId;
-				response->channelId		   = channelId;
-				response->messageId		   = messageId;
-				response->emojiName		   = buttonInteractionData->message.components[0].components[0].emoji.name;
-				response->userId		   = buttonInteractionData->user.id;
-				*response->interactionData = *buttonInteractionData;
-				responseVector.emplace_back(*response);
-				++currentCollectedButtonCount;
-				stopWatch.reset();
-				if (maxCollectedButtonCount > 1 && currentCollectedButtonCount < maxCollectedButtonCount) {
-					auto createResponseData	 = makeUnique<create_interaction_response_data>(*buttonInteractionData);
-					createResponseData->type = interaction_callback_type::Deferred_Update_Message;
-					interactions::createInteractionResponseAsync(*createResponseData).get();
-				}
-				if (currentCollectedButtonCount >= maxCollectedButtonCount) {
-					for (auto& value: responseVector) {
-						*value.interactionData = *buttonInteractionData;
-					}
-					doWeQuit = true;
-				}
+		button_collector::buttonInteractionRegistry.remove(messageId, buttonIncomingInteractionBuffer);
+	}
+
+	void button_collector::processInteraction(const interaction_data& buttonInteractionData) {
+		if (!getButtonDataForAll && buttonInteractionData.member.user.id != userId) {
+			errorMessageData.interactionPackage.applicationId	 = buttonInteractionData.applicationId;
+			errorMessageData.interactionPackage.interactionId	 = buttonInteractionData.id;
+			errorMessageData.interactionPackage.interactionToken = buttonInteractionData.token;
+			errorMessageData.messagePackage.messageId			 = buttonInteractionData.message.id;
+			errorMessageData.messagePackage.channelId			 = buttonInteractionData.message.channelId;
+			errorMessageData.type								 = interaction_callback_type::Channel_Message_With_Source;
+			interactions::createInteractionResponseAsync(errorMessageData).get();
+			return;
+		}
+		*interactionData		   = buttonInteractionData;
+		buttonId				   = buttonInteractionData.data.customId;
+		auto response			   = makeUnique<button_response_data>();
+		response->buttonId		   = buttonId;
+		response->channelId		   = channelId;
+		response->messageId		   = messageId;
+		response->emojiName		   = buttonInteractionData.message.components[0].components[0].emoji.name;
+		response->userId		   = buttonInteractionData.user.id;
+		*response->interactionData = buttonInteractionData;
+		responseVector.emplace_back(*response);
+		++currentCollectedButtonCount;
+		if (maxCollectedButtonCount > 1 && currentCollectedButtonCount < maxCollectedButtonCount) {
+			auto createResponseData	 = makeUnique<create_interaction_response_data>(buttonInteractionData);
+			createResponseData->type = interaction_callback_type::Deferred_Update_Message;
+			interactions::createInteractionResponseAsync(*createResponseData).get();
+		}
+		if (currentCollectedButtonCount >= maxCollectedButtonCount) {
+			for (auto& value: responseVector) {
+				*value.interactionData = buttonInteractionData;
 			}
-			std::this_thread::sleep_for(1ms);
+			doWeQuit = true;
 		}
-		button_collector::buttonInteractionBuffersMap.erase(buffersMapKey);
+	}
+
+	void button_collector::processTimeout() {
+		buttonId				   = "empty";
+		auto response			   = makeUnique<button_response_data>();
+		response->buttonId		   = buttonId;
+		response->channelId		   = channelId;
+		response->messageId		   = messageId;
+		*response->interactionData = *interactionData;
+		responseVector.emplace_back(*response);
 	}
 
 	modal_collector::modal_collector(input_event_data dataPackage) {
-		channelId											   = dataPackage.getInteractionData().channelId;
-		modal_collector::modalInteractionBuffersMap[channelId.operator jsonifier::string()] = &modalIncomingInteractionBuffer;
+		channelId = dataPackage.getInteractionData().channelId;
+		modal_collector::modalInteractionRegistry.add(channelId, modalIncomingInteractionBuffer);
 	}
 
 	co_routine<modal_response_data, false> modal_collector::collectModalData(uint32_t maxWaitTimeInMsNew) {
 		co_await newThreadAwaitable<modal_response_data, false>();
-		maxTimeInMs = maxWaitTimeInMsNew;
-		run();
+		maxTimeInMs				  = maxWaitTimeInMsNew;
+		auto modalInteractionData = makeUnique<interaction_data>();
+		co_await modalIncomingInteractionBuffer->receive(*modalInteractionData, milliseconds{ maxTimeInMs });
+		*responseData.interactionData = *modalInteractionData;
+		responseData.channelId		  = modalInteractionData->channelId;
+		responseData.customId		  = modalInteractionData->data.customId;
+		responseData.userId			  = modalInteractionData->user.id;
+		responseData.values			  = modalInteractionData->data.values;
+		modal_collector::modalInteractionRegistry.remove(channelId, modalIncomingInteractionBuffer);
 		co_return std::move(responseData);
 	}
 
@@ -856,39 +794,12 @@ namespace discord_core_api {
 	}
 
 	modal_collector::~modal_collector() {
-		if (modal_collector::modalInteractionBuffersMap.contains(channelId.operator jsonifier::string())) {
-			modal_collector::modalInteractionBuffersMap.erase(channelId.operator jsonifier::string());
-		}
-	}
-
-	void modal_collector::run() {
-		stop_watch<milliseconds> stopWatch{ milliseconds{ maxTimeInMs } };
-		stopWatch.reset();
-		while (!doWeQuit && !stopWatch.hasTimeElapsed()) {
-			auto buttonInteractionData = makeUnique<interaction_data>();
-			if (waitForTimeToPass(modalIncomingInteractionBuffer, *buttonInteractionData.get(), maxTimeInMs)) {
-				*responseData.interactionData = *buttonInteractionData;
-				responseData.channelId		  = buttonInteractionData->channelId;
-				responseData.customId		  = buttonInteractionData->data.customId;
-				responseData.userId			  = buttonInteractionData->user.id;
-				responseData.values			  = buttonInteractionData->data.values;
-				break;
-			} else {
-				*responseData.interactionData = *buttonInteractionData;
-				responseData.channelId		  = buttonInteractionData->channelId;
-				responseData.customId		  = buttonInteractionData->data.customId;
-				responseData.userId			  = buttonInteractionData->user.id;
-				responseData.values			  = buttonInteractionData->data.values;
-				break;
-			}
-		}
-
-		modal_collector::modalInteractionBuffersMap.erase(channelId.operator jsonifier::string());
+		modal_collector::modalInteractionRegistry.remove(channelId, modalIncomingInteractionBuffer);
 	}
 
-	unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> select_menu_collector::selectMenuInteractionBuffersMap{};
-	unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> button_collector::buttonInteractionBuffersMap{};
-	unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> modal_collector::modalInteractionBuffersMap{};
+	discord_core_internal::collector_registry<interaction_data> select_menu_collector::selectMenuInteractionRegistry{};
+	discord_core_internal::collector_registry<interaction_data> button_collector::buttonInteractionRegistry{};
+	discord_core_internal::collector_registry<interaction_data> modal_collector::modalInteractionRegistry{};
 	discord_core_internal::trigger_event<void, interaction_data> select_menu_collector::selectMenuInteractionEventsMap{};
 	discord_core_internal::trigger_event<void, interaction_data> button_collector::buttonInteractionEventsMap{};
 	discord_core_internal::trigger_event<void, interaction_data> modal_collector::modalInteractionEventsMap{};
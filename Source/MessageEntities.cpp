@@ -64,46 +64,34 @@ namespace jsonifier {
 
 namespace discord_core_api {
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<message_data>*> object_collector<message_data>::objectsBuffersMap{};
+	template<> discord_core_internal::collector_registry<message_data> object_collector<message_data>::objectsRegistry{};
 
-	template<> object_collector<message_data>::object_collector() {
-		collectorId										 = jsonifier::toString(std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()).count());
-		object_collector::objectsBuffersMap[collectorId] = &objectsBuffer;
+	template<> object_collector<message_data>::object_collector(snowflake channelIdNew) {
+		channelId = channelIdNew;
+		object_collector::objectsRegistry.add(channelId, objectsBuffer);
 	};
 
-	template<> void object_collector<message_data>::run(std::coroutine_handle<
-		typename discord_core_api::co_routine<discord_core_api::object_collector<discord_core_api::message_data>::object_collector_return_data, false>::promise_type>& coroHandle) {
-		int64_t startingTime = static_cast<int64_t>(std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()).count());
-		int64_t elapsedTime{};
-		while (elapsedTime < msToCollectFor && !coroHandle.promise().stopRequested()) {
-			message_data message{};
-			waitForTimeToPass<message_data>(objectsBuffer, message, static_cast<uint64_t>(msToCollectFor - static_cast<uint64_t>(elapsedTime)));
-			if (filteringFunction(message)) {
-				objectReturnData.objects.emplace_back(message);
-			}
-			if (static_cast<int32_t>(objectReturnData.objects.size()) >= quantityOfObjectsToCollect) {
-				break;
-			}
-
-			elapsedTime = std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()).count() - startingTime;
-		}
-	}
-
 	template<> co_routine<object_collector<message_data>::object_collector_return_data, false> object_collector<message_data>::collectObjects(int32_t quantityToCollect,
 		int32_t msToCollectForNew, object_filter<message_data> filteringFunctionNew) {
 		auto coroHandle			   = co_await newThreadAwaitable<object_collector_return_data, false>();
 		quantityOfObjectsToCollect = quantityToCollect;
 		filteringFunction		   = filteringFunctionNew;
 		msToCollectFor			   = msToCollectForNew;
-
-		run(coroHandle);
-		co_return objectReturnData;
+		auto endTime			   = hrclock::now() + milliseconds{ msToCollectFor };
+		while (static_cast<int32_t>(objectReturnData.objects.size()) < quantityOfObjectsToCollect && !coroHandle.promise().stopRequested()) {
+			message_data object{};
+			if (!co_await objectsBuffer->receive(object, std::chrono::duration_cast<milliseconds>(endTime - hrclock::now()))) {
+				break;
+			}
+			if (filteringFunction(object)) {
+				objectReturnData.objects.emplace_back(std::move(object));
+			}
+		}
+		co_return std::move(objectReturnData);
 	}
 
 	template<> object_collector<message_data>::~object_collector() {
-		if (object_collector::objectsBuffersMap.contains(collectorId)) {
-			object_collector::objectsBuffersMap.erase(collectorId);
-		}
+		object_collector::objectsRegistry.remove(channelId, objectsBuffer);
 	};
 
 	create_message_data::create_message_data(const snowflake channelIdNew) {
@@ -281,9 +269,7 @@ namespace discord_core_api {
 			workload = discord_core_internal::https_workload_type::Delete_Message_Old;
 		}
 		co_await newThreadAwaitable<void>();
-		if (dataPackage.timeDelay > 0) {
-			std::this_thread::sleep_for(milliseconds{ dataPackage.timeDelay });
-		}
+		co_await after(milliseconds{ dataPackage.timeDelay });
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId;
 		workload.callStack	   = "messages::deleteMessageAsync()";
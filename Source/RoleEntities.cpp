@@ -202,7 +202,7 @@ namespace discord_core_api {
 		newDataPackage.guildId	   = dataPackage.guildId;
 		newDataPackage.newPosition = dataPackage.position;
 		newDataPackage.roleId	   = returnData.id;
-		auto results			   = modifyGuildRolePositionsAsync(newDataPackage).get();
+		auto results			   = co_await modifyGuildRolePositionsAsync(newDataPackage);
 		for (auto& value: results) {
 			if (value.id == returnData.id) {
 				returnData = value;
@@ -214,7 +214,7 @@ namespace discord_core_api {
 	co_routine<jsonifier::vector<role_data>> roles::modifyGuildRolePositionsAsync(modify_guild_role_positions_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Patch_Guild_Role_Positions };
 		co_await newThreadAwaitable<jsonifier::vector<role_data>>();
-		jsonifier::vector<role_data> currentRoles = roles::getGuildRolesAsync({ .guildId = dataPackage.guildId }).get();
+		jsonifier::vector<role_data> currentRoles = co_await roles::getGuildRolesAsync({ .guildId = dataPackage.guildId });
 		role_data newRole						  = roles::getCachedRole({ .roleId = dataPackage.roleId });
 		for (auto& value: currentRoles) {
 			if (value.id == newRole.id) {
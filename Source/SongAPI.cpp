@@ -33,15 +33,164 @@
 #include <discordcoreapi/VoiceConnection.hpp>
 #include <discordcoreapi/SoundCloudAPI.hpp>
 #include <discordcoreapi/YouTubeAPI.hpp>
+#include <discordcoreapi/Utilities/Demuxers.hpp>
+#include <filesystem>
 
 namespace discord_core_api {
 
+	static constexpr uint64_t localChunkSize{ 64ULL * 1024ULL };
+	static constexpr uint64_t maxBufferedFrames{ 500 };
+
+	/// Local and cached sources are far faster than playback, so they hold the queue to about ten seconds of audio rather than dumping the whole track into it.
+	/// The buffer wakes the wait as playback drains it, and a stop request wakes it too.
+	bool waitForBufferSpace(song_api& songAPI, std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle) {
+		threadHandle.promise().setStopCallback([&songAPI] {
+			songAPI.audioDataBuffer.notifyWaiters();
+		});
+		bool returnValue{ songAPI.audioDataBuffer.waitForSize(maxBufferedFrames, [&] {
+			return threadHandle.promise().stopRequested();
+		}) };
+		threadHandle.promise().clearStopCallback();
+		return returnValue;
+	}
+
+	template<typename demuxer_type>
+	bool demuxLocalData(song_api& songAPI, jsonifier::string_view_base<uint8_t> fileData, std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle) {
+		demuxer_type demuxer{};
+		for (uint64_t offset = 0; offset < fileData.size(); offset += localChunkSize) {
+			jsonifier::string_view_base<uint8_t> chunk{ fileData.data() + offset, std::min(localChunkSize, static_cast<uint64_t>(fileData.size() - offset)) };
+			if constexpr (std::is_same_v<demuxer_type, discord_core_internal::matroska_demuxer>) {
+				demuxer.writeData(chunk);
+				if (offset + chunk.size() >= fileData.size()) {
+					demuxer.endOfStream();
+				}
+			} else {
+				demuxer.writeData(jsonifier::string_view{ reinterpret_cast<const char*>(chunk.data()), chunk.size() });
+			}
+			demuxer.proceedDemuxing();
+			audio_frame_data frameData{};
+			while (demuxer.collectFrame(frameData)) {
+				if (!waitForBufferSpace(songAPI, threadHandle)) {
+					return false;
+				}
+				songAPI.audioDataBuffer.send(std::move(frameData));
+				frameData = audio_frame_data{};
+			}
+		}
+		return !threadHandle.promise().stopRequested();
+	}
+
+	namespace discord_core_internal {
+
+		static constexpr milliseconds frameDuration{ 20 };
+
+		song_stream_sink::song_stream_sink(snowflake guildIdNew) {
+			guildId = guildIdNew;
+			live	= true;
+		}
+
+		song_stream_sink::song_stream_sink(snowflake guildIdNew, milliseconds maxStagedDurationNew, uint64_t maxStagedBytesNew) {
+			maxStagedDuration = maxStagedDurationNew;
+			maxStagedBytes	  = maxStagedBytesNew;
+			guildId			  = guildIdNew;
+		}
+
+		bool song_stream_sink::sendFrame(audio_frame_data&& frame, std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle) {
+			std::unique_lock lock{ accessMutex };
+			if (isStagingFull()) {
+				// Only goLive() makes room, so the wait sleeps until it does - or until a stop request wakes it.
+				lock.unlock();
+				threadHandle.promise().setStopCallback([this] {
+					std::unique_lock lockNew{ accessMutex };
+					stagingCondition.notify_all();
+				});
+				lock.lock();
+				stagingCondition.wait(lock, [&] {
+					return !isStagingFull() || threadHandle.promise().stopRequested();
+				});
+				lock.unlock();
+				threadHandle.promise().clearStopCallback();
+				if (threadHandle.promise().stopRequested()) {
+					return false;
+				}
+				lock.lock();
+			}
+			if (live) {
+				discord_core_client::getSongAPI(guildId).audioDataBuffer.send(std::move(frame));
+			} else {
+				stagedBytes += frame.data.size();
+				stagedFrames.emplace_back(std::move(frame));
+			}
+			return true;
+		}
+
+		void song_stream_sink::finish() {
+			std::unique_lock lock{ accessMutex };
+			didWeFinish = true;
+			if (live) {
+				sendCompletion();
+			}
+		}
+
+		void song_stream_sink::fail() {
+			std::unique_lock lock{ accessMutex };
+			didWeFail = true;
+			if (live) {
+				discord_core_client::getVoiceConnection(guildId).skip(true);
+			}
+		}
+
+		bool song_stream_sink::goLive() {
+			std::unique_lock lock{ accessMutex };
+			if (didWeFail) {
+				return false;
+			}
+			auto& songAPI{ discord_core_client::getSongAPI(guildId) };
+			for (auto& value: stagedFrames) {
+				songAPI.audioDataBuffer.send(std::move(value));
+			}
+			stagedFrames.clear();
+			stagedBytes = 0;
+			live		= true;
+			stagingCondition.notify_all();
+			if (didWeFinish) {
+				sendCompletion();
+			}
+			return true;
+		}
+
+		milliseconds song_stream_sink::getBufferedDuration() {
+			std::unique_lock lock{ accessMutex };
+			if (live) {
+				return frameDuration * static_cast<int64_t>(discord_core_client::getSongAPI(guildId).audioDataBuffer.size());
+			} else {
+				return frameDuration * static_cast<int64_t>(stagedFrames.size());
+			}
+		}
+
+		bool song_stream_sink::isItLive() {
+			std::unique_lock lock{ accessMutex };
+			return live;
+		}
+
+		bool song_stream_sink::isStagingFull() {
+			return !live && (frameDuration * static_cast<int64_t>(stagedFrames.size()) >= maxStagedDuration || stagedBytes >= maxStagedBytes);
+		}
+
+		void song_stream_sink::sendCompletion() {
+			discord_core_client::getVoiceConnection(guildId).skip(false);
+			audio_frame_data frameData{};
+			discord_core_client::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
+		}
+
+	}
+
 	song_api::song_api(const snowflake guildIdNew) {
 		guildId = guildIdNew;
 	}
 
 	void song_api::onSongCompletion(std::function<co_routine<void, false>(song_completion_event_data)> handler) {
-		onSongCompletionEvent.functions.clear();
+		onSongCompletionEvent.clear();
 		eventToken = onSongCompletionEvent.add(handler);
 	}
 
@@ -89,13 +238,31 @@ namespace discord_core_api {
 			taskThread.cancelAndWait();
 		}
 		discord_core_client::getVoiceConnection(guildId).currentUserId = songNew.addedByUserId;
-		if (songNew.type == song_type::SoundCloud) {
+		for (uint64_t x = 0; x < prefetchedSongs.size(); ++x) {
+			if (prefetchedSongs[x]->songVal.songId != songNew.songId || prefetchedSongs[x]->songVal.type != songNew.type) {
+				continue;
+			}
+			auto prefetchedSongNew = std::move(prefetchedSongs[x]);
+			prefetchedSongs.erase(prefetchedSongs.begin() + static_cast<int64_t>(x));
+			if (prefetchedSongNew->sink->goLive()) {
+				taskThread = std::move(prefetchedSongNew->task);
+				return discord_core_client::getVoiceConnection(guildId).play();
+			} else if (prefetchedSongNew->task.getStatus() == co_routine_status::running) {
+				prefetchedSongNew->task.cancelAndWait();
+			}
+			break;
+		}
+		if (auto cachedTrack = discord_core_internal::encoded_track_cache::getTrack(songNew.type, songNew.songId); cachedTrack && songNew.type != song_type::Local) {
+			taskThread = streamCachedTrack(std::move(cachedTrack));
+		} else if (songNew.type == song_type::Local) {
+			taskThread = streamLocalFile(songNew);
+		} else if (songNew.type == song_type::SoundCloud) {
 			song newerSong{ discord_core_client::getSoundCloudAPI(guildId).collectFinalSong(songNew) };
-			taskThread = discord_core_client::getSoundCloudAPI(guildId).downloadAndStreamAudio(newerSong);
+			taskThread = discord_core_client::getSoundCloudAPI(guildId).downloadAndStreamAudio(newerSong, std::make_shared<discord_core_internal::song_stream_sink>(guildId));
 
 		} else if (songNew.type == song_type::YouTube) {
 			song newerSong{ discord_core_client::getYouTubeAPI(guildId).collectFinalSong(songNew) };
-			taskThread = discord_core_client::getYouTubeAPI(guildId).downloadAndStreamAudio(newerSong);
+			taskThread = discord_core_client::getYouTubeAPI(guildId).downloadAndStreamAudio(newerSong, std::make_shared<discord_core_internal::song_stream_sink>(guildId));
 		};
 		return discord_core_client::getVoiceConnection(guildId).play();
 	}
@@ -121,7 +288,155 @@ namespace discord_core_api {
 		return returnValue;
 	}
 
+	download_health_metrics song_api::getBufferHealth() {
+		std::unique_lock lock{ bufferHealthMutex };
+		return bufferHealth;
+	}
+
+	void song_api::updateBufferHealth(const download_health_metrics& metrics) {
+		std::unique_lock lock{ bufferHealthMutex };
+		bufferHealth = metrics;
+	}
+
+	song song_api::collectLocalSong(jsonifier::string_view filePath) {
+		const std::filesystem::path path{ std::string{ filePath.data(), filePath.size() } };
+		const std::string fileName{ path.stem().string() };
+		song newSong{};
+		newSong.type			 = song_type::Local;
+		newSong.firstDownloadUrl = jsonifier::string{ filePath };
+		newSong.songTitle		 = jsonifier::string{ jsonifier::string_view{ fileName.data(), fileName.size() } };
+		newSong.viewUrl			 = newSong.firstDownloadUrl;
+		newSong.songId			 = newSong.firstDownloadUrl;
+		std::error_code errorCode{};
+		if (auto fileSize = std::filesystem::file_size(path, errorCode); !errorCode) {
+			newSong.contentLength = static_cast<uint64_t>(fileSize);
+		}
+		return newSong;
+	}
+
+	void song_api::setTrackCacheCapacity(uint64_t byteCount) {
+		discord_core_internal::encoded_track_cache::setCapacity(byteCount);
+	}
+
+	co_routine<void, false> song_api::streamCachedTrack(std::shared_ptr<const discord_core_internal::cached_track> track) {
+		auto threadHandle = co_await newThreadAwaitable<void, false>();
+		for (auto& value: track->frames) {
+			if (!waitForBufferSpace(*this, threadHandle)) {
+				co_return;
+			}
+			audioDataBuffer.send(audio_frame_data{ value });
+		}
+		discord_core_client::getVoiceConnection(guildId).skip(false);
+		audio_frame_data frameData{};
+		audioDataBuffer.send(std::move(frameData));
+		co_return;
+	}
+
+	co_routine<void, false> song_api::streamLocalFile(const song songNew) {
+		auto threadHandle = co_await newThreadAwaitable<void, false>();
+		discord_core_internal::memory_mapped_file file{ songNew.firstDownloadUrl };
+		if (!file.isItMapped()) {
+			message_printer::printError<print_message_type::general>("song_api::streamLocalFile() error: failed to map file: " + songNew.firstDownloadUrl);
+			discord_core_client::getVoiceConnection(guildId).skip(true);
+			co_return;
+		}
+		static constexpr uint8_t matroskaMagic[]{ 0x1A, 0x45, 0xDF, 0xA3 };
+		static constexpr uint8_t oggMagic[]{ 'O', 'g', 'g', 'S' };
+		auto fileData = file.getView();
+		bool didWeFinish{};
+		if (fileData.size() >= 4 && std::equal(std::begin(matroskaMagic), std::end(matroskaMagic), fileData.data())) {
+			didWeFinish = demuxLocalData<discord_core_internal::matroska_demuxer>(*this, fileData, threadHandle);
+		} else if (fileData.size() >= 4 && std::equal(std::begin(oggMagic), std::end(oggMagic), fileData.data())) {
+			didWeFinish = demuxLocalData<discord_core_internal::ogg_demuxer>(*this, fileData, threadHandle);
+		} else {
+			message_printer::printError<print_message_type::general>("song_api::streamLocalFile() error: unsupported file format: " + songNew.firstDownloadUrl);
+			discord_core_client::getVoiceConnection(guildId).skip(true);
+			co_return;
+		}
+		if (!didWeFinish) {
+			co_return;
+		}
+		discord_core_client::getVoiceConnection(guildId).skip(false);
+		audio_frame_data frameData{};
+		audioDataBuffer.send(std::move(frameData));
+		co_return;
+	}
+
+	void song_api::prefetch(const jsonifier::vector<song>& upcomingSongs) {
+		std::unique_lock lock{ accessMutex };
+		const uint64_t depth{ std::min(prefetchSettings.depth, static_cast<uint64_t>(upcomingSongs.size())) };
+		auto isItUpcoming = [&](const song& songNew) {
+			return std::any_of(upcomingSongs.begin(), upcomingSongs.begin() + static_cast<int64_t>(depth), [&](const song& value) {
+				return value.songId == songNew.songId && value.type == songNew.type;
+			});
+		};
+		for (uint64_t x = 0; x < prefetchedSongs.size();) {
+			if (isItUpcoming(prefetchedSongs[x]->songVal)) {
+				++x;
+				continue;
+			}
+			if (prefetchedSongs[x]->task.getStatus() == co_routine_status::running) {
+				prefetchedSongs[x]->task.cancelAndWait();
+			}
+			prefetchedSongs.erase(prefetchedSongs.begin() + static_cast<int64_t>(x));
+		}
+		for (uint64_t x = 0; x < depth; ++x) {
+			const song& value{ upcomingSongs[x] };
+			if (value.songId == "" || value.type == song_type::Local || value.type == song_type::Neutral) {
+				continue;
+			}
+			if (std::any_of(prefetchedSongs.begin(), prefetchedSongs.end(), [&](const auto& valueNew) {
+					return valueNew->songVal.songId == value.songId && valueNew->songVal.type == value.type;
+				})) {
+				continue;
+			}
+			auto newPrefetchedSong{ makeUnique<prefetched_song>() };
+			newPrefetchedSong->songVal = value;
+			newPrefetchedSong->sink	   = std::make_shared<discord_core_internal::song_stream_sink>(guildId, prefetchSettings.bufferDuration, prefetchSettings.maxBytes / depth);
+			newPrefetchedSong->task	   = prefetchSong(value, newPrefetchedSong->sink);
+			prefetchedSongs.emplace_back(std::move(newPrefetchedSong));
+		}
+	}
+
+	void song_api::setPrefetchSettings(const song_prefetch_settings& settings) {
+		std::unique_lock lock{ accessMutex };
+		prefetchSettings = settings;
+	}
+
+	co_routine<void, false> song_api::prefetchSong(const song songNew, std::shared_ptr<discord_core_internal::song_stream_sink> sink) {
+		auto threadHandle = co_await newThreadAwaitable<void, false>();
+		try {
+			// The downloads run inline on this co_routine's thread, since they are handed its handle.
+			if (songNew.type == song_type::SoundCloud) {
+				song newerSong{ discord_core_client::getSoundCloudAPI(guildId).collectFinalSong(songNew) };
+				if (!threadHandle.promise().stopRequested()) {
+					discord_core_client::getSoundCloudAPI(guildId).downloadAndStreamAudio(newerSong, sink, threadHandle);
+				}
+			} else if (songNew.type == song_type::YouTube) {
+				song newerSong{ discord_core_client::getYouTubeAPI(guildId).collectFinalSong(songNew) };
+				if (!threadHandle.promise().stopRequested()) {
+					discord_core_client::getYouTubeAPI(guildId).downloadAndStreamAudio(newerSong, sink, threadHandle);
+				}
+			}
+		} catch (const dca_exception& error) {
+			message_printer::printError<print_message_type::general>("song_api::prefetchSong() error: " + jsonifier::string{ error.what() });
+			sink->fail();
+		}
+		co_return;
+	}
+
+	void song_api::cancelPrefetches() {
+		std::unique_lock lock{ accessMutex };
+		for (auto& value: prefetchedSongs) {
+			if (value->task.getStatus() == co_routine_status::running) {
+				value->task.cancelAndWait();
+			}
+		}
+		prefetchedSongs.clear();
+	}
+
 	void song_api::disconnect() {
+		cancelPrefetches();
 		if (taskThread.getStatus() == co_routine_status::running) {
 			taskThread.cancelAndWait();
 		}
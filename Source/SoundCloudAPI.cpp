@@ -32,6 +32,8 @@
 #include <discordcoreapi/DiscordCoreClient.hpp>
 #include <discordcoreapi/Utilities/AudioEncoder.hpp>
 #include <discordcoreapi/VoiceConnection.hpp>
+#include <discordcoreapi/Utilities/DownloadEngine.hpp>
+#include <discordcoreapi/Utilities/AudioSources.hpp>
 #include <discordcoreapi/Utilities/Demuxers.hpp>
 
 namespace jsonifier {
@@ -317,11 +319,11 @@ namespace discord_core_api {
 					auto headersNew								= submitWorkloadAndGetResult(std::move(dataPackage02));
 					uint64_t valueBitRate{};
 					uint64_t valueLength{};
-					if (headersNew.responseHeaders.find("x-amz-meta-bitrate") != headersNew.responseHeaders.end()) {
-						valueBitRate = jsonifier::strToUint64(headersNew.responseHeaders.find("x-amz-meta-bitrate")->second.data());
+					if (headersNew.responseHeaders.contains("x-amz-meta-bitrate")) {
+						valueBitRate = jsonifier::strToUint64(headersNew.responseHeaders.at("x-amz-meta-bitrate").data());
 					}
-					if (headersNew.responseHeaders.find("x-amz-meta-duration") != headersNew.responseHeaders.end()) {
-						valueLength = jsonifier::strToUint64(headersNew.responseHeaders.find("x-amz-meta-duration")->second.data());
+					if (headersNew.responseHeaders.contains("x-amz-meta-duration")) {
+						valueLength = jsonifier::strToUint64(headersNew.responseHeaders.at("x-amz-meta-duration").data());
 					}
 					download_url downloadUrlNew{};
 					downloadUrlNew.contentSize = static_cast<uint64_t>(((valueBitRate * valueLength) / 8) - 193);
@@ -397,89 +399,86 @@ namespace discord_core_api {
 			}
 		}
 
-		void sound_cloud_api::weFailedToDownloadOrDecode(const song& songNew, std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle, uint64_t recursionDepth) {
+		void sound_cloud_api::weFailedToDownloadOrDecode(const song& songNew, std::shared_ptr<song_stream_sink> sink,
+			std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle, uint64_t recursionDepth) {
 			std::this_thread::sleep_for(1s);
 			if (recursionDepth < 10) {
 				++recursionDepth;
 				song songNewer = constructDownloadInfo(songNew, 0);
-				downloadAndStreamAudio(songNewer, threadHandle, recursionDepth);
+				downloadAndStreamAudio(songNewer, sink, threadHandle, recursionDepth);
 			} else {
-				discord_core_client::getVoiceConnection(guildId).skip(true);
+				sink->fail();
 			}
 		}
 
 		bool sound_cloud_api::areWeWorking() {
-			return areWeWorkingBool.load(std::memory_order_acquire);
+			return activeDownloads.load(std::memory_order_acquire) > 0;
 		}
 
-		co_routine<void, false> sound_cloud_api::downloadAndStreamAudio(const song songNew, std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle,
-			uint64_t currentReconnectTries) {
+		co_routine<void, false> sound_cloud_api::downloadAndStreamAudio(const song songNew, std::shared_ptr<song_stream_sink> sink,
+			std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle, uint64_t currentReconnectTries) {
+			active_download_guard downloadGuard{ activeDownloads };
 			try {
-				areWeWorkingBool.store(true, std::memory_order_release);
-				if (currentReconnectTries == 0) {
+				if (!threadHandle) {
 					threadHandle = co_await newThreadAwaitable<void, false>();
 				}
-				uint64_t counter{};
-				jsonifier::vector<https_workload_data> workloadVector{};
-				for (uint64_t x = 0; x < songNew.finalDownloadUrls.size(); ++x) {
+				if (songNew.finalDownloadUrls.size() == 0) {
+					weFailedToDownloadOrDecode(songNew, sink, threadHandle, currentReconnectTries);
+					co_return;
+				}
+				auto buildWorkload = [&](uint64_t x) {
+					static constexpr jsonifier::string_view mediaBaseUrl{ "https://cf-hls-opus-media.sndcdn.com/media/" };
 					https_workload_data dataPackage03{ https_workload_type::SoundCloud_Get_Search_Results };
-					if (counter < songNew.finalDownloadUrls.size()) {
-						jsonifier::string baseUrlNew =
-							songNew.finalDownloadUrls.at(x).urlPath.substr(0, jsonifier::string_view{ "https://cf-hls-opus-media.sndcdn.com/media/" }.size());
-						jsonifier::string relativeUrl =
-							songNew.finalDownloadUrls.at(x).urlPath.substr(jsonifier::string_view{ "https://cf-hls-opus-media.sndcdn.com/media/" }.size());
-						dataPackage03.baseUrl	   = baseUrlNew;
-						dataPackage03.relativePath = relativeUrl;
-					}
+					dataPackage03.baseUrl		= songNew.finalDownloadUrls.at(x).urlPath.substr(0, mediaBaseUrl.size());
+					dataPackage03.relativePath	= songNew.finalDownloadUrls.at(x).urlPath.substr(mediaBaseUrl.size());
 					dataPackage03.workloadClass = https_workload_class::Get;
-					workloadVector.emplace_back(std::move(dataPackage03));
-				}
-				jsonifier::vector<jsonifier::string> buffer{};
+					return dataPackage03;
+				};
+				ranged_download_engine engine{ *this, songNew.finalDownloadUrls.size(), buildWorkload };
+				auto& songAPI{ discord_core_client::getSongAPI(guildId) };
+				encoded_track_recorder trackRecorder{};
 				ogg_demuxer demuxer{};
-				for (uint64_t x = 0; x < songNew.finalDownloadUrls.size(); ++x) {
-					https_response_data result{ submitWorkloadAndGetResult(std::move(workloadVector.at(x))) };
-					if (result.responseCode != 200) {
-						weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
-						areWeWorkingBool.store(false, std::memory_order_release);
+				jsonifier::string segment{};
+				while (!engine.areWeDone() && !threadHandle.promise().stopRequested()) {
+					engine.reportBufferLevel(sink->getBufferedDuration());
+					if (engine.didWeFail()) {
+						if (sink->isItLive()) {
+							songAPI.updateBufferHealth(engine.getMetrics());
+						}
+						weFailedToDownloadOrDecode(songNew, sink, threadHandle, currentReconnectTries);
 						co_return;
 					}
-
-					if (result.responseData.size() > 0) {
-						buffer.emplace_back(std::move(result.responseData));
-						demuxer.writeData({ buffer.back().data(), buffer.back().size() });
+					if (engine.collectSegment(segment, 20ms)) {
+						demuxer.writeData({ segment.data(), segment.size() });
 						demuxer.proceedDemuxing();
 					}
-					if (threadHandle.promise().stopRequested()) {
-						areWeWorkingBool.store(false, std::memory_order_release);
-						co_return;
+					if (sink->isItLive()) {
+						songAPI.updateBufferHealth(engine.getMetrics());
 					}
 					bool didWeReceive{ true };
 					do {
 						audio_frame_data frameData{};
 						didWeReceive = demuxer.collectFrame(frameData);
 						if (threadHandle.promise().stopRequested()) {
-							areWeWorkingBool.store(false, std::memory_order_release);
 							co_return;
 						}
 						if (frameData.currentSize != 0) {
-							discord_core_client::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
+							trackRecorder.recordFrame(frameData);
+							if (!sink->sendFrame(std::move(frameData), threadHandle)) {
+								co_return;
+							}
 						}
 					} while (didWeReceive && !threadHandle.promise().stopRequested());
-					if (threadHandle.promise().stopRequested()) {
-						areWeWorkingBool.store(false, std::memory_order_release);
-						co_return;
-					}
-					std::this_thread::sleep_for(1ms);
 				}
-				areWeWorkingBool.store(false, std::memory_order_release);
-				discord_core_client::getVoiceConnection(guildId).skip(false);
-				audio_frame_data frameData{};
-				discord_core_client::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
+				if (threadHandle.promise().stopRequested()) {
+					co_return;
+				}
+				trackRecorder.commit(songNew.type, songNew.songId);
+				sink->finish();
 				co_return;
 			} catch (const https_error& error) {
 				message_printer::printError<print_message_type::https>("sound_cloud_request_builder::downloadAndStreamAudio() Error: " + jsonifier::string{ error.what() });
-				weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
-				areWeWorkingBool.store(false, std::memory_order_release);
+				weFailedToDownloadOrDecode(songNew, sink, threadHandle, currentReconnectTries);
 			}
 			co_return;
 		}
@@ -0,0 +1,177 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ThreadPlacement.cpp - Source file for pinning threads to cpus.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file ThreadPlacement.cpp
+
+#include <discordcoreapi/Utilities/ThreadPlacement.hpp>
+#include <filesystem>
+#include <fstream>
+
+#if defined(_WIN32)
+	#include <Windows.h>
+#else
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// Reads a sysfs cpu list, such as "0-3,8-11".
+		static jsonifier::vector<uint32_t> parseCpuList(const std::string& list) {
+			jsonifier::vector<uint32_t> returnData{};
+			uint64_t index{};
+			while (index < list.size()) {
+				uint64_t end{ std::min(list.find(',', index), list.size()) };
+				std::string range{ list.substr(index, end - index) };
+				uint64_t dash{ range.find('-') };
+				try {
+					uint32_t first{ static_cast<uint32_t>(std::stoul(range.substr(0, dash))) };
+					uint32_t last{ dash == std::string::npos ? first : static_cast<uint32_t>(std::stoul(range.substr(dash + 1))) };
+					for (uint32_t x = first; x <= last; ++x) {
+						returnData.emplace_back(x);
+					}
+				} catch (const std::exception&) {
+				}
+				index = end + 1;
+			}
+			return returnData;
+		}
+
+		static std::thread::native_handle_type getCurrentThread() {
+#if defined(_WIN32)
+			return GetCurrentThread();
+#else
+			return pthread_self();
+#endif
+		}
+
+		/// The cpus that the calling thread may run on - on windows, the process's, as a thread's own mask can only be read back by replacing it.
+		static jsonifier::vector<uint32_t> getCurrentThreadAffinity() {
+			jsonifier::vector<uint32_t> returnData{};
+#if defined(__linux__)
+			cpu_set_t cpus{};
+			if (pthread_getaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0) {
+				for (uint32_t x = 0; x < CPU_SETSIZE; ++x) {
+					if (CPU_ISSET(x, &cpus)) {
+						returnData.emplace_back(x);
+					}
+				}
+			}
+#elif defined(_WIN32)
+			DWORD_PTR processMask{};
+			DWORD_PTR systemMask{};
+			if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) {
+				for (uint32_t x = 0; x < sizeof(DWORD_PTR) * 8; ++x) {
+					if (processMask & (DWORD_PTR{ 1 } << x)) {
+						returnData.emplace_back(x);
+					}
+				}
+			}
+#endif
+			return returnData;
+		}
+
+		jsonifier::vector<cpu_core_data> getCpuTopology() {
+			jsonifier::vector<cpu_core_data> returnData{};
+			for (uint32_t x = 0; x < std::max(std::thread::hardware_concurrency(), 1u); ++x) {
+				returnData.emplace_back(cpu_core_data{ .numaNode = 0, .cpuIndex = x });
+			}
+#if defined(__linux__)
+			std::error_code error{};
+			for (auto& entry: std::filesystem::directory_iterator{ "/sys/devices/system/node", error }) {
+				std::string name{ entry.path().filename().string() };
+				if (name.size() <= 4 || name.substr(0, 4) != "node" || name.find_first_not_of("0123456789", 4) != std::string::npos) {
+					continue;
+				}
+				std::ifstream file{ entry.path() / "cpulist" };
+				std::string list{};
+				std::getline(file, list);
+				for (auto& value: parseCpuList(list)) {
+					if (value < returnData.size()) {
+						returnData[value].numaNode = static_cast<uint32_t>(std::stoul(name.substr(4)));
+					}
+				}
+			}
+#elif defined(_WIN32)
+			for (auto& value: returnData) {
+				PROCESSOR_NUMBER processor{ .Group = 0, .Number = static_cast<BYTE>(value.cpuIndex), .Reserved = 0 };
+				USHORT node{};
+				if (value.cpuIndex < 64 && GetNumaProcessorNodeEx(&processor, &node) && node != 0xFFFF) {
+					value.numaNode = node;
+				}
+			}
+#endif
+			return returnData;
+		}
+
+		bool setThreadAffinity(std::thread::native_handle_type thread, const jsonifier::vector<uint32_t>& cpus) {
+			if (cpus.size() == 0) {
+				return false;
+			}
+#if defined(__linux__)
+			cpu_set_t cpuSet{};
+			CPU_ZERO(&cpuSet);
+			for (auto& value: cpus) {
+				if (value < CPU_SETSIZE) {
+					CPU_SET(value, &cpuSet);
+				}
+			}
+			return CPU_COUNT(&cpuSet) > 0 && pthread_setaffinity_np(thread, sizeof(cpuSet), &cpuSet) == 0;
+#elif defined(_WIN32)
+			DWORD_PTR mask{};
+			for (auto& value: cpus) {
+				if (value < sizeof(DWORD_PTR) * 8) {
+					mask |= DWORD_PTR{ 1 } << value;
+				}
+			}
+			return mask != 0 && SetThreadAffinityMask(thread, mask) != 0;
+#else
+			static_cast<void>(thread);
+			return false;
+#endif
+		}
+
+		thread_affinity_guard::thread_affinity_guard(const jsonifier::vector<uint32_t>& cpus) {
+			if (cpus.size() > 0) {
+				previousCpus = getCurrentThreadAffinity();
+				if (!setThreadAffinity(getCurrentThread(), cpus)) {
+					previousCpus.clear();
+				}
+			}
+		}
+
+		thread_affinity_guard::~thread_affinity_guard() {
+			if (previousCpus.size() > 0) {
+				setThreadAffinity(getCurrentThread(), previousCpus);
+			}
+		}
+
+	}
+}
@@ -40,6 +40,7 @@
 #include <discordcoreapi/CoRoutine.hpp>
 #include <discordcoreapi/InputEvents.hpp>
 #include <discordcoreapi/Utilities.hpp>
+#include <discordcoreapi/Utilities/ThreadPlacement.hpp>
 #include <fstream>
 #include <time.h>
 
@@ -156,6 +157,74 @@ namespace discord_core_api {
 		return config.shardOptions.numberOfShardsForThisProcess;
 	}
 
+	uint64_t config_manager::getGatewayEventLaneCount() const {
+		return config.gatewayEventLanes == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : config.gatewayEventLanes;
+	}
+
+	uint64_t config_manager::getHttp2ConnectionCount() const {
+		return config.http2Connections;
+	}
+
+	jsonifier::string config_manager::getSessionStateFile() const {
+		return config.sessionStateFile;
+	}
+
+	const cluster_options& config_manager::getClusterOptions() const {
+		return config.clusterOptions;
+	}
+
+	const thread_placement_options& config_manager::getThreadPlacementOptions() const {
+		return config.threadPlacement;
+	}
+
+	jsonifier::vector<uint32_t> config_manager::getShardCores() const {
+		const thread_placement_options& placement{ config.threadPlacement };
+		if (placement.shardCores.size() > 0 || !placement.autoPlaceShards) {
+			return placement.shardCores;
+		}
+		// One cpu from each numa node in turn, so that the agents - each with its lanes on its own cpu - are spread evenly across the nodes.
+		std::vector<std::vector<uint32_t>> nodes{};
+		for (auto& value: discord_core_internal::getCpuTopology()) {
+			if (std::find(placement.httpsCores.begin(), placement.httpsCores.end(), value.cpuIndex) != placement.httpsCores.end() ||
+				std::find(placement.voiceCores.begin(), placement.voiceCores.end(), value.cpuIndex) != placement.voiceCores.end()) {
+				continue;
+			}
+			if (nodes.size() <= value.numaNode) {
+				nodes.resize(value.numaNode + 1);
+			}
+			nodes[value.numaNode].emplace_back(value.cpuIndex);
+		}
+		uint64_t largestNode{};
+		for (auto& value: nodes) {
+			largestNode = std::max(largestNode, static_cast<uint64_t>(value.size()));
+		}
+		jsonifier::vector<uint32_t> returnData{};
+		for (uint64_t x = 0; x < largestNode; ++x) {
+			for (auto& value: nodes) {
+				if (x < value.size()) {
+					returnData.emplace_back(value[x]);
+				}
+			}
+		}
+		return returnData;
+	}
+
+	void config_manager::setShardingOptions(const sharding_options& shardOptionsNew) {
+		config.shardOptions = shardOptionsNew;
+	}
+
+	const interaction_endpoint_options& config_manager::getInteractionEndpointOptions() const {
+		return config.interactionEndpoint;
+	}
+
+	uint64_t config_manager::getInteractionEndpointThreadCount() const {
+		return config.interactionEndpoint.workerThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : config.interactionEndpoint.workerThreads;
+	}
+
+	bool config_manager::doWeConnectToTheGateway() const {
+		return config.interactionEndpoint.port == 0 || !config.interactionEndpoint.disableGateway;
+	}
+
 	jsonifier::string config_manager::getConnectionAddress() const {
 		return config.connectionAddress;
 	}
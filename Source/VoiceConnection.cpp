@@ -98,41 +98,202 @@ namespace discord_core_api {
 		return userId;
 	}
 
-	rtppacket_encrypter::rtppacket_encrypter(uint32_t ssrcNew, const jsonifier::string_base<uint8_t>& keysNew) {
+	jsonifier::string_view getEncryptionModeName(voice_encryption_mode mode) {
+		switch (mode) {
+			case voice_encryption_mode::aead_aes256_gcm_rtpsize: {
+				return "aead_aes256_gcm_rtpsize";
+			}
+			case voice_encryption_mode::aead_xchacha20_poly1305_rtpsize: {
+				return "aead_xchacha20_poly1305_rtpsize";
+			}
+			default: {
+				return "xsalsa20_poly1305";
+			}
+		}
+	}
+
+	voice_encryption_mode selectEncryptionMode(const jsonifier::vector<jsonifier::string>& modes) {
+		voice_encryption_mode returnValue{ voice_encryption_mode::xsalsa20_poly1305 };
+		for (auto& value: modes) {
+			jsonifier::string_view modeName{ value.data(), value.size() };
+			if (modeName == getEncryptionModeName(voice_encryption_mode::aead_aes256_gcm_rtpsize) && crypto_aead_aes256gcm_is_available()) {
+				return voice_encryption_mode::aead_aes256_gcm_rtpsize;
+			} else if (modeName == getEncryptionModeName(voice_encryption_mode::aead_xchacha20_poly1305_rtpsize)) {
+				returnValue = voice_encryption_mode::aead_xchacha20_poly1305_rtpsize;
+			}
+		}
+		return returnValue;
+	}
+
+	rtppacket_encrypter::rtppacket_encrypter(uint32_t ssrcNew, const jsonifier::string_base<uint8_t>& keysNew, voice_encryption_mode modeNew) {
 		keys = keysNew;
 		ssrc = ssrcNew;
+		mode = modeNew;
+		if (mode == voice_encryption_mode::aead_aes256_gcm_rtpsize && keys.size() == crypto_aead_aes256gcm_KEYBYTES) {
+			crypto_aead_aes256gcm_beforenm(&aesState, keys.data());
+		}
 	}
 
-	jsonifier::string_view_base<uint8_t> rtppacket_encrypter::encryptPacket(discord_core_internal::encoder_return_data& audioData) {
-		if (keys.size() > 0) {
-			++sequence;
-			timeStamp += static_cast<uint32_t>(audioData.sampleCount);
-			static constexpr uint8_t headerSize{ 12 };
-			static constexpr uint8_t version{ 0x80 };
-			static constexpr uint8_t flags{ 0x78 };
-			uint8_t header[headerSize]{};
-			discord_core_internal::storeBits(header, version);
-			discord_core_internal::storeBits(header + 1, flags);
-			discord_core_internal::storeBits(header + 2, sequence);
-			discord_core_internal::storeBits(header + 4, timeStamp);
-			discord_core_internal::storeBits(header + 8, ssrc);
-			uint8_t nonceForLibSodium[crypto_secretbox_NONCEBYTES]{};
-			for (int8_t x = 0; x < headerSize; ++x) {
-				nonceForLibSodium[x] = header[x];
+	void rtppacket_encrypter::encryptPackets(jsonifier::vector<rtp_encryption_job>& jobs, jsonifier::string_base<uint8_t>& buffer) {
+		uint64_t totalSize{};
+		for (auto& value: jobs) {
+			totalSize += getMaxPacketSize(value.audioData->data.size());
+		}
+		if (buffer.size() < totalSize) {
+			buffer.resize(totalSize);
+		}
+		uint64_t currentOffset{};
+		for (auto& value: jobs) {
+			const uint64_t packetSize{ value.encrypter->encryptPacket(*value.audioData, buffer.data() + currentOffset) };
+			value.packet = jsonifier::string_view_base<uint8_t>{ buffer.data() + currentOffset, packetSize };
+			currentOffset += packetSize;
+		}
+	}
+
+	uint64_t rtppacket_encrypter::encryptPacket(discord_core_internal::encoder_return_data& audioData, uint8_t* outputBuffer) {
+		if (keys.size() == 0) {
+			return 0;
+		}
+		++sequence;
+		timeStamp += static_cast<uint32_t>(audioData.sampleCount);
+		static constexpr uint8_t version{ 0x80 };
+		static constexpr uint8_t flags{ 0x78 };
+		discord_core_internal::storeBits(outputBuffer, version);
+		discord_core_internal::storeBits(outputBuffer + 1, flags);
+		discord_core_internal::storeBits(outputBuffer + 2, sequence);
+		discord_core_internal::storeBits(outputBuffer + 4, timeStamp);
+		discord_core_internal::storeBits(outputBuffer + 8, ssrc);
+		unsigned long long encryptedSize{};
+		switch (mode) {
+			case voice_encryption_mode::aead_aes256_gcm_rtpsize: {
+				uint8_t nonce[crypto_aead_aes256gcm_NPUBBYTES]{};
+				discord_core_internal::storeBits(nonce, nonceCounter);
+				if (crypto_aead_aes256gcm_encrypt_afternm(outputBuffer + headerSize, &encryptedSize, audioData.data.data(), audioData.data.size(), outputBuffer, headerSize,
+						nullptr, nonce, &aesState) != 0) {
+					return 0;
+				}
+				std::memcpy(outputBuffer + headerSize + encryptedSize, nonce, nonceSize);
+				++nonceCounter;
+				return headerSize + encryptedSize + nonceSize;
 			}
-			const uint64_t numOfBytes{ headerSize + audioData.data.size() + crypto_secretbox_MACBYTES };
-			if (data.size() < numOfBytes) {
-				data.resize(numOfBytes);
+			case voice_encryption_mode::aead_xchacha20_poly1305_rtpsize: {
+				uint8_t nonce[crypto_aead_xchacha20poly1305_ietf_NPUBBYTES]{};
+				discord_core_internal::storeBits(nonce, nonceCounter);
+				if (crypto_aead_xchacha20poly1305_ietf_encrypt(outputBuffer + headerSize, &encryptedSize, audioData.data.data(), audioData.data.size(), outputBuffer, headerSize,
+						nullptr, nonce, keys.data()) != 0) {
+					return 0;
+				}
+				std::memcpy(outputBuffer + headerSize + encryptedSize, nonce, nonceSize);
+				++nonceCounter;
+				return headerSize + encryptedSize + nonceSize;
+			}
+			default: {
+				uint8_t nonce[crypto_secretbox_NONCEBYTES]{};
+				std::memcpy(nonce, outputBuffer, headerSize);
+				if (crypto_secretbox_easy(outputBuffer + headerSize, audioData.data.data(), audioData.data.size(), nonce, keys.data()) != 0) {
+					return 0;
+				}
+				return headerSize + audioData.data.size() + crypto_secretbox_MACBYTES;
 			}
-			for (uint8_t x = 0; x < headerSize; ++x) {
-				data.at(x) = static_cast<uint8_t>(header[x]);
+		}
+	}
+
+	jsonifier::string_view_base<uint8_t> rtppacket_encrypter::encryptPacket(discord_core_internal::encoder_return_data& audioData) {
+		const uint64_t maxPacketSize{ getMaxPacketSize(audioData.data.size()) };
+		if (data.size() < maxPacketSize) {
+			data.resize(maxPacketSize);
+		}
+		const uint64_t packetSize{ encryptPacket(audioData, data.data()) };
+		if (packetSize == 0) {
+			return {};
+		}
+		return jsonifier::string_view_base<uint8_t>{ data.data(), packetSize };
+	}
+
+	rtppacket_decrypter::rtppacket_decrypter(const jsonifier::string_base<uint8_t>& keysNew, voice_encryption_mode modeNew) {
+		keys = keysNew;
+		mode = modeNew;
+		if (mode == voice_encryption_mode::aead_aes256_gcm_rtpsize && keys.size() == crypto_aead_aes256gcm_KEYBYTES) {
+			crypto_aead_aes256gcm_beforenm(&aesState, keys.data());
+		}
+	}
+
+	jsonifier::string_view_base<uint8_t> rtppacket_decrypter::decryptPacket(jsonifier::string_view_base<uint8_t> packet) {
+		static constexpr uint64_t headerSize{ rtppacket_encrypter::headerSize };
+		static constexpr uint64_t extensionHeaderSize{ sizeof(uint16_t) * 2 };
+		if (keys.size() == 0 || packet.size() <= headerSize) {
+			return {};
+		}
+		const uint64_t csrcCount{ static_cast<uint64_t>(packet[0]) & 0b0000'1111 };
+		const bool hasExtension{ static_cast<bool>((packet[0] >> 4) & 0b0001) };
+		uint64_t offsetToData{ headerSize + sizeof(uint32_t) * csrcCount };
+		uint16_t extensionLengthInWords{};
+		unsigned long long decryptedSize{};
+		switch (mode) {
+			case voice_encryption_mode::aead_aes256_gcm_rtpsize: {
+				[[fallthrough]];
+			}
+			case voice_encryption_mode::aead_xchacha20_poly1305_rtpsize: {
+				// The rtpsize modes leave the extension's header unencrypted, as part of the additional data.
+				if (hasExtension) {
+					if (packet.size() < offsetToData + extensionHeaderSize) {
+						return {};
+					}
+					std::memcpy(&extensionLengthInWords, packet.data() + offsetToData + sizeof(uint16_t), sizeof(uint16_t));
+					offsetToData += extensionHeaderSize;
+				}
+				if (packet.size() < offsetToData + rtppacket_encrypter::macSize + rtppacket_encrypter::nonceSize) {
+					return {};
+				}
+				const uint64_t encryptedSize{ packet.size() - offsetToData - rtppacket_encrypter::nonceSize };
+				if (data.size() < encryptedSize) {
+					data.resize(encryptedSize);
+				}
+				uint8_t nonce[crypto_aead_xchacha20poly1305_ietf_NPUBBYTES]{};
+				std::memcpy(nonce, packet.data() + packet.size() - rtppacket_encrypter::nonceSize, rtppacket_encrypter::nonceSize);
+				const uint8_t* encryptedData{ packet.data() + offsetToData };
+				int32_t result{};
+				if (mode == voice_encryption_mode::aead_aes256_gcm_rtpsize) {
+					result =
+						crypto_aead_aes256gcm_decrypt_afternm(data.data(), &decryptedSize, nullptr, encryptedData, encryptedSize, packet.data(), offsetToData, nonce, &aesState);
+				} else {
+					result = crypto_aead_xchacha20poly1305_ietf_decrypt(data.data(), &decryptedSize, nullptr, encryptedData, encryptedSize, packet.data(), offsetToData, nonce,
+						keys.data());
+				}
+				if (result != 0) {
+					return {};
+				}
+				break;
 			}
-			if (crypto_secretbox_easy(data.data() + headerSize, audioData.data.data(), audioData.data.size(), nonceForLibSodium, keys.data()) != 0) {
-				return {};
+			default: {
+				if (packet.size() < offsetToData + crypto_secretbox_MACBYTES) {
+					return {};
+				}
+				const uint64_t encryptedSize{ packet.size() - offsetToData };
+				if (data.size() < encryptedSize) {
+					data.resize(encryptedSize);
+				}
+				uint8_t nonce[crypto_secretbox_NONCEBYTES]{};
+				std::memcpy(nonce, packet.data(), headerSize);
+				if (crypto_secretbox_open_easy(data.data(), packet.data() + offsetToData, encryptedSize, nonce, keys.data()) != 0) {
+					return {};
+				}
+				decryptedSize = encryptedSize - crypto_secretbox_MACBYTES;
+				if (hasExtension) {
+					if (decryptedSize < extensionHeaderSize) {
+						return {};
+					}
+					std::memcpy(&extensionLengthInWords, data.data() + sizeof(uint16_t), sizeof(uint16_t));
+					jsonifier::string_view_base<uint8_t> returnValue{ data.data(), static_cast<uint64_t>(decryptedSize) };
+					const uint64_t extensionLength{ extensionHeaderSize + sizeof(uint32_t) * ntohs(extensionLengthInWords) };
+					return extensionLength <= returnValue.size() ? returnValue.substr(extensionLength) : jsonifier::string_view_base<uint8_t>{};
+				}
+				return jsonifier::string_view_base<uint8_t>{ data.data(), static_cast<uint64_t>(decryptedSize) };
 			}
-			return jsonifier::string_view_base<uint8_t>{ data.data(), numOfBytes };
 		}
-		return {};
+		jsonifier::string_view_base<uint8_t> returnValue{ data.data(), static_cast<uint64_t>(decryptedSize) };
+		const uint64_t extensionLength{ sizeof(uint32_t) * ntohs(extensionLengthInWords) };
+		return extensionLength <= returnValue.size() ? returnValue.substr(extensionLength) : jsonifier::string_view_base<uint8_t>{};
 	}
 
 	moving_averager::moving_averager(uint64_t collectionCountNew) {
@@ -160,13 +321,13 @@ namespace discord_core_api {
 	}
 
 	voice_connection_bridge::voice_connection_bridge(unordered_map<uint64_t, unique_ptr<voice_user>>* voiceUsersPtrNew, jsonifier::string_base<uint8_t>& encryptionKeyNew,
-		stream_type streamType, const jsonifier::string& baseUrlNew, const uint16_t portNew, snowflake guildIdNew,
+		voice_encryption_mode encryptionModeNew, stream_type streamType, const jsonifier::string& baseUrlNew, const uint16_t portNew, snowflake guildIdNew,
 		std::coroutine_handle<discord_core_api::co_routine<void, false>::promise_type>* tokenNew)
 		: udp_connection{ baseUrlNew, portNew, streamType, tokenNew } {
-		voiceUsersPtr = voiceUsersPtrNew;
-		encryptionKey = encryptionKeyNew;
-		guildId		  = guildIdNew;
-		token		  = tokenNew;
+		packetDecrypter = rtppacket_decrypter{ encryptionKeyNew, encryptionModeNew };
+		voiceUsersPtr	= voiceUsersPtrNew;
+		guildId			= guildIdNew;
+		token			= tokenNew;
 	}
 
 	inline void voice_connection_bridge::applyGainRamp(int64_t sampleCount) {
@@ -232,52 +393,23 @@ namespace discord_core_api {
 			jsonifier::string_view_base<uint8_t> payload{ value->extractPayload() };
 			if (payload.size() <= 44) {
 				continue;
-			} else {
-				static constexpr uint64_t headerSize{ 12 };
-				const uint64_t csrcCount{ static_cast<uint64_t>(payload.at(0)) & 0b0000'1111 };
-				const uint64_t offsetToData{ headerSize + sizeof(uint32_t) * csrcCount };
-				const uint64_t encryptedDataLength{ payload.size() - offsetToData };
-
-				if (decryptedDataString.size() < encryptedDataLength) {
-					decryptedDataString.resize(encryptedDataLength);
-				}
-
-				uint8_t nonce[24]{};
-				for (uint64_t x = 0; x < headerSize; ++x) {
-					nonce[x] = payload[x];
-				}
-
-				if (crypto_secretbox_open_easy(decryptedDataString.data(), payload.data() + offsetToData, encryptedDataLength, nonce, encryptionKey.data())) {
-					continue;
-				}
-
-				jsonifier::string_view_base newString{ decryptedDataString.data(), encryptedDataLength - crypto_secretbox_MACBYTES };
-
-				if (static_cast<int8_t>(payload[0] >> 4) & 0b0001) {
-					uint16_t extenstionLengthInWords{};
-					std::memcpy(&extenstionLengthInWords, newString.data() + 2, sizeof(int16_t));
-					extenstionLengthInWords = ntohs(extenstionLengthInWords);
-					const uint64_t extensionLength{ sizeof(uint32_t) * extenstionLengthInWords };
-					const uint64_t extensionHeaderLength{ sizeof(uint16_t) * 2 };
-					newString = newString.substr(extensionHeaderLength + extensionLength);
+			}
+			jsonifier::string_view_base<uint8_t> newString{ packetDecrypter.decryptPacket(payload) };
+			if (newString.size() > 44) {
+				jsonifier::string_view_base<opus_int16> decodedData{};
+				try {
+					decodedData = value->getDecoder().decodeData(newString);
+				} catch (const dca_exception& error) {
+					message_printer::printError<print_message_type::websocket>(error.what());
 				}
-
-				if (newString.size() > 44) {
-					jsonifier::string_view_base<opus_int16> decodedData{};
-					try {
-						decodedData = value->getDecoder().decodeData(newString);
-					} catch (const dca_exception& error) {
-						message_printer::printError<print_message_type::websocket>(error.what());
-					}
-					if (decodedData.size() > 0) {
-						decodedSize = static_cast<int64_t>(std::max(static_cast<uint64_t>(decodedSize), decodedData.size()));
-						++voiceUserCountReal;
-						auto newPtr	  = decodedData.data();
-						auto newerPtr = upSampledVector.data();
-						for (uint64_t x = 0; x < decodedData.size() / audioMixer.byteBlocksPerRegister;
-							 ++x, newPtr += audioMixer.byteBlocksPerRegister, newerPtr += audioMixer.byteBlocksPerRegister) {
-							audioMixer.combineSamples(newPtr, newerPtr);
-						}
+				if (decodedData.size() > 0) {
+					decodedSize = static_cast<int64_t>(std::max(static_cast<uint64_t>(decodedSize), decodedData.size()));
+					++voiceUserCountReal;
+					auto newPtr	  = decodedData.data();
+					auto newerPtr = upSampledVector.data();
+					for (uint64_t x = 0; x < decodedData.size() / audioMixer.byteBlocksPerRegister;
+						 ++x, newPtr += audioMixer.byteBlocksPerRegister, newerPtr += audioMixer.byteBlocksPerRegister) {
+						audioMixer.combineSamples(newPtr, newerPtr);
 					}
 				}
 			}
@@ -358,12 +490,28 @@ namespace discord_core_api {
 		}
 	}
 
+	audio_encoder_settings voice_connection::getEncoderSettings() {
+		static constexpr int32_t defaultBitrate{ 64000 };
+		audio_encoder_settings settings{ voiceConnectInitData.encoderSettings };
+		if (settings.bitrate <= 0) {
+			try {
+				settings.bitrate = static_cast<int32_t>(channels::getCachedChannel({ .channelId = voiceConnectInitData.channelId }).bitrate);
+			} catch (const dca_exception& error) {
+				message_printer::printError<print_message_type::general>(error.what());
+			}
+			if (settings.bitrate <= 0) {
+				settings.bitrate = defaultBitrate;
+			}
+		}
+		return settings;
+	}
+
 	unbounded_message_block<audio_frame_data>& voice_connection::getAudioBuffer() {
 		return discord_core_client::getInstance()->getSongAPI(voiceConnectInitData.guildId).audioDataBuffer;
 	}
 
 	void voice_connection::checkForAndSendHeartBeat(const bool isImmedate) {
-		if (heartBeatStopWatch.hasTimeElapsed() || isImmedate) {
+		if (isHeartBeatDue->exchange(false, std::memory_order_acq_rel) || isImmedate) {
 			discord_core_internal::websocket_message_data<uint32_t> message{};
 			message.jsonifierExcludedKeys.emplace("t");
 			message.jsonifierExcludedKeys.emplace("s");
@@ -380,7 +528,9 @@ namespace discord_core_api {
 				sendSilence();
 			}
 			haveWeReceivedHeartbeatAck = false;
-			heartBeatStopWatch.reset();
+			if (isImmedate && areWeHeartBeating) {
+				startHeartBeating(heartBeatInterval);
+			}
 		}
 	}
 
@@ -418,11 +568,7 @@ namespace discord_core_api {
 				audioSSRC = dataNew.d.ssrc;
 				voiceIp	  = dataNew.d.ip;
 				port	  = dataNew.d.port;
-				for (auto& value: dataNew.d.modes) {
-					if (value == "xsalsa20_poly1305") {
-						audioEncryptionMode = value;
-					}
-				}
+				audioEncryptionMode = selectEncryptionMode(dataNew.d.modes);
 				connectionState.store(voice_connection_state::Initializing_DatagramSocket, std::memory_order_release);
 				break;
 			}
@@ -433,7 +579,7 @@ namespace discord_core_api {
 				for (auto& value: dataNew.d.secretKey) {
 					encryptionKey.pushBack(static_cast<uint8_t>(value));
 				}
-				packetEncrypter = rtppacket_encrypter{ audioSSRC, encryptionKey };
+				packetEncrypter = rtppacket_encrypter{ audioSSRC, encryptionKey, audioEncryptionMode };
 				connectionState.store(voice_connection_state::Collecting_Init_Data, std::memory_order_release);
 				break;
 			}
@@ -458,9 +604,7 @@ namespace discord_core_api {
 			case voice_socket_op_codes::hello: {
 				discord_core_internal::websocket_message_data<voice_connection_hello_data> dataNew{};
 				parser.parseJson<true>(dataNew, data);
-				heartBeatStopWatch = stop_watch<milliseconds>{ dataNew.d.heartBeatInterval };
-				heartBeatStopWatch.reset();
-				areWeHeartBeating = true;
+				startHeartBeating(milliseconds{ dataNew.d.heartBeatInterval });
 				connectionState.store(voice_connection_state::Sending_Identify, std::memory_order_release);
 				currentState.store(discord_core_internal::websocket_state::authenticated, std::memory_order_release);
 				haveWeReceivedHeartbeatAck = true;
@@ -503,20 +647,21 @@ namespace discord_core_api {
 		stopWatch.reset();
 		if (currentReconnectTries >= maxReconnectTries) {
 			doWeQuit->store(true, std::memory_order_release);
+			doWeQuit->notify_all();
 			return;
 		}
 		if (streamSocket) {
 			streamSocket->inputBuffer.clear();
 			streamSocket->outputBuffer.clear();
 		}
-		areWeHeartBeating = false;
+		stopHeartBeating();
 		switch (connectionState.load(std::memory_order_acquire)) {
 			case voice_connection_state::Collecting_Init_Data: {
 				baseShard->voiceConnectionDataBufferMap[voiceConnectInitData.guildId.operator const uint64_t&()] = &voiceConnectionDataBuffer;
 				baseShard->voiceConnectionDataBufferMap[voiceConnectInitData.guildId.operator const uint64_t&()]->clearContents();
 				baseShard->getVoiceConnectionData(voiceConnectInitData);
 
-				if (waitForTimeToPass(voiceConnectionDataBuffer, voiceConnectionData, 10000)) {
+				if (!voiceConnectionDataBuffer.tryReceiveFor(voiceConnectionData, 10000ms)) {
 					onClosed();
 					return;
 				}
@@ -554,7 +699,6 @@ namespace discord_core_api {
 						onClosed();
 						return;
 					}
-					std::this_thread::sleep_for(1ms);
 				}
 				currentReconnectTries = 0;
 				connectInternal();
@@ -593,7 +737,6 @@ namespace discord_core_api {
 						onClosed();
 						return;
 					}
-					std::this_thread::sleep_for(1ms);
 				}
 				connectInternal();
 				break;
@@ -611,7 +754,7 @@ namespace discord_core_api {
 				discord_core_internal::websocket_message_data<discord_core_internal::voice_socket_protocol_payload_data> data{};
 				data.jsonifierExcludedKeys.emplace("t");
 				data.jsonifierExcludedKeys.emplace("s");
-				data.d.data.mode	= audioEncryptionMode;
+				data.d.data.mode	= jsonifier::string{ getEncryptionModeName(audioEncryptionMode) };
 				data.d.data.address = externalIp;
 				data.d.data.port	= port;
 				data.op				= 1;
@@ -638,14 +781,13 @@ namespace discord_core_api {
 						onClosed();
 						return;
 					}
-					std::this_thread::sleep_for(1ms);
 				}
 				baseShard->voiceConnectionDataBufferMap[voiceConnectInitData.guildId.operator const uint64_t&()]->clearContents();
 				connectionState.store(voice_connection_state::Collecting_Init_Data, std::memory_order_release);
 				activeState.store(prevActiveState.load(std::memory_order_acquire), std::memory_order_release);
 				if (voiceConnectInitData.streamInfo.type != stream_type::none) {
-					streamSocket = makeUnique<voice_connection_bridge>(&voiceUsers, encryptionKey, voiceConnectInitData.streamInfo.type, voiceConnectInitData.streamInfo.address,
-						voiceConnectInitData.streamInfo.port, voiceConnectInitData.guildId, &token);
+					streamSocket = makeUnique<voice_connection_bridge>(&voiceUsers, encryptionKey, audioEncryptionMode, voiceConnectInitData.streamInfo.type,
+						voiceConnectInitData.streamInfo.address, voiceConnectInitData.streamInfo.port, voiceConnectInitData.guildId, &token);
 					if (streamSocket->currentStatus != discord_core_internal::connection_status::NO_Error) {
 						onClosed();
 						return;
@@ -659,6 +801,8 @@ namespace discord_core_api {
 
 	co_routine<void, false> voice_connection::runVoice() {
 		token = co_await newThreadAwaitable<void, false>();
+		// The thread is the pool's, so it's handed back its old cpus once the connection is done with it.
+		discord_core_internal::thread_affinity_guard affinityGuard{ configManager->getThreadPlacementOptions().voiceCores };
 		stop_watch<milliseconds> stopWatch{ 20000ms };
 		stopWatch.reset();
 		stop_watch<milliseconds> sendSilenceStopWatch{ 5000ms };
@@ -678,7 +822,6 @@ namespace discord_core_api {
 							if (udpConnection.processIO() != discord_core_internal::connection_status::NO_Error) {
 								onClosed();
 							}
-							std::this_thread::sleep_for(1ms);
 							if (!token.promise().stopRequested() && voice_connection::areWeConnected()) {
 								if (websocket_core::tcpConnection.processIO(10) != discord_core_internal::connection_status::NO_Error) {
 									onClosed();
@@ -700,7 +843,6 @@ namespace discord_core_api {
 							if (udpConnection.processIO() != discord_core_internal::connection_status::NO_Error) {
 								onClosed();
 							}
-							std::this_thread::sleep_for(1ms);
 							if (!token.promise().stopRequested() && voice_connection::areWeConnected()) {
 								if (websocket_core::tcpConnection.processIO(10) != discord_core_internal::connection_status::NO_Error) {
 									onClosed();
@@ -717,6 +859,9 @@ namespace discord_core_api {
 						break;
 					}
 					case voice_active_state::playing: {
+						if (!encoder) {
+							encoder = discord_core_internal::opus_encoder_pool::acquire(getEncoderSettings());
+						}
 						sendSpeakingMessage(false);
 						sendSpeakingMessage(true);
 						sendSilence();
@@ -749,7 +894,7 @@ namespace discord_core_api {
 							jsonifier::string_view_base<uint8_t> frame{};
 							switch (frameType) {
 								case audio_frame_type::raw_pcm: {
-									auto encodedFrameData = encoder.encodeData(jsonifier::string_view_base<uint8_t>(xferAudioData.data.data(), frameSize));
+									auto encodedFrameData = encoder->encodeData(jsonifier::string_view_base<uint8_t>(xferAudioData.data.data(), frameSize));
 									xferAudioData.clearData();
 									if (encodedFrameData.data.size() != 0) {
 										frame = packetEncrypter.encryptPacket(encodedFrameData);
@@ -907,12 +1052,11 @@ namespace discord_core_api {
 		stop_watch<milliseconds> stopWatch{ 5500ms };
 		stopWatch.reset();
 		while (inputStringFirst.size() < 74 && !doWeQuit->load(std::memory_order_acquire) && activeState.load(std::memory_order_acquire) != voice_active_state::exiting) {
-			if (udpConnection.processIO() != discord_core_internal::connection_status::NO_Error) {
+			if (udpConnection.processIO(10) != discord_core_internal::connection_status::NO_Error) {
 				onClosed();
 				return false;
 			}
 			inputStringFirst = udpConnection.getInputBuffer();
-			std::this_thread::sleep_for(1ms);
 			if (stopWatch.hasTimeElapsed()) {
 				return false;
 			}
@@ -933,17 +1077,18 @@ namespace discord_core_api {
 	}
 
 	void voice_connection::sendSilence() {
-		jsonifier::vector<jsonifier::string_base<uint8_t>> frames{};
 		static constexpr uint8_t arrayNew[3]{ 0xf8, 0xff, 0xfe };
-		for (uint64_t x = 0; x < 5; ++x) {
-			discord_core_internal::encoder_return_data frame{};
-			frame.data		  = jsonifier::string_view_base<uint8_t>{ arrayNew, 3 };
-			frame.sampleCount = 3;
-			auto packetNew	  = packetEncrypter.encryptPacket(frame);
-			frames.emplace_back(jsonifier::string_base<uint8_t>{ packetNew.data(), packetNew.size() });
-		}
+		std::array<discord_core_internal::encoder_return_data, 5> frames{};
+		jsonifier::vector<rtp_encryption_job> jobs{};
+		jobs.reserve(frames.size());
 		for (auto& value: frames) {
-			udpConnection.writeData(value);
+			value.data		  = jsonifier::string_view_base<uint8_t>{ arrayNew, 3 };
+			value.sampleCount = 3;
+			jobs.emplace_back(rtp_encryption_job{ .audioData = &value, .encrypter = &packetEncrypter });
+		}
+		rtppacket_encrypter::encryptPackets(jobs, silenceBuffer);
+		for (auto& value: jobs) {
+			udpConnection.writeData(value.packet);
 			if (udpConnection.processIO() != discord_core_internal::connection_status::NO_Error) {
 				onClosed();
 				return;
@@ -974,7 +1119,8 @@ namespace discord_core_api {
 		};
 		udpConnection.disconnect();
 		websocket_core::disconnect();
-		areWeHeartBeating	  = false;
+		discord_core_internal::opus_encoder_pool::release(std::move(encoder));
+		stopHeartBeating();
 		currentReconnectTries = 0;
 		voiceUsers.clear();
 		prevActiveState.store(voice_active_state::stopped, std::memory_order_release);
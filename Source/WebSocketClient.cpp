@@ -182,7 +182,10 @@ namespace discord_core_api {
 		websocket_core& websocket_core::operator=(websocket_core&& other) noexcept {
 			areWeCollectingData.store(other.areWeCollectingData.load(std::memory_order_acquire), std::memory_order_release);
 			currentState.store(other.currentState.load(std::memory_order_acquire), std::memory_order_release);
-			heartBeatStopWatch		   = std::move(other.heartBeatStopWatch);
+			stopHeartBeating();
+			std::swap(isHeartBeatDue, other.isHeartBeatDue);
+			heartBeatTimerId		   = std::exchange(other.heartBeatTimerId, 0);
+			heartBeatInterval		   = other.heartBeatInterval;
 			haveWeReceivedHeartbeatAck = other.haveWeReceivedHeartbeatAck;
 			currentMessage			   = std::move(other.currentMessage);
 			tcpConnection			   = std::move(other.tcpConnection);
@@ -203,6 +206,10 @@ namespace discord_core_api {
 			*this = std::move(other);
 		}
 
+		websocket_core::~websocket_core() {
+			stopHeartBeating();
+		}
+
 		bool websocket_core::connect(const jsonifier::string& baseUrlNew, jsonifier::string_view relativePath, const uint16_t portNew) {
 			tcpConnection = websocket_tcpconnection{ baseUrlNew, portNew, this };
 			if (tcpConnection.currentStatus != connection_status::NO_Error) {
@@ -257,8 +264,29 @@ namespace discord_core_api {
 			}
 		}
 
+		void websocket_core::startHeartBeating(milliseconds interval) {
+			stopHeartBeating();
+			heartBeatInterval = interval;
+			isHeartBeatDue->store(false, std::memory_order_release);
+			heartBeatTimerId = timer_wheel_base::timerWheel.schedule(
+				interval,
+				[isHeartBeatDueNew = isHeartBeatDue] {
+					isHeartBeatDueNew->store(true, std::memory_order_release);
+				},
+				interval);
+			areWeHeartBeating = true;
+		}
+
+		void websocket_core::stopHeartBeating() {
+			if (heartBeatTimerId != 0) {
+				timer_wheel_base::timerWheel.cancel(std::exchange(heartBeatTimerId, 0));
+			}
+			areWeHeartBeating = false;
+		}
+
 		bool websocket_core::checkForAndSendHeartBeat(bool isImmediate) {
-			if ((currentState.load(std::memory_order_acquire) == websocket_state::authenticated && heartBeatStopWatch.hasTimeElapsed() && haveWeReceivedHeartbeatAck) ||
+			if ((currentState.load(std::memory_order_acquire) == websocket_state::authenticated && haveWeReceivedHeartbeatAck &&
+					isHeartBeatDue->exchange(false, std::memory_order_acq_rel)) ||
 				isImmediate) {
 				jsonifier::string_base<uint8_t> string{};
 				if (dataOpCode == websocket_op_code::Op_Binary) {
@@ -273,7 +301,10 @@ namespace discord_core_api {
 					parser.serializeJson(message, string);
 				}
 				haveWeReceivedHeartbeatAck = false;
-				heartBeatStopWatch.reset();
+				if (isImmediate && areWeHeartBeating) {
+					// The next beat is due a whole interval after this one.
+					startHeartBeating(heartBeatInterval);
+				}
 				createHeader(string, dataOpCode);
 				return sendMessage(string, true);
 			}
@@ -519,6 +550,410 @@ namespace discord_core_api {
 			}
 		}
 
+		/// Guild creates, updates and deletes carry the guild's id as "id", the other guild events as "guild_id", and direct messages are ordered per channel.
+		uint64_t getRoutingKey(uint64_t eventType, jsonifier::string_view_base<uint8_t> dataNew) {
+			uint64_t routingKey{ gateway_event_executor::findDispatchValue(dataNew, eventType >= 18 && eventType <= 20 ? "id" : "guild_id") };
+			return routingKey != 0 ? routingKey : gateway_event_executor::findDispatchValue(dataNew, "channel_id");
+		}
+
+		void websocket_client::processDispatch(jsonifier::jsonifier_core<false>& parser, uint64_t eventType, jsonifier::string_view_base<uint8_t> dataNew) {
+			switch (eventType) {
+				case 3: {
+					if (discord_core_client::getInstance()->eventManager.onApplicationCommandPermissionsUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_application_command_permissions_update_data> dataPackage{ makeUnique<on_application_command_permissions_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onApplicationCommandPermissionsUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 4: {
+					if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleCreationEvent.functions.size() > 0) {
+						unique_ptr<on_auto_moderation_rule_creation_data> dataPackage{ makeUnique<on_auto_moderation_rule_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onAutoModerationRuleCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 5: {
+					if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_auto_moderation_rule_update_data> dataPackage{ makeUnique<on_auto_moderation_rule_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onAutoModerationRuleUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 6: {
+					if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleDeletionEvent.functions.size() > 0) {
+						unique_ptr<on_auto_moderation_rule_deletion_data> dataPackage{ makeUnique<on_auto_moderation_rule_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onAutoModerationRuleDeletionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 7: {
+					if (discord_core_client::getInstance()->eventManager.onAutoModerationActionExecutionEvent.functions.size() > 0) {
+						unique_ptr<on_auto_moderation_action_execution_data> dataPackage{ makeUnique<on_auto_moderation_action_execution_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onAutoModerationActionExecutionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 8: {
+					unique_ptr<on_channel_creation_data> dataPackage{ makeUnique<on_channel_creation_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onChannelCreationEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onChannelCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 9: {
+					unique_ptr<on_channel_update_data> dataPackage{ makeUnique<on_channel_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onChannelUpdateEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onChannelUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 10: {
+					unique_ptr<on_channel_deletion_data> dataPackage{ makeUnique<on_channel_deletion_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onChannelDeletionEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onChannelDeletionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 11: {
+					if (discord_core_client::getInstance()->eventManager.onChannelPinsUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_channel_pins_update_data> dataPackage{ makeUnique<on_channel_pins_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onChannelPinsUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 12: {
+					if (discord_core_client::getInstance()->eventManager.onThreadCreationEvent.functions.size() > 0) {
+						unique_ptr<on_thread_creation_data> dataPackage{ makeUnique<on_thread_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 13: {
+					if (discord_core_client::getInstance()->eventManager.onThreadUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_thread_update_data> dataPackage{ makeUnique<on_thread_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 14: {
+					if (discord_core_client::getInstance()->eventManager.onThreadDeletionEvent.functions.size() > 0) {
+						unique_ptr<on_thread_deletion_data> dataPackage{ makeUnique<on_thread_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadDeletionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 15: {
+					if (discord_core_client::getInstance()->eventManager.onThreadListSyncEvent.functions.size() > 0) {
+						unique_ptr<on_thread_list_sync_data> dataPackage{ makeUnique<on_thread_list_sync_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadListSyncEvent(*dataPackage);
+					}
+					break;
+				}
+				case 16: {
+					if (discord_core_client::getInstance()->eventManager.onThreadMemberUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_thread_member_update_data> dataPackage{ makeUnique<on_thread_member_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadMemberUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 17: {
+					if (discord_core_client::getInstance()->eventManager.onThreadMembersUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_thread_members_update_data> dataPackage{ makeUnique<on_thread_members_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadMembersUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 18: {
+					unique_ptr<on_guild_creation_data> dataPackage{ makeUnique<on_guild_creation_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildCreationEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 19: {
+					unique_ptr<on_guild_update_data> dataPackage{ makeUnique<on_guild_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildUpdateEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 20: {
+					unique_ptr<on_guild_deletion_data> dataPackage{ makeUnique<on_guild_deletion_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildDeletionEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildDeletionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 21: {
+					if (discord_core_client::getInstance()->eventManager.onGuildBanAddEvent.functions.size() > 0) {
+						unique_ptr<on_guild_ban_add_data> dataPackage{ makeUnique<on_guild_ban_add_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildBanAddEvent(*dataPackage);
+					}
+					break;
+				}
+				case 22: {
+					if (discord_core_client::getInstance()->eventManager.onGuildBanRemoveEvent.functions.size() > 0) {
+						unique_ptr<on_guild_ban_remove_data> dataPackage{ makeUnique<on_guild_ban_remove_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildBanRemoveEvent(*dataPackage);
+					}
+					break;
+				}
+				case 23: {
+					if (discord_core_client::getInstance()->eventManager.onGuildEmojisUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_guild_emojis_update_data> dataPackage{ makeUnique<on_guild_emojis_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildEmojisUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 24: {
+					if (discord_core_client::getInstance()->eventManager.onGuildStickersUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_guild_stickers_update_data> dataPackage{ makeUnique<on_guild_stickers_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildStickersUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 25: {
+					if (discord_core_client::getInstance()->eventManager.onGuildIntegrationsUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_guild_integrations_update_data> dataPackage{ makeUnique<on_guild_integrations_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildIntegrationsUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 26: {
+					unique_ptr<on_guild_member_add_data> dataPackage{ makeUnique<on_guild_member_add_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildMemberAddEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildMemberAddEvent(*dataPackage);
+					}
+					break;
+				}
+				case 27: {
+					unique_ptr<on_guild_member_remove_data> dataPackage{ makeUnique<on_guild_member_remove_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildMemberRemoveEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildMemberRemoveEvent(*dataPackage);
+					}
+					break;
+				}
+				case 28: {
+					unique_ptr<on_guild_member_update_data> dataPackage{ makeUnique<on_guild_member_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildMemberUpdateEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildMemberUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 29: {
+					unique_ptr<on_guild_members_chunk_data> dataPackage{ makeUnique<on_guild_members_chunk_data>(parser, dataNew) };
+					discord_core_client::getInstance()->guildMemberChunkRequester->onChunk(dataPackage->value);
+					if (discord_core_client::getInstance()->eventManager.onGuildMembersChunkEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildMembersChunkEvent(*dataPackage);
+					}
+					break;
+				}
+				case 30: {
+					unique_ptr<on_role_creation_data> dataPackage{ makeUnique<on_role_creation_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onRoleCreationEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onRoleCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 31: {
+					unique_ptr<on_role_update_data> dataPackage{ makeUnique<on_role_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onRoleUpdateEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onRoleUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 32: {
+					unique_ptr<on_role_deletion_data> dataPackage{ makeUnique<on_role_deletion_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onRoleDeletionEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onRoleDeletionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 33: {
+					if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventCreationEvent.functions.size() > 0) {
+						unique_ptr<on_guild_scheduled_event_creation_data> dataPackage{ makeUnique<on_guild_scheduled_event_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildScheduledEventCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 34: {
+					if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_guild_scheduled_event_update_data> dataPackage{ makeUnique<on_guild_scheduled_event_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildScheduledEventUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 35: {
+					if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventDeletionEvent.functions.size() > 0) {
+						unique_ptr<on_guild_scheduled_event_deletion_data> dataPackage{ makeUnique<on_guild_scheduled_event_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildScheduledEventDeletionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 36: {
+					if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserAddEvent.functions.size() > 0) {
+						unique_ptr<on_guild_scheduled_event_user_add_data> dataPackage{ makeUnique<on_guild_scheduled_event_user_add_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserAddEvent(*dataPackage);
+					}
+					break;
+				}
+				case 37: {
+					if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserRemoveEvent.functions.size() > 0) {
+						unique_ptr<on_guild_scheduled_event_user_remove_data> dataPackage{ makeUnique<on_guild_scheduled_event_user_remove_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserRemoveEvent(*dataPackage);
+					}
+					break;
+				}
+				case 38: {
+					if (discord_core_client::getInstance()->eventManager.onIntegrationCreationEvent.functions.size() > 0) {
+						unique_ptr<on_integration_creation_data> dataPackage{ makeUnique<on_integration_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onIntegrationCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 39: {
+					if (discord_core_client::getInstance()->eventManager.onIntegrationUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_integration_update_data> dataPackage{ makeUnique<on_integration_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onIntegrationUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 40: {
+					if (discord_core_client::getInstance()->eventManager.onIntegrationDeletionEvent.functions.size() > 0) {
+						unique_ptr<on_integration_deletion_data> dataPackage{ makeUnique<on_integration_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onIntegrationDeletionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 41: {
+					unique_ptr<on_interaction_creation_data> dataPackage{ makeUnique<on_interaction_creation_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onInteractionCreationEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onInteractionCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 42: {
+					if (discord_core_client::getInstance()->eventManager.onInviteCreationEvent.functions.size() > 0) {
+						unique_ptr<on_invite_creation_data> dataPackage{ makeUnique<on_invite_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onInviteCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 43: {
+					if (discord_core_client::getInstance()->eventManager.onInviteDeletionEvent.functions.size() > 0) {
+						unique_ptr<on_invite_deletion_data> dataPackage{ makeUnique<on_invite_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onInviteDeletionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 44: {
+					unique_ptr<on_message_creation_data> dataPackage{ makeUnique<on_message_creation_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onMessageCreationEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onMessageCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 45: {
+					unique_ptr<on_message_update_data> dataPackage{ makeUnique<on_message_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onMessageUpdateEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onMessageUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 46: {
+					if (discord_core_client::getInstance()->eventManager.onMessageDeletionEvent.functions.size() > 0) {
+						unique_ptr<on_message_deletion_data> dataPackage{ makeUnique<on_message_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onMessageDeletionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 47: {
+					if (discord_core_client::getInstance()->eventManager.onMessageDeleteBulkEvent.functions.size() > 0) {
+						unique_ptr<on_message_delete_bulk_data> dataPackage{ makeUnique<on_message_delete_bulk_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onMessageDeleteBulkEvent(*dataPackage);
+					}
+					break;
+				}
+				case 48: {
+					if (discord_core_client::getInstance()->eventManager.onReactionAddEvent.functions.size() > 0) {
+						unique_ptr<on_reaction_add_data> dataPackage{ makeUnique<on_reaction_add_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onReactionAddEvent(*dataPackage);
+					}
+					break;
+				}
+				case 49: {
+					if (discord_core_client::getInstance()->eventManager.onReactionRemoveEvent.functions.size() > 0) {
+						unique_ptr<on_reaction_remove_data> dataPackage{ makeUnique<on_reaction_remove_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onReactionRemoveEvent(*dataPackage);
+					}
+					break;
+				}
+				case 50: {
+					if (discord_core_client::getInstance()->eventManager.onReactionRemoveAllEvent.functions.size() > 0) {
+						unique_ptr<on_reaction_remove_all_data> dataPackage{ makeUnique<on_reaction_remove_all_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onReactionRemoveAllEvent(*dataPackage);
+					}
+					break;
+				}
+				case 51: {
+					if (discord_core_client::getInstance()->eventManager.onReactionRemoveEmojiEvent.functions.size() > 0) {
+						unique_ptr<on_reaction_remove_emoji_data> dataPackage{ makeUnique<on_reaction_remove_emoji_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onReactionRemoveEmojiEvent(*dataPackage);
+					}
+					break;
+				}
+				case 52: {
+					unique_ptr<on_presence_update_data> dataPackage{ makeUnique<on_presence_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onPresenceUpdateEvent.functions.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onPresenceUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 53: {
+					if (discord_core_client::getInstance()->eventManager.onStageInstanceCreationEvent.functions.size() > 0) {
+						unique_ptr<on_stage_instance_creation_data> dataPackage{ makeUnique<on_stage_instance_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onStageInstanceCreationEvent(*dataPackage);
+					}
+					break;
+				}
+				case 54: {
+					if (discord_core_client::getInstance()->eventManager.onStageInstanceUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_stage_instance_update_data> dataPackage{ makeUnique<on_stage_instance_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onStageInstanceUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 55: {
+					if (discord_core_client::getInstance()->eventManager.onStageInstanceDeletionEvent.functions.size() > 0) {
+						unique_ptr<on_stage_instance_deletion_data> dataPackage{ makeUnique<on_stage_instance_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onStageInstanceDeletionEvent(*dataPackage);
+					}
+					break;
+				}
+				case 56: {
+					if (discord_core_client::getInstance()->eventManager.onTypingStartEvent.functions.size() > 0) {
+						unique_ptr<on_typing_start_data> dataPackage{ makeUnique<on_typing_start_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onTypingStartEvent(*dataPackage);
+					}
+					break;
+				}
+				case 57: {
+					if (discord_core_client::getInstance()->eventManager.onUserUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_user_update_data> dataPackage{ makeUnique<on_user_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onUserUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+				case 60: {
+					if (discord_core_client::getInstance()->eventManager.onWebhookUpdateEvent.functions.size() > 0) {
+						unique_ptr<on_webhook_update_data> dataPackage{ makeUnique<on_webhook_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onWebhookUpdateEvent(*dataPackage);
+					}
+					break;
+				}
+			}
+		}
+
 		bool websocket_client::onMessageReceived(jsonifier::string_view_base<uint8_t> dataNew) {
 			try {
 				if (areWeConnected() && currentMessage.size() > 0 && dataNew.size() > 0) {
@@ -561,7 +996,8 @@ namespace discord_core_api {
 					switch (static_cast<websocket_op_codes>(message.op)) {
 						case websocket_op_codes::dispatch: {
 							if (message.t != "") {
-								switch (event_converter{ message.t }) {
+								uint64_t eventType{ event_converter{ message.t } };
+								switch (eventType) {
 									case 1: {
 										websocket_message_data<ready_data> data{};
 										if (dataOpCode == websocket_op_code::Op_Text) {
@@ -585,399 +1021,13 @@ namespace discord_core_api {
 												.get() };
 										users::insertUser(static_cast<user_cache_data>(std::move(data.d.user)));
 										currentReconnectTries = 0;
+										onShardReady();
 										break;
 									}
 									case 2: {
 										currentState.store(websocket_state::authenticated, std::memory_order_release);
 										currentReconnectTries = 0;
-										break;
-									}
-									case 3: {
-										if (discord_core_client::getInstance()->eventManager.onApplicationCommandPermissionsUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_application_command_permissions_update_data> dataPackage{ makeUnique<on_application_command_permissions_update_data>(
-												parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onApplicationCommandPermissionsUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 4: {
-										if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleCreationEvent.functions.size() > 0) {
-											unique_ptr<on_auto_moderation_rule_creation_data> dataPackage{ makeUnique<on_auto_moderation_rule_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onAutoModerationRuleCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 5: {
-										if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_auto_moderation_rule_update_data> dataPackage{ makeUnique<on_auto_moderation_rule_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onAutoModerationRuleUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 6: {
-										if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_auto_moderation_rule_deletion_data> dataPackage{ makeUnique<on_auto_moderation_rule_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onAutoModerationRuleDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 7: {
-										if (discord_core_client::getInstance()->eventManager.onAutoModerationActionExecutionEvent.functions.size() > 0) {
-											unique_ptr<on_auto_moderation_action_execution_data> dataPackage{ makeUnique<on_auto_moderation_action_execution_data>(parser,
-												dataNew) };
-											discord_core_client::getInstance()->eventManager.onAutoModerationActionExecutionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 8: {
-										unique_ptr<on_channel_creation_data> dataPackage{ makeUnique<on_channel_creation_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onChannelCreationEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onChannelCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 9: {
-										unique_ptr<on_channel_update_data> dataPackage{ makeUnique<on_channel_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onChannelUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onChannelUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 10: {
-										unique_ptr<on_channel_deletion_data> dataPackage{ makeUnique<on_channel_deletion_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onChannelDeletionEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onChannelDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 11: {
-										if (discord_core_client::getInstance()->eventManager.onChannelPinsUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_channel_pins_update_data> dataPackage{ makeUnique<on_channel_pins_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onChannelPinsUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 12: {
-										if (discord_core_client::getInstance()->eventManager.onThreadCreationEvent.functions.size() > 0) {
-											unique_ptr<on_thread_creation_data> dataPackage{ makeUnique<on_thread_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 13: {
-										if (discord_core_client::getInstance()->eventManager.onThreadUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_thread_update_data> dataPackage{ makeUnique<on_thread_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 14: {
-										if (discord_core_client::getInstance()->eventManager.onThreadDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_thread_deletion_data> dataPackage{ makeUnique<on_thread_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 15: {
-										if (discord_core_client::getInstance()->eventManager.onThreadListSyncEvent.functions.size() > 0) {
-											unique_ptr<on_thread_list_sync_data> dataPackage{ makeUnique<on_thread_list_sync_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadListSyncEvent(*dataPackage);
-										}
-										break;
-									}
-									case 16: {
-										if (discord_core_client::getInstance()->eventManager.onThreadMemberUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_thread_member_update_data> dataPackage{ makeUnique<on_thread_member_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadMemberUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 17: {
-										if (discord_core_client::getInstance()->eventManager.onThreadMembersUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_thread_members_update_data> dataPackage{ makeUnique<on_thread_members_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadMembersUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 18: {
-										unique_ptr<on_guild_creation_data> dataPackage{ makeUnique<on_guild_creation_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildCreationEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 19: {
-										unique_ptr<on_guild_update_data> dataPackage{ makeUnique<on_guild_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 20: {
-										unique_ptr<on_guild_deletion_data> dataPackage{ makeUnique<on_guild_deletion_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildDeletionEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 21: {
-										if (discord_core_client::getInstance()->eventManager.onGuildBanAddEvent.functions.size() > 0) {
-											unique_ptr<on_guild_ban_add_data> dataPackage{ makeUnique<on_guild_ban_add_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildBanAddEvent(*dataPackage);
-										}
-										break;
-									}
-									case 22: {
-										if (discord_core_client::getInstance()->eventManager.onGuildBanRemoveEvent.functions.size() > 0) {
-											unique_ptr<on_guild_ban_remove_data> dataPackage{ makeUnique<on_guild_ban_remove_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildBanRemoveEvent(*dataPackage);
-										}
-										break;
-									}
-									case 23: {
-										if (discord_core_client::getInstance()->eventManager.onGuildEmojisUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_guild_emojis_update_data> dataPackage{ makeUnique<on_guild_emojis_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildEmojisUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 24: {
-										if (discord_core_client::getInstance()->eventManager.onGuildStickersUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_guild_stickers_update_data> dataPackage{ makeUnique<on_guild_stickers_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildStickersUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 25: {
-										if (discord_core_client::getInstance()->eventManager.onGuildIntegrationsUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_guild_integrations_update_data> dataPackage{ makeUnique<on_guild_integrations_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildIntegrationsUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 26: {
-										unique_ptr<on_guild_member_add_data> dataPackage{ makeUnique<on_guild_member_add_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildMemberAddEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildMemberAddEvent(*dataPackage);
-										}
-										break;
-									}
-									case 27: {
-										unique_ptr<on_guild_member_remove_data> dataPackage{ makeUnique<on_guild_member_remove_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildMemberRemoveEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildMemberRemoveEvent(*dataPackage);
-										}
-										break;
-									}
-									case 28: {
-										unique_ptr<on_guild_member_update_data> dataPackage{ makeUnique<on_guild_member_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildMemberUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildMemberUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 29: {
-										if (discord_core_client::getInstance()->eventManager.onGuildMembersChunkEvent.functions.size() > 0) {
-											unique_ptr<on_guild_members_chunk_data> dataPackage{ makeUnique<on_guild_members_chunk_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildMembersChunkEvent(*dataPackage);
-										}
-										break;
-									}
-									case 30: {
-										unique_ptr<on_role_creation_data> dataPackage{ makeUnique<on_role_creation_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onRoleCreationEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onRoleCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 31: {
-										unique_ptr<on_role_update_data> dataPackage{ makeUnique<on_role_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onRoleUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onRoleUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 32: {
-										unique_ptr<on_role_deletion_data> dataPackage{ makeUnique<on_role_deletion_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onRoleDeletionEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onRoleDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 33: {
-										if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventCreationEvent.functions.size() > 0) {
-											unique_ptr<on_guild_scheduled_event_creation_data> dataPackage{ makeUnique<on_guild_scheduled_event_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildScheduledEventCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 34: {
-										if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_guild_scheduled_event_update_data> dataPackage{ makeUnique<on_guild_scheduled_event_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildScheduledEventUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 35: {
-										if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_guild_scheduled_event_deletion_data> dataPackage{ makeUnique<on_guild_scheduled_event_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildScheduledEventDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 36: {
-										if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserAddEvent.functions.size() > 0) {
-											unique_ptr<on_guild_scheduled_event_user_add_data> dataPackage{ makeUnique<on_guild_scheduled_event_user_add_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserAddEvent(*dataPackage);
-										}
-										break;
-									}
-									case 37: {
-										if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserRemoveEvent.functions.size() > 0) {
-											unique_ptr<on_guild_scheduled_event_user_remove_data> dataPackage{ makeUnique<on_guild_scheduled_event_user_remove_data>(parser,
-												dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserRemoveEvent(*dataPackage);
-										}
-										break;
-									}
-									case 38: {
-										if (discord_core_client::getInstance()->eventManager.onIntegrationCreationEvent.functions.size() > 0) {
-											unique_ptr<on_integration_creation_data> dataPackage{ makeUnique<on_integration_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onIntegrationCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 39: {
-										if (discord_core_client::getInstance()->eventManager.onIntegrationUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_integration_update_data> dataPackage{ makeUnique<on_integration_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onIntegrationUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 40: {
-										if (discord_core_client::getInstance()->eventManager.onIntegrationDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_integration_deletion_data> dataPackage{ makeUnique<on_integration_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onIntegrationDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 41: {
-										unique_ptr<on_interaction_creation_data> dataPackage{ makeUnique<on_interaction_creation_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onInteractionCreationEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onInteractionCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 42: {
-										if (discord_core_client::getInstance()->eventManager.onInviteCreationEvent.functions.size() > 0) {
-											unique_ptr<on_invite_creation_data> dataPackage{ makeUnique<on_invite_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onInviteCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 43: {
-										if (discord_core_client::getInstance()->eventManager.onInviteDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_invite_deletion_data> dataPackage{ makeUnique<on_invite_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onInviteDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 44: {
-										unique_ptr<on_message_creation_data> dataPackage{ makeUnique<on_message_creation_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onMessageCreationEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onMessageCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 45: {
-										unique_ptr<on_message_update_data> dataPackage{ makeUnique<on_message_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onMessageUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onMessageUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 46: {
-										if (discord_core_client::getInstance()->eventManager.onMessageDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_message_deletion_data> dataPackage{ makeUnique<on_message_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onMessageDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 47: {
-										if (discord_core_client::getInstance()->eventManager.onMessageDeleteBulkEvent.functions.size() > 0) {
-											unique_ptr<on_message_delete_bulk_data> dataPackage{ makeUnique<on_message_delete_bulk_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onMessageDeleteBulkEvent(*dataPackage);
-										}
-										break;
-									}
-									case 48: {
-										if (discord_core_client::getInstance()->eventManager.onReactionAddEvent.functions.size() > 0) {
-											unique_ptr<on_reaction_add_data> dataPackage{ makeUnique<on_reaction_add_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onReactionAddEvent(*dataPackage);
-										}
-										break;
-									}
-									case 49: {
-										if (discord_core_client::getInstance()->eventManager.onReactionRemoveEvent.functions.size() > 0) {
-											unique_ptr<on_reaction_remove_data> dataPackage{ makeUnique<on_reaction_remove_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onReactionRemoveEvent(*dataPackage);
-										}
-										break;
-									}
-									case 50: {
-										if (discord_core_client::getInstance()->eventManager.onReactionRemoveAllEvent.functions.size() > 0) {
-											unique_ptr<on_reaction_remove_all_data> dataPackage{ makeUnique<on_reaction_remove_all_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onReactionRemoveAllEvent(*dataPackage);
-										}
-										break;
-									}
-									case 51: {
-										if (discord_core_client::getInstance()->eventManager.onReactionRemoveEmojiEvent.functions.size() > 0) {
-											unique_ptr<on_reaction_remove_emoji_data> dataPackage{ makeUnique<on_reaction_remove_emoji_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onReactionRemoveEmojiEvent(*dataPackage);
-										}
-										break;
-									}
-									case 52: {
-										unique_ptr<on_presence_update_data> dataPackage{ makeUnique<on_presence_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onPresenceUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onPresenceUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 53: {
-										if (discord_core_client::getInstance()->eventManager.onStageInstanceCreationEvent.functions.size() > 0) {
-											unique_ptr<on_stage_instance_creation_data> dataPackage{ makeUnique<on_stage_instance_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onStageInstanceCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 54: {
-										if (discord_core_client::getInstance()->eventManager.onStageInstanceUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_stage_instance_update_data> dataPackage{ makeUnique<on_stage_instance_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onStageInstanceUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 55: {
-										if (discord_core_client::getInstance()->eventManager.onStageInstanceDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_stage_instance_deletion_data> dataPackage{ makeUnique<on_stage_instance_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onStageInstanceDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 56: {
-										if (discord_core_client::getInstance()->eventManager.onTypingStartEvent.functions.size() > 0) {
-											unique_ptr<on_typing_start_data> dataPackage{ makeUnique<on_typing_start_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onTypingStartEvent(*dataPackage);
-										}
-										break;
-									}
-									case 57: {
-										if (discord_core_client::getInstance()->eventManager.onUserUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_user_update_data> dataPackage{ makeUnique<on_user_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onUserUpdateEvent(*dataPackage);
-										}
+										onShardReady();
 										break;
 									}
 									case 58: {
@@ -994,11 +1044,18 @@ namespace discord_core_api {
 										}
 										break;
 									}
-									case 60: {
-										if (discord_core_client::getInstance()->eventManager.onWebhookUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_webhook_update_data> dataPackage{ makeUnique<on_webhook_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onWebhookUpdateEvent(*dataPackage);
+									default: {
+										gateway_event eventNew{};
+										eventNew.payload.resize(dataNew.size());
+										std::memcpy(eventNew.payload.data(), dataNew.data(), dataNew.size());
+										eventNew.receivedAt = hrclock::now();
+										eventNew.eventType	= eventType;
+										if (eventType == 41) {
+											// The deadline on an interaction's response runs from here, not from whenever its guild's lane gets to it.
+											discord_core_client::getInstance()->httpsClient->getInteractionResponseLane().recordReceipt(
+												snowflake{ gateway_event_executor::findDispatchValue(dataNew, "id") }, eventNew.receivedAt);
 										}
+										discord_core_client::getInstance()->gatewayEventExecutor->submit(getRoutingKey(eventType, dataNew), shard.at(0), std::move(eventNew));
 										break;
 									}
 								}
@@ -1051,9 +1108,7 @@ namespace discord_core_api {
 								}
 							}
 							if (data.d.heartbeatInterval != 0) {
-								areWeHeartBeating  = true;
-								heartBeatStopWatch = stop_watch<milliseconds>{ milliseconds{ data.d.heartbeatInterval } };
-								heartBeatStopWatch.reset();
+								startHeartBeating(milliseconds{ data.d.heartbeatInterval });
 								haveWeReceivedHeartbeatAck = true;
 							}
 							if (areWeResuming) {
@@ -1141,7 +1196,52 @@ namespace discord_core_api {
 				tcpConnection.writeData(static_cast<jsonifier::string_view>(dataNew), true);
 				tcpConnection.disconnect();
 				currentState.store(websocket_state::disconnected, std::memory_order_release);
-				areWeHeartBeating = false;
+				stopHeartBeating();
+			}
+		}
+
+		void websocket_client::suspend() {
+			if (areWeConnected()) {
+				// Closing with 1012 (service restart), rather than 1000, leaves the session open to be resumed.
+				jsonifier::string dataNew{ "\x03\xF4" };
+				createHeader(dataNew, websocket_op_code::Op_Close);
+				tcpConnection.writeData(static_cast<jsonifier::string_view>(dataNew), true);
+				tcpConnection.disconnect();
+				currentState.store(websocket_state::disconnected, std::memory_order_release);
+				stopHeartBeating();
+			}
+		}
+
+		bool websocket_client::requestGuildMembers(const request_guild_members_payload& payload) {
+			jsonifier::string_base<uint8_t> string{};
+			discord_core_internal::websocket_message_data<request_guild_members_payload> data{};
+			data.d	= payload;
+			data.op = 8;
+			data.jsonifierExcludedKeys.emplace("s");
+			if (data.d.userIds.size() > 0) {
+				data.d.jsonifierExcludedKeys.emplace("query");
+				data.d.jsonifierExcludedKeys.emplace("limit");
+			} else {
+				data.d.jsonifierExcludedKeys.emplace("user_ids");
+			}
+			if (static_cast<websocket_op_code>(dataOpCode) == websocket_op_code::Op_Binary) {
+				auto serializer = data.operator etf_serializer();
+				string			= serializer.operator jsonifier::string_base<uint8_t>();
+			} else {
+				parser.serializeJson(data, string);
+			}
+			createHeader(string, dataOpCode);
+			return sendMessage(string, false);
+		}
+
+		void websocket_client::onShardReady() {
+			auto& scheduler = discord_core_client::getInstance()->shardStartupScheduler;
+			if (scheduler && scheduler->markReady(shard.at(0))) {
+				shard_startup_progress progress{ scheduler->getProgress() };
+				message_printer::printSuccess<print_message_type::websocket>("Shard [" + jsonifier::toString(shard.at(0)) + "," + jsonifier::toString(shard.at(1)) +
+					"] is ready, " + jsonifier::toString(progress.readyShards) + " of " + jsonifier::toString(progress.totalShards) + " shards ready after " +
+					jsonifier::toString(progress.elapsedTime.count()) + "ms (" + jsonifier::toString(progress.connectingShards) + " connecting, " +
+					jsonifier::toString(progress.queuedShards) + " queued).");
 			}
 		}
 
@@ -1155,6 +1255,7 @@ namespace discord_core_api {
 			} else {
 				if (doWeQuit) {
 					doWeQuit->store(true, std::memory_order_release);
+					doWeQuit->notify_all();
 				}
 			}
 		}
@@ -1179,37 +1280,57 @@ namespace discord_core_api {
 			jsonifier::string relativePath{ "/?v=10&encoding=" +
 				jsonifier::string{ discord_core_client::getInstance()->configManager.getTextFormat() == text_format::etf ? "etf" : "json" } };
 
-			value = websocket_client{ value.shard.at(0), doWeQuit };
+			websocket_client valueNew{ value.shard.at(0), doWeQuit };
+			if (value.areWeResuming) {
+				valueNew.lastNumberReceived = value.lastNumberReceived;
+				valueNew.sessionId			= std::move(value.sessionId);
+				valueNew.resumeUrl			= std::move(value.resumeUrl);
+				valueNew.areWeResuming		= true;
+			}
+			value = std::move(valueNew);
 			value.connect(connectionUrl, relativePath, discord_core_client::getInstance()->configManager.getConnectionPort());
 			if (value.tcpConnection.currentStatus != connection_status::NO_Error) {
 				value.onClosed();
 			}
 			value.tcpConnection.processIO(0);
-			discord_core_client::getInstance()->connectionStopWatch01.reset();
 		}
 
 		void base_socket_agent::run(std::stop_token token) {
 			unordered_map<uint64_t, websocket_tcpconnection*> processIOMapNew{};
+			unordered_set<uint64_t> lostShards{};
 			while (!discord_core_client::getInstance()->areWeReadyToConnect.load(std::memory_order_acquire)) {
 				std::this_thread::sleep_for(1ms);
 			}
+			auto& scheduler = *discord_core_client::getInstance()->shardStartupScheduler;
+			std::deque<uint64_t> queuedShards{};
 			for (auto& [key, value]: shardMap) {
-				while (key != discord_core_client::getInstance()->currentlyConnectingShard.load(std::memory_order_acquire) ||
-					!discord_core_client::getInstance()->connectionStopWatch01.hasTimeElapsed()) {
-					processIOMapNew.reserve(shardMap.size());
-					for (auto& [keyNew, valueNew]: shardMap) {
-						if (valueNew.areWeConnected()) {
-							processIOMapNew.emplace(keyNew, &valueNew.tcpConnection);
-						}
+				queuedShards.emplace_back(key);
+			}
+			std::sort(queuedShards.begin(), queuedShards.end());
+			processIOMapNew.reserve(shardMap.size());
+			// The shards' buckets are released by the scheduler, so shards in different buckets connect in parallel - both within this agent, and across
+			// the agents - while the ones that are already up keep being serviced.
+			while (queuedShards.size() > 0 && !token.stop_requested() && !doWeQuit->load(std::memory_order_acquire)) {
+				for (auto& [key, value]: shardMap) {
+					if (value.areWeConnected()) {
+						processIOMapNew.emplace(key, &value.tcpConnection);
+					}
+				}
+				tcp_connection<websocket_tcpconnection>::processIO(processIOMapNew);
+				processIOMapNew.clear();
+				for (auto& [key, value]: shardMap) {
+					sendGuildMemberRequests(key, value);
+				}
+				for (auto iterator = queuedShards.begin(); iterator != queuedShards.end();) {
+					if (scheduler.tryAcquire(*iterator, shardMap[*iterator].areWeResuming)) {
+						connect(shardMap[*iterator]);
+						iterator = queuedShards.erase(iterator);
+					} else {
+						++iterator;
 					}
-					tcp_connection<websocket_tcpconnection>::processIO(processIOMapNew);
-					processIOMapNew.clear();
-					std::this_thread::sleep_for(1ms);
 				}
-				connect(value);
-				discord_core_client::getInstance()->currentlyConnectingShard.fetch_add(1, std::memory_order_release);
+				std::this_thread::sleep_for(1ms);
 			}
-			processIOMapNew.clear();
 			while (!token.stop_requested() && !doWeQuit->load(std::memory_order_acquire)) {
 				try {
 					for (auto& [key, value]: shardMap) {
@@ -1224,15 +1345,20 @@ namespace discord_core_api {
 						if (value.areWeConnected()) {
 							if (value.checkForAndSendHeartBeat()) {
 								on_gateway_ping_data dataNew{};
-								dataNew.timeUntilNextPing = static_cast<int32_t>(value.heartBeatStopWatch.getTotalWaitTime().count());
+								dataNew.timeUntilNextPing = static_cast<int32_t>(value.heartBeatInterval.count());
 								discord_core_client::getInstance()->eventManager.onGatewayPingEvent(dataNew);
 							}
+							sendGuildMemberRequests(key, value);
 							areWeConnected = true;
 						} else {
-							message_printer::printError<print_message_type::websocket>("Connection lost for websocket [" + jsonifier::toString(value.shard.at(0)) + "," +
-								jsonifier::toString(discord_core_client::getInstance()->configManager.getTotalShardCount()) + "]... reconnecting.");
-							std::this_thread::sleep_for(1s);
-							if (discord_core_client::getInstance()->connectionStopWatch01.hasTimeElapsed()) {
+							if (!lostShards.contains(key)) {
+								message_printer::printError<print_message_type::websocket>("Connection lost for websocket [" + jsonifier::toString(value.shard.at(0)) + "," +
+									jsonifier::toString(discord_core_client::getInstance()->configManager.getTotalShardCount()) + "]... reconnecting.");
+								lostShards.emplace(key);
+							}
+							// Only this shard backs off - the others carry on being serviced while it waits.
+							if (scheduler.tryReconnect(key, value.areWeResuming)) {
+								lostShards.erase(key);
 								connect(value);
 							}
 						}
@@ -1246,6 +1372,21 @@ namespace discord_core_api {
 			}
 		}
 
+		void base_socket_agent::sendGuildMemberRequests(uint64_t shardId, websocket_client& value) {
+			if (!value.areWeConnected() || value.currentState.load(std::memory_order_acquire) != websocket_state::authenticated) {
+				return;
+			}
+			request_guild_members_payload payload{};
+			while (discord_core_client::getInstance()->guildMemberChunkRequester->tryPop(shardId, payload)) {
+				if (!value.requestGuildMembers(payload)) {
+					// The command never made it out, so it goes back to the front of the queue for when the shard reconnects.
+					discord_core_client::getInstance()->guildMemberChunkRequester->requeueFront(shardId, std::move(payload));
+					return;
+				}
+				payload = request_guild_members_payload{};
+			}
+		}
+
 		base_socket_agent::~base_socket_agent(){}
 	}// namespace discord_core_internal
 }// namespace discord_core_api
@@ -34,6 +34,8 @@
 #include <discordcoreapi/Utilities/TCPConnection.hpp>
 #include <discordcoreapi/Utilities/AudioEncoder.hpp>
 #include <discordcoreapi/VoiceConnection.hpp>
+#include <discordcoreapi/Utilities/DownloadEngine.hpp>
+#include <discordcoreapi/Utilities/AudioSources.hpp>
 #include <discordcoreapi/Utilities/Demuxers.hpp>
 #include <regex>
 
@@ -325,103 +327,113 @@ namespace discord_core_api {
 			guildId = guildIdNew;
 		}
 
-		void you_tube_api::weFailedToDownloadOrDecode(const song& songNew, std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle, uint64_t recursionDepth) {
+		void you_tube_api::weFailedToDownloadOrDecode(const song& songNew, std::shared_ptr<song_stream_sink> sink,
+			std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle, uint64_t recursionDepth) {
 			std::this_thread::sleep_for(1s);
 			if (recursionDepth < 10) {
 				++recursionDepth;
 				song songNewer = constructDownloadInfo(songNew, 0);
-				downloadAndStreamAudio(songNewer, threadHandle, recursionDepth);
+				downloadAndStreamAudio(songNewer, sink, threadHandle, recursionDepth);
 			} else {
-				discord_core_client::getVoiceConnection(guildId).skip(true);
+				sink->fail();
 			}
 		}
 
-		co_routine<void, false> you_tube_api::downloadAndStreamAudio(const song songNew, std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle,
-			uint64_t currentReconnectTries) {
+		co_routine<void, false> you_tube_api::downloadAndStreamAudio(const song songNew, std::shared_ptr<song_stream_sink> sink,
+			std::coroutine_handle<co_routine<void, false>::promise_type> threadHandle, uint64_t currentReconnectTries) {
+			active_download_guard downloadGuard{ activeDownloads };
 			try {
-				areWeWorkingBool.store(true, std::memory_order_release);
-				if (currentReconnectTries == 0) {
+				if (!threadHandle) {
 					threadHandle = co_await newThreadAwaitable<void, false>();
 				}
 				if (songNew.type != song_type::YouTube) {
 					message_printer::printError<print_message_type::general>("Failed to have the correct song type.");
 					co_return;
 				}
-				uint64_t intervalCount{ songNew.contentLength / (1024ULL * 1024ULL) + 1ULL };
-				uint64_t remainder{ songNew.contentLength % (1024ULL * 1024ULL) };
-				uint64_t currentStart{};
-				uint64_t currentEnd{ intervalCount > 1 ? (1024ULL * 1024ULL) : remainder };
-				jsonifier::vector<https_workload_data> workloadVector{};
-				for (uint64_t x = 0; x < intervalCount; ++x) {
+				static constexpr uint64_t chunkSize{ 1024ULL * 1024ULL };
+				uint64_t intervalCount{ (songNew.contentLength + chunkSize - 1ULL) / chunkSize };
+				if (intervalCount == 0 || songNew.finalDownloadUrls.size() < 2) {
+					weFailedToDownloadOrDecode(songNew, sink, threadHandle, currentReconnectTries);
+					co_return;
+				}
+				auto buildWorkload = [&](uint64_t x) {
+					// The ranges are inclusive, and the demuxer requires them to be contiguous.
+					const uint64_t currentStart{ x * chunkSize };
+					const uint64_t currentEnd{ std::min(currentStart + chunkSize, static_cast<uint64_t>(songNew.contentLength)) - 1ULL };
 					https_workload_data workloadData{ https_workload_type::YouTube_Get_Search_Results };
-					if (songNew.finalDownloadUrls.size() > 0) {
-						if (songNew.finalDownloadUrls.at(0).urlPath.find(".com") != jsonifier::string::npos) {
-							workloadData.baseUrl = songNew.finalDownloadUrls.at(0).urlPath.substr(0, songNew.finalDownloadUrls.at(0).urlPath.find(".com") + 4);
-						}
-					} else {
-						weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
-						areWeWorkingBool.store(false, std::memory_order_release);
-						co_return;
+					if (songNew.finalDownloadUrls.at(0).urlPath.find(".com") != jsonifier::string::npos) {
+						workloadData.baseUrl = songNew.finalDownloadUrls.at(0).urlPath.substr(0, songNew.finalDownloadUrls.at(0).urlPath.find(".com") + 4);
 					}
 					workloadData.workloadClass				   = https_workload_class::Get;
 					workloadData.headersToInsert["User-Agent"] = "com.google.android.youtube/17.10.35 (Linux; U; Android 12; US) gzip";
 					workloadData.headersToInsert["Connection"] = "Keep-Alive";
 					workloadData.headersToInsert["Host"]	   = songNew.finalDownloadUrls.at(0).urlPath;
 					workloadData.headersToInsert["Origin"]	   = "https://music.youtube.com";
-					workloadData.relativePath = songNew.finalDownloadUrls.at(1).urlPath + "&range=" + jsonifier::toString(currentStart) + "-" + jsonifier::toString(currentEnd);
-					workloadVector.emplace_back(std::move(workloadData));
-					currentStart = currentEnd;
-					currentEnd += x == intervalCount - 2 ? remainder : (1024ULL * 1024ULL);
-				}
-				jsonifier::string_base<uint8_t> buffer{};
+					workloadData.relativePath =
+						songNew.finalDownloadUrls.at(1).urlPath + "&range=" + jsonifier::toString(currentStart) + "-" + jsonifier::toString(currentEnd);
+					return workloadData;
+				};
+				ranged_download_engine engine{ *this, intervalCount, buildWorkload };
+				auto& songAPI{ discord_core_client::getSongAPI(guildId) };
+				encoded_track_recorder trackRecorder{};
 				matroska_demuxer demuxer{};
-				uint64_t index{};
-				while (index < intervalCount || !demuxer.areWeDone() && !threadHandle.promise().stopRequested()) {
-					if (index < intervalCount) {
-						https_response_data result{ submitWorkloadAndGetResult(std::move(workloadVector[index])) };
-						if (result.responseCode != 200) {
-							weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
-							areWeWorkingBool.store(false, std::memory_order_release);
-							co_return;
+				jsonifier::string segment{};
+				while (!demuxer.areWeDone() && !threadHandle.promise().stopRequested()) {
+					engine.reportBufferLevel(sink->getBufferedDuration());
+					if (engine.didWeFail()) {
+						if (sink->isItLive()) {
+							songAPI.updateBufferHealth(engine.getMetrics());
 						}
-						if (result.responseData.size() > 0) {
-							++index;
-							auto oldSize = buffer.size();
-							buffer.resize(buffer.size() + result.responseData.size());
-							std::memcpy(buffer.data() + oldSize, result.responseData.data(), result.responseData.size());
-							demuxer.writeData({ buffer.data(), buffer.size() });
-							demuxer.proceedDemuxing();
+						weFailedToDownloadOrDecode(songNew, sink, threadHandle, currentReconnectTries);
+						co_return;
+					}
+					if (engine.collectSegment(segment, 20ms)) {
+						demuxer.writeData({ reinterpret_cast<uint8_t*>(segment.data()), segment.size() });
+						if (engine.areWeDone()) {
+							demuxer.endOfStream();
 						}
+						demuxer.proceedDemuxing();
+					} else if (engine.areWeDone()) {
+						demuxer.endOfStream();
+						demuxer.proceedDemuxing();
+					}
+					if (sink->isItLive()) {
+						songAPI.updateBufferHealth(engine.getMetrics());
 					}
 					bool didWeReceive{ true };
 					do {
 						audio_frame_data frameData{};
 						didWeReceive = demuxer.collectFrame(frameData);
 						if (threadHandle.promise().stopRequested()) {
-							areWeWorkingBool.store(false, std::memory_order_release);
 							co_return;
 						}
 						if (frameData.currentSize != 0) {
-							discord_core_client::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
+							trackRecorder.recordFrame(frameData);
+							if (!sink->sendFrame(std::move(frameData), threadHandle)) {
+								co_return;
+							}
 						}
 					} while (didWeReceive);
-					std::this_thread::sleep_for(1ms);
 				}
-				areWeWorkingBool.store(false, std::memory_order_release);
-				discord_core_client::getVoiceConnection(guildId).skip(false);
-				audio_frame_data frameData{};
-				discord_core_client::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
+				if (threadHandle.promise().stopRequested()) {
+					co_return;
+				}
+				if (demuxer.didWeReachEnd()) {
+					trackRecorder.commit(songNew.type, songNew.songId);
+				} else {
+					message_printer::printError<print_message_type::general>("The track was truncated, so it won't be cached.");
+				}
+				sink->finish();
 				co_return;
 			} catch (const https_error& error) {
 				message_printer::printError<print_message_type::https>("you_tube_api::downloadAndStreamAudio() error: " + jsonifier::string{ error.what() });
-				weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
-				areWeWorkingBool.store(false, std::memory_order_release);
+				weFailedToDownloadOrDecode(songNew, sink, threadHandle, currentReconnectTries);
 			}
 			co_return;
 		}
 
 		bool you_tube_api::areWeWorking() {
-			return areWeWorkingBool.load(std::memory_order_acquire);
+			return activeDownloads.load(std::memory_order_acquire) > 0;
 		}
 
 		jsonifier::vector<song> you_tube_api::searchForSong(jsonifier::string_view searchQuery, uint64_t limit) {
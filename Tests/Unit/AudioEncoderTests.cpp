@@ -0,0 +1,107 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// AudioEncoderTests.cpp - Tests and benchmarks for the opus encoder pool.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file AudioEncoderTests.cpp
+
+#include "UnitTest.hpp"
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// Twenty milliseconds of a 440 Hz tone, as the 48 kHz stereo pcm that the encoder takes.
+		jsonifier::string_base<uint8_t> buildPcmFrame() {
+			jsonifier::string_base<uint8_t> frame{};
+			for (uint64_t x = 0; x < 960; ++x) {
+				int16_t sample{ static_cast<int16_t>(8000.0 * std::sin(2.0 * 3.14159265358979 * 440.0 * static_cast<double>(x) / 48000.0)) };
+				for (uint64_t y = 0; y < 2; ++y) {
+					frame.push_back(static_cast<uint8_t>(sample));
+					frame.push_back(static_cast<uint8_t>(static_cast<uint16_t>(sample) >> 8));
+				}
+			}
+			return frame;
+		}
+
+		/// A released encoder is handed back out, reconfigured, rather than a new one being created.
+		bool testEncoderPool() {
+			bool returnValue{ true };
+			audio_encoder_settings settings{};
+			settings.bitrate = 64000;
+			auto encoder	 = opus_encoder_pool::acquire(settings);
+			auto frame		 = buildPcmFrame();
+			returnValue &= check(encoder->encodeData({ frame.data(), frame.size() }).data.size() > 0, "a pooled encoder encodes a frame");
+			opus_encoder_wrapper* encoderPtr{ encoder.get() };
+			opus_encoder_pool::release(std::move(encoder));
+			settings.voiceSignal = true;
+			settings.complexity	 = 5;
+			auto encoderNew		 = opus_encoder_pool::acquire(settings);
+			returnValue &= check(encoderNew.get() == encoderPtr, "a released encoder is reused");
+			returnValue &= check(encoderNew->encodeData({ frame.data(), frame.size() }).data.size() > 0, "a reused encoder encodes a frame");
+			auto encoderOther = opus_encoder_pool::acquire(settings);
+			returnValue &= check(encoderOther && encoderOther.get() != encoderPtr, "an encoder that's in use isn't handed out twice");
+			opus_encoder_pool::release(std::move(encoderNew));
+			opus_encoder_pool::release(std::move(encoderOther));
+			return returnValue;
+		}
+
+		/// Measures a voice connection's encoder setup - from the pool, and by creating an encoder as connections used to - and a frame's encoding.
+		bool benchmarkEncoderPool() {
+			bool returnValue{ true };
+			static constexpr uint64_t iterationCount{ 10000 };
+			audio_encoder_settings settings{};
+			settings.bitrate = 128000;
+			opus_encoder_pool::release(opus_encoder_pool::acquire(settings));
+			double nsPooled{ benchmark("encoder from the pool", iterationCount, [&](uint64_t) {
+				opus_encoder_pool::release(opus_encoder_pool::acquire(settings));
+			}) };
+			double nsCreated{ benchmark("encoder created", iterationCount, [&](uint64_t) {
+				opus_encoder_wrapper encoder{ settings };
+			}) };
+			std::cout << "Setting up an encoder takes " << nsPooled << " ns from the pool, against " << nsCreated << " ns to create one." << std::endl;
+			auto encoder = opus_encoder_pool::acquire(settings);
+			auto frame	 = buildPcmFrame();
+			uint64_t encodedSize{};
+			double nsEncode{ benchmark("encoding a 20 ms frame", iterationCount, [&](uint64_t) {
+				encodedSize += encoder->encodeData({ frame.data(), frame.size() }).data.size();
+			}) };
+			std::cout << "Encoding a 20 ms frame takes " << nsEncode / 1000.0 << " us, " << nsEncode / 200000.0 << "% of its duration." << std::endl;
+			returnValue &= check(encodedSize > 0, "every benchmarked frame encodes");
+			opus_encoder_pool::release(std::move(encoder));
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testEncoderPool();
+	returnValue &= benchmarkEncoderPool();
+	return reportResults(returnValue);
+}
@@ -0,0 +1,186 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ClusterCoordinatorTests.cpp - Tests for the cluster's identify pacing, across processes on a single host.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file ClusterCoordinatorTests.cpp
+
+#include "UnitTest.hpp"
+#include <discordcoreapi/Utilities/ClusterCoordinator.hpp>
+
+#if !defined(_WIN32)
+	#include <sys/wait.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+#if !defined(_WIN32)
+
+		static constexpr uint64_t bucketCount{ 4 };
+
+		/// What each process reports back to the test, over a pipe.
+		struct identify_report {
+			uint64_t grants[bucketCount]{};
+			int64_t longestCallNs{};
+			uint64_t calls{};
+		};
+
+		/// Runs in each of the cluster's processes - every process races the others for the same buckets, with one shard of its own in each.
+		static identify_report raceForIdentifies(jsonifier::string_view socketPath, uint64_t processIndex) {
+			identify_report report{};
+			cluster_client client{ socketPath };
+			if (!client.connect(10s)) {
+				return report;
+			}
+			hrclock::time_point deadline{ hrclock::now() + 1500ms };
+			while (hrclock::now() < deadline) {
+				for (uint64_t x = 0; x < bucketCount; ++x) {
+					hrclock::time_point callStart{ hrclock::now() };
+					bool mayIdentify{ client.tryAcquireIdentify(processIndex * bucketCount + x) };
+					report.longestCallNs = std::max(report.longestCallNs, std::chrono::duration_cast<nanoseconds>(hrclock::now() - callStart).count());
+					report.grants[x] += mayIdentify;
+					++report.calls;
+				}
+				std::this_thread::sleep_for(1ms);
+			}
+			return report;
+		}
+
+		/// Forks the cluster's processes - before any thread has been started - and coordinates them from this one, as a single host would.
+		bool testIdentifyPacingAcrossProcesses() {
+			static constexpr uint64_t processCount{ 3 };
+			bool returnValue{ true };
+			jsonifier::string socketPath{ "/tmp/dca-cluster-test-" + jsonifier::toString(static_cast<uint64_t>(getpid())) + ".sock" };
+			std::vector<pid_t> processIds{};
+			std::vector<int32_t> readFds{};
+			for (uint64_t x = 0; x < processCount; ++x) {
+				int32_t fds[2]{};
+				if (pipe(fds) != 0) {
+					return check(false, "a pipe is opened for each process");
+				}
+				pid_t processId{ fork() };
+				if (processId == 0) {
+					close(fds[0]);
+					identify_report report{ raceForIdentifies(socketPath, x) };
+					auto bytesWritten = write(fds[1], &report, sizeof(report));
+					_exit(bytesWritten == sizeof(report) ? 0 : 1);
+				}
+				close(fds[1]);
+				processIds.emplace_back(processId);
+				readFds.emplace_back(fds[0]);
+			}
+			identify_report total{};
+			{
+				cluster_coordinator coordinator{ socketPath, processCount, processCount * bucketCount, bucketCount, "wss://gateway.discord.gg" };
+				returnValue &= check(coordinator.isListening(), "the coordinator listens");
+				for (uint64_t x = 0; x < processCount; ++x) {
+					identify_report report{};
+					bool isItRead{ read(readFds[x], &report, sizeof(report)) == sizeof(report) };
+					int32_t status{};
+					waitpid(processIds[x], &status, 0);
+					close(readFds[x]);
+					returnValue &= check(isItRead && WIFEXITED(status) && WEXITSTATUS(status) == 0 && report.calls > 0, "every process reports back");
+					for (uint64_t y = 0; y < bucketCount; ++y) {
+						total.grants[y] += report.grants[y];
+					}
+					total.longestCallNs = std::max(total.longestCallNs, report.longestCallNs);
+					total.calls += report.calls;
+				}
+			}
+			std::cout << "Cluster identifies: " << total.calls << " calls across " << processCount << " processes, longest call " << total.longestCallNs / 1000
+					  << "us, grants per bucket:";
+			for (uint64_t x = 0; x < bucketCount; ++x) {
+				std::cout << " " << total.grants[x];
+				returnValue &= check(total.grants[x] == 1, "each bucket is granted once per interval, across every process");
+			}
+			std::cout << std::endl;
+			// A blocking round trip per call would be held up by the coordinator serving the other processes.
+			returnValue &= check(total.longestCallNs < std::chrono::duration_cast<nanoseconds>(milliseconds{ 50 }).count(), "asking never waits on the coordinator");
+			return returnValue;
+		}
+
+		/// Connects to a coordinator that never answers, and then drops the connection.
+		bool testSilentCoordinator() {
+			bool returnValue{ true };
+			jsonifier::string socketPath{ "/tmp/dca-silent-test-" + jsonifier::toString(static_cast<uint64_t>(getpid())) + ".sock" };
+			sockaddr_un address{};
+			address.sun_family = AF_UNIX;
+			std::memcpy(address.sun_path, socketPath.data(), socketPath.size());
+			std::remove(socketPath.data());
+			socket_wrapper listener{ ::socket(AF_UNIX, SOCK_STREAM, 0) };
+			if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener, 1) != 0) {
+				return check(false, "the silent coordinator listens");
+			}
+			cluster_client client{ socketPath };
+			returnValue &= check(client.connect(1s), "the client connects");
+			socket_wrapper connection{ ::accept(listener, nullptr, nullptr) };
+			hrclock::time_point callStart{ hrclock::now() };
+			returnValue &= check(!client.tryAcquireIdentify(0) && !client.tryAcquireIdentify(0), "an unanswered shard may not identify");
+			returnValue &= check(hrclock::now() - callStart < 50ms, "an unanswered request doesn't block");
+			std::this_thread::sleep_for(cluster_client::requestTimeout + 100ms);
+			returnValue &= check(!client.tryAcquireIdentify(0), "a timed out request is sent again");
+			jsonifier::string received(256, '\0');
+			pollfd readFd{};
+			readFd.fd	  = connection;
+			readFd.events = POLLIN;
+			poll(&readFd, 1, 1000);
+			received.resize(static_cast<uint64_t>(std::max(recv(connection, received.data(), received.size(), 0), ssize_t{ 0 })));
+			uint64_t requestCount{};
+			for (uint64_t x = received.find("identify "); x != jsonifier::string::npos; x = received.find("identify ", x + 1)) {
+				++requestCount;
+			}
+			returnValue &= check(requestCount == 2, "one request is sent per timeout, rather than per call");
+			connection = socket_wrapper{};
+			hrclock::time_point deadline{ hrclock::now() + 2s };
+			bool mayIdentify{};
+			while (!mayIdentify && hrclock::now() < deadline) {
+				mayIdentify = client.tryAcquireIdentify(0);
+				std::this_thread::sleep_for(10ms);
+			}
+			returnValue &= check(mayIdentify, "once the coordinator is lost, the local buckets alone pace the shards");
+			std::remove(socketPath.data());
+			return returnValue;
+		}
+
+#endif
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+#if !defined(_WIN32)
+	// The processes are forked first, while this one is still single threaded.
+	returnValue &= testIdentifyPacingAcrossProcesses();
+	returnValue &= testSilentCoordinator();
+#endif
+	return reportResults(returnValue);
+}
@@ -0,0 +1,153 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// CoRoutineFramePoolTests.cpp - Tests and benchmarks for the co_routine frame pool.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file CoRoutineFramePoolTests.cpp
+
+#include "UnitTest.hpp"
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// A freed frame is handed back out for the next frame of its size class, on the same thread.
+		bool testFrameReuse() {
+			bool returnValue{ true };
+			void* frame{ co_routine_frame_pool::allocate(200) };
+			co_routine_frame_pool::deallocate(frame, 200);
+			void* frameNew{ co_routine_frame_pool::allocate(180) };
+			returnValue &= check(frame == frameNew, "a freed frame is reused for the next one in its size class");
+			co_routine_frame_pool::deallocate(frameNew, 180);
+			auto statsOld = co_routine_frame_pool::getStats();
+			void* largeFrame{ co_routine_frame_pool::allocate(co_routine_frame_pool::maximumClassSize * 2) };
+			co_routine_frame_pool::deallocate(largeFrame, co_routine_frame_pool::maximumClassSize * 2);
+			auto stats = co_routine_frame_pool::getStats();
+			returnValue &= check(stats.systemAllocations == statsOld.systemAllocations + 1, "a frame too large for every class comes from operator new");
+			return returnValue;
+		}
+
+		/// A frame freed on another thread goes back to the thread that allocated it, which reuses it once its own list runs dry.
+		bool testRemoteFrees() {
+			bool returnValue{ true };
+			static constexpr uint64_t frameCount{ 64 };
+			std::vector<void*> frames{};
+			for (uint64_t x = 0; x < frameCount; ++x) {
+				frames.emplace_back(co_routine_frame_pool::allocate(1000));
+			}
+			auto statsOld = co_routine_frame_pool::getStats();
+			std::jthread thread{ [&] {
+				for (auto& value: frames) {
+					co_routine_frame_pool::deallocate(value, 1000);
+				}
+			} };
+			thread.join();
+			auto stats = co_routine_frame_pool::getStats();
+			returnValue &= check(stats.remoteDeallocations - statsOld.remoteDeallocations == frameCount, "frames freed on another thread are counted as remote");
+			uint64_t reusedCount{};
+			std::vector<void*> framesNew{};
+			for (uint64_t x = 0; x < frameCount; ++x) {
+				framesNew.emplace_back(co_routine_frame_pool::allocate(1000));
+				reusedCount += std::find(frames.begin(), frames.end(), framesNew.back()) != frames.end();
+			}
+			returnValue &= check(reusedCount == frameCount, "frames freed on another thread are reused by the thread that allocated them");
+			for (auto& value: framesNew) {
+				co_routine_frame_pool::deallocate(value, 1000);
+			}
+			return returnValue;
+		}
+
+		/// Measures allocation and freeing against the global operator new and delete, for a frame on its own and for a burst of frames - and for a
+		/// producer thread that allocates while a consumer frees, as the co_routine thread pool does.
+		bool benchmarkFramePool() {
+			bool returnValue{ true };
+			static constexpr uint64_t iterationCount{ 1000000 };
+			static constexpr uint64_t burstSize{ 128 };
+			std::vector<void*> frames(burstSize);
+			for (uint64_t size: { uint64_t{ 256 }, uint64_t{ 1024 }, uint64_t{ 4000 } }) {
+				double nsPool{ benchmark("frame pool, " + std::to_string(size) + " bytes", iterationCount, [&](uint64_t) {
+					void* frame{ co_routine_frame_pool::allocate(size) };
+					static_cast<volatile uint8_t*>(frame)[0] = 1;
+					co_routine_frame_pool::deallocate(frame, size);
+				}) };
+				double nsSystem{ benchmark("operator new, " + std::to_string(size) + " bytes", iterationCount, [&](uint64_t) {
+					void* frame{ ::operator new(size) };
+					static_cast<volatile uint8_t*>(frame)[0] = 1;
+					::operator delete(frame);
+				}) };
+				double nsPoolBurst{ benchmark("frame pool burst, " + std::to_string(size) + " bytes", iterationCount / burstSize, [&](uint64_t) {
+					for (auto& value: frames) {
+						value = co_routine_frame_pool::allocate(size);
+					}
+					for (auto& value: frames) {
+						co_routine_frame_pool::deallocate(value, size);
+					}
+				}) };
+				double nsSystemBurst{ benchmark("operator new burst, " + std::to_string(size) + " bytes", iterationCount / burstSize, [&](uint64_t) {
+					for (auto& value: frames) {
+						value = ::operator new(size);
+					}
+					for (auto& value: frames) {
+						::operator delete(value);
+					}
+				}) };
+				std::cout << "Frames of " << size << " bytes: " << nsPool << " ns against " << nsSystem << " ns on their own, " << nsPoolBurst / burstSize << " ns against "
+						  << nsSystemBurst / burstSize << " ns in bursts of " << burstSize << "." << std::endl;
+			}
+			unbounded_message_block<void*> handoff{};
+			std::atomic_bool doWeStop{};
+			std::jthread consumer{ [&] {
+				void* frame{};
+				while (!doWeStop.load(std::memory_order_acquire) || handoff.size() > 0) {
+					if (handoff.tryReceiveFor(frame, milliseconds{ 1 })) {
+						co_routine_frame_pool::deallocate(frame, 512);
+					}
+				}
+			} };
+			auto statsOld = co_routine_frame_pool::getStats();
+			benchmark("frame pool, freed on another thread", iterationCount / 10, [&](uint64_t) {
+				handoff.send(co_routine_frame_pool::allocate(512));
+			});
+			doWeStop.store(true, std::memory_order_release);
+			consumer.join();
+			auto stats = co_routine_frame_pool::getStats();
+			uint64_t poolAllocations{ stats.poolAllocations - statsOld.poolAllocations };
+			std::cout << "Frames freed on another thread: " << poolAllocations << " of " << iterationCount / 10 << " allocations were reused from the pool." << std::endl;
+			returnValue &= check(stats.deallocations - statsOld.deallocations == iterationCount / 10, "every handed-off frame is freed");
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testFrameReuse();
+	returnValue &= testRemoteFrees();
+	returnValue &= benchmarkFramePool();
+	return reportResults(returnValue);
+}
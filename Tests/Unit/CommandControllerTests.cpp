@@ -0,0 +1,148 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// CommandControllerTests.cpp - Tests and benchmarks for command dispatch through the command name trie.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file CommandControllerTests.cpp
+
+#include "UnitTest.hpp"
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// A command that only remembers its name, so that a lookup can be checked against the command that it found.
+		struct test_command : public base_function {
+			inline test_command(jsonifier::string_view commandNameNew) {
+				commandName = commandNameNew;
+			}
+
+			inline void execute(const base_function_arguments&) {
+			}
+
+			inline unique_ptr<base_function> create() {
+				return makeUnique<test_command>(commandName);
+			}
+		};
+
+		/// Exposes the protected lookup that dispatch goes through.
+		class test_command_controller : public command_controller {
+		  public:
+			using command_controller::createFunction;
+		};
+
+		/// The registered names - "command<n>", with the aliases "cmd<n>" and "c<n>x".
+		jsonifier::vector<jsonifier::string> getCommandNames(uint64_t index) {
+			jsonifier::vector<jsonifier::string> returnValue{};
+			returnValue.emplace_back("command" + jsonifier::toString(index));
+			returnValue.emplace_back("cmd" + jsonifier::toString(index));
+			returnValue.emplace_back("c" + jsonifier::toString(index) + "x");
+			return returnValue;
+		}
+
+		bool testCommandLookups(test_command_controller& controller) {
+			bool returnValue{ true };
+			auto function = controller.createFunction("Command42");
+			returnValue &= check(function && function->commandName == "command42", "a name is found regardless of its case");
+			function = controller.createFunction("CMD42");
+			returnValue &= check(function && function->commandName == "command42", "an alias finds the same command as its name");
+			returnValue &= check(!controller.createFunction("command"), "a prefix of a name doesn't dispatch");
+			returnValue &= check(!controller.createFunction("command42a"), "a name with extra characters doesn't dispatch");
+			returnValue &= check(!controller.createFunction(""), "an empty name doesn't dispatch");
+			auto names = controller.getCommandNamesByPrefix("COMMAND10", 5);
+			jsonifier::vector<jsonifier::string> expectedNames{};
+			for (auto& value: { "command10", "command100", "command101", "command102", "command103" }) {
+				expectedNames.emplace_back(value);
+			}
+			returnValue &= check(names == expectedNames, "prefix matches come back lowercased, in order, and up to the limit");
+			returnValue &= check(controller.getCommandNamesByPrefix("zzz", 5).size() == 0, "a prefix that matches nothing finds nothing");
+			controller.registerFunction(getCommandNames(42), makeUnique<test_command>("replacement"));
+			function = controller.createFunction("c42x");
+			returnValue &= check(function && function->commandName == "replacement", "registering a name again replaces its command");
+			controller.registerFunction(getCommandNames(42), makeUnique<test_command>("command42"));
+			return returnValue;
+		}
+
+		/// Measures lookups by name, by alias, and misses, against the scan of every registered name that dispatch used to make.
+		bool benchmarkCommandLookups(test_command_controller& controller, uint64_t commandCount) {
+			bool returnValue{ true };
+			static constexpr uint64_t iterationCount{ 200000 };
+			jsonifier::vector<jsonifier::string> probes{};
+			for (uint64_t x = 0; x < 1024; ++x) {
+				uint64_t index{ (x * 7919) % commandCount };
+				probes.emplace_back(x % 2 == 0 ? "Command" + jsonifier::toString(index) : "CMD" + jsonifier::toString(index));
+			}
+			uint64_t foundCount{};
+			double nsPerLookup{ benchmark("trie lookup over " + std::to_string(commandCount) + " commands", iterationCount, [&](uint64_t x) {
+				foundCount += static_cast<bool>(controller.createFunction(probes[x % probes.size()]));
+			}) };
+			returnValue &= check(foundCount == iterationCount, "every benchmarked lookup finds its command");
+			uint64_t missCount{};
+			benchmark("trie miss over " + std::to_string(commandCount) + " commands", iterationCount, [&](uint64_t x) {
+				missCount += !controller.createFunction(probes[x % probes.size()] + "q");
+			});
+			returnValue &= check(missCount == iterationCount, "every benchmarked miss finds nothing");
+			// The scan that the trie replaced - every registered name, lowercasing the probe for each one.
+			foundCount = 0;
+			double nsPerScan{ benchmark("linear scan over " + std::to_string(commandCount) + " commands", iterationCount / 100, [&](uint64_t x) {
+				const auto& probe = probes[x % probes.size()];
+				for (auto& [key, value]: controller.getFunctions()) {
+					bool isItFound{};
+					for (auto& valueNew: key) {
+						if (valueNew == convertToLowerCase(probe)) {
+							isItFound = true;
+							break;
+						}
+					}
+					if (isItFound) {
+						foundCount += static_cast<bool>(value->create());
+						break;
+					}
+				}
+			}) };
+			std::cout << "Trie lookups over " << commandCount << " commands are " << nsPerScan / nsPerLookup << " times as fast as the scan." << std::endl;
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	test_command_controller controller{};
+	uint64_t commandCount{};
+	for (uint64_t target: { uint64_t{ 10 }, uint64_t{ 100 }, uint64_t{ 1000 } }) {
+		for (; commandCount < target; ++commandCount) {
+			controller.registerFunction(getCommandNames(commandCount), discord_core_api::makeUnique<test_command>("command" + jsonifier::toString(commandCount)));
+		}
+		if (commandCount == 1000) {
+			returnValue &= testCommandLookups(controller);
+		}
+		returnValue &= benchmarkCommandLookups(controller, commandCount);
+	}
+	return reportResults(returnValue);
+}
@@ -0,0 +1,473 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// DemuxersTests.cpp - Tests, fuzzing and benchmarks for the matroska and ogg demuxers, and the ogg page checksum.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file DemuxersTests.cpp
+
+#include "UnitTest.hpp"
+#include <discordcoreapi/Utilities/Demuxers.hpp>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		jsonifier::string_base<uint8_t> toBytes(std::initializer_list<uint8_t> bytes) {
+			jsonifier::string_base<uint8_t> returnValue{};
+			for (auto& value: bytes) {
+				returnValue.push_back(value);
+			}
+			return returnValue;
+		}
+
+		/// Appends an ebml element, with an eight-byte size so that the size never depends on the contents.
+		void appendElement(jsonifier::string_base<uint8_t>& output, uint32_t id, const jsonifier::string_base<uint8_t>& contents) {
+			bool started{};
+			for (int64_t x = 3; x >= 0; --x) {
+				uint8_t byte{ static_cast<uint8_t>(id >> (x * 8)) };
+				started |= byte != 0;
+				if (started) {
+					output.push_back(byte);
+				}
+			}
+			output.push_back(0x01);
+			for (int64_t x = 6; x >= 0; --x) {
+				output.push_back(static_cast<uint8_t>(static_cast<uint64_t>(contents.size()) >> (x * 8)));
+			}
+			for (auto& value: contents) {
+				output.push_back(value);
+			}
+		}
+
+		jsonifier::string_base<uint8_t> toUnsignedBytes(uint64_t value) {
+			jsonifier::string_base<uint8_t> returnValue{};
+			for (int64_t x = 7; x >= 0; --x) {
+				returnValue.push_back(static_cast<uint8_t>(value >> (x * 8)));
+			}
+			return returnValue;
+		}
+
+		/// Builds a cluster at a timecode, holding frames 20 ms apart - each frame's first byte is its index within the cluster.
+		jsonifier::string_base<uint8_t> buildCluster(uint64_t timecode, uint64_t frameCount, uint64_t frameSize) {
+			jsonifier::string_base<uint8_t> cluster{};
+			appendElement(cluster, 0xE7, toUnsignedBytes(timecode));
+			for (uint64_t x = 0; x < frameCount; ++x) {
+				jsonifier::string_base<uint8_t> block{ toBytes({ 0x81, static_cast<uint8_t>((x * 20) >> 8), static_cast<uint8_t>(x * 20), 0x80 }) };
+				for (uint64_t y = 0; y < frameSize; ++y) {
+					block.push_back(static_cast<uint8_t>(y == 0 ? x : y));
+				}
+				appendElement(cluster, 0xA3, block);
+			}
+			return cluster;
+		}
+
+		/// Builds a stream with one opus track and a number of clusters of frames. With cues, a Cues element pointing at every cluster comes first, the
+		/// way that the web's files have them - and a void element of the given size always ends the segment.
+		jsonifier::string_base<uint8_t> buildMatroskaStream(uint64_t clusterCount, uint64_t framesPerCluster, uint64_t frameSize, bool withCues, uint64_t voidSize) {
+			jsonifier::string_base<uint8_t> trackEntry{};
+			appendElement(trackEntry, 0xD7, toBytes({ 0x01 }));
+			appendElement(trackEntry, 0x86, toBytes({ 'A', '_', 'O', 'P', 'U', 'S' }));
+			jsonifier::string_base<uint8_t> tracks{};
+			appendElement(tracks, 0xAE, trackEntry);
+			jsonifier::string_base<uint8_t> clusters{};
+			jsonifier::vector<uint64_t> clusterOffsets{};
+			for (uint64_t x = 0; x < clusterCount; ++x) {
+				clusterOffsets.emplace_back(clusters.size());
+				appendElement(clusters, 0x1F43B675, buildCluster(x * framesPerCluster * 20, framesPerCluster, frameSize));
+			}
+			jsonifier::string_base<uint8_t> segment{};
+			appendElement(segment, 0x1654AE6B, tracks);
+			if (withCues) {
+				// Every cue point is the same size, so the clusters' offsets are known before the Cues element is built - three leaves of 17 bytes,
+				// and two masters of 9 bytes of header.
+				static constexpr uint64_t cuePointSize{ 3 * 17 + 2 * 9 };
+				uint64_t cuesSize{ 12 + clusterCount * cuePointSize };
+				jsonifier::string_base<uint8_t> cues{};
+				for (uint64_t x = 0; x < clusterCount; ++x) {
+					jsonifier::string_base<uint8_t> trackPositions{};
+					appendElement(trackPositions, 0xF7, toUnsignedBytes(1));
+					appendElement(trackPositions, 0xF1, toUnsignedBytes(segment.size() + cuesSize + clusterOffsets[x]));
+					jsonifier::string_base<uint8_t> cuePoint{};
+					appendElement(cuePoint, 0xB3, toUnsignedBytes(x * framesPerCluster * 20));
+					appendElement(cuePoint, 0xB7, trackPositions);
+					appendElement(cues, 0xBB, cuePoint);
+				}
+				appendElement(segment, 0x1C53BB6B, cues);
+			}
+			segment += clusters;
+			jsonifier::string_base<uint8_t> voidContents{};
+			voidContents.resize(voidSize);
+			appendElement(segment, 0xEC, voidContents);
+			jsonifier::string_base<uint8_t> stream{};
+			appendElement(stream, 0x1A45DFA3, toBytes({ 0x42, 0x86, 0x81, 0x01 }));
+			appendElement(stream, 0x18538067, segment);
+			return stream;
+		}
+
+		/// Demuxes a stream in pieces of the given size, returning the number of frames collected.
+		uint64_t demuxInPieces(matroska_demuxer& demuxer, jsonifier::string_view_base<uint8_t> stream, uint64_t pieceSize) {
+			uint64_t frameCount{};
+			audio_frame_data frame{};
+			for (uint64_t x = 0; x < stream.size(); x += pieceSize) {
+				demuxer.writeData(jsonifier::string_view_base<uint8_t>{ stream.data() + x, std::min(pieceSize, stream.size() - x) });
+				demuxer.proceedDemuxing();
+				while (demuxer.collectFrame(frame)) {
+					++frameCount;
+				}
+			}
+			demuxer.endOfStream();
+			demuxer.proceedDemuxing();
+			while (demuxer.collectFrame(frame)) {
+				++frameCount;
+			}
+			return frameCount;
+		}
+
+		bool testMatroskaTruncation() {
+			bool returnValue{ true };
+			static constexpr uint64_t voidSize{ 256 };
+			auto stream = buildMatroskaStream(1, 3, 3, false, voidSize);
+			for (uint64_t pieceSize: { uint64_t{ 1 }, uint64_t{ 5 }, uint64_t{ 4096 } }) {
+				matroska_demuxer completeDemuxer{};
+				returnValue &= check(demuxInPieces(completeDemuxer, { stream.data(), stream.size() }, pieceSize) == 3, "a complete stream yields every frame");
+				returnValue &= check(completeDemuxer.areWeDone() && completeDemuxer.didWeReachEnd(), "a complete stream reaches the end of its segment");
+				// Cut inside the trailing void element, which the demuxer skips rather than buffers.
+				matroska_demuxer skipDemuxer{};
+				returnValue &= check(demuxInPieces(skipDemuxer, { stream.data(), stream.size() - voidSize / 2 }, pieceSize) == 3, "a stream cut in a skip still yields its frames");
+				returnValue &= check(skipDemuxer.areWeDone() && !skipDemuxer.didWeReachEnd(), "a stream cut in a skipped element ends, truncated");
+				// Cut inside the last frame's block, which the demuxer buffers in full.
+				matroska_demuxer blockDemuxer{};
+				returnValue &= check(demuxInPieces(blockDemuxer, { stream.data(), stream.size() - voidSize - 12 }, pieceSize) == 2, "a stream cut in a block drops that block");
+				returnValue &= check(blockDemuxer.areWeDone() && !blockDemuxer.didWeReachEnd(), "a stream cut in a block ends, truncated");
+			}
+			return returnValue;
+		}
+
+		bool testMatroskaSeek() {
+			static constexpr uint64_t framesPerCluster{ 50 };
+			bool returnValue{ true };
+			auto stream = buildMatroskaStream(10, framesPerCluster, 40, true, 16);
+			matroska_demuxer demuxer{};
+			returnValue &= check(!demuxer.seek(milliseconds{ 1000 }).has_value(), "there's nothing to seek with before the cues arrive");
+			// The first cluster is enough to have read the cues, which come before it.
+			demuxer.writeData({ stream.data(), stream.size() / 10 });
+			demuxer.proceedDemuxing();
+			// The cluster at 4 s holds 4000 ms to 4980 ms, so a seek to 4500 ms starts from it and drops the frames before 4500 ms.
+			auto offset = demuxer.seek(milliseconds{ 4500 });
+			returnValue &= check(offset.has_value() && *offset < stream.size() && stream[*offset] == 0x1F, "a seek lands on the start of a cluster");
+			if (!offset.has_value() || *offset >= stream.size()) {
+				return false;
+			}
+			audio_frame_data frame{};
+			uint64_t frameCount{};
+			bool firstFrameMatches{};
+			for (uint64_t x = *offset; x < stream.size(); x += 1000) {
+				demuxer.writeData({ stream.data() + x, std::min(uint64_t{ 1000 }, stream.size() - x) });
+				demuxer.proceedDemuxing();
+				while (demuxer.collectFrame(frame)) {
+					if (frameCount == 0) {
+						firstFrameMatches = frame.data[0] == 25 && demuxer.getCurrentTimeStamp() >= milliseconds{ 4500 };
+					}
+					++frameCount;
+				}
+			}
+			demuxer.endOfStream();
+			demuxer.proceedDemuxing();
+			returnValue &= check(firstFrameMatches, "the first frame after a seek is the one at the seek's timestamp");
+			returnValue &= check(frameCount == 6 * framesPerCluster - 25, "every frame after the seek's timestamp is demuxed");
+			returnValue &= check(demuxer.didWeReachEnd(), "a seek still demuxes to the end of the segment");
+			// Seeking before the first cue starts from the first cluster.
+			offset = demuxer.seek(milliseconds{ 0 });
+			returnValue &= check(offset.has_value() && *offset < stream.size() && stream[*offset] == 0x1F, "a seek to the start lands on the first cluster");
+			return returnValue;
+		}
+
+		/// Feeds corrupted and truncated streams through the demuxer - it has to come to an end on every one of them, without reading out of bounds or
+		/// emitting oversized frames.
+		bool fuzzMatroskaDemuxer() {
+			static constexpr uint64_t iterations{ 2000 };
+			bool returnValue{ true };
+			auto stream = buildMatroskaStream(4, 20, 60, true, 32);
+			std::mt19937_64 random{ 28 };
+			uint64_t unfinishedCount{};
+			uint64_t oversizedCount{};
+			for (uint64_t x = 0; x < iterations; ++x) {
+				auto mutated = stream;
+				uint64_t mutationCount{ 1 + random() % 16 };
+				for (uint64_t y = 0; y < mutationCount; ++y) {
+					switch (random() % 3) {
+						case 0: {
+							mutated[random() % mutated.size()] = static_cast<uint8_t>(random());
+							break;
+						}
+						case 1: {
+							mutated[random() % mutated.size()] ^= static_cast<uint8_t>(1 << (random() % 8));
+							break;
+						}
+						default: {
+							// A size byte of 0xFF marks an unknown size, and 0x01 starts the largest ones.
+							mutated[random() % mutated.size()] = (random() % 2) ? 0xFF : 0x01;
+							break;
+						}
+					}
+				}
+				mutated.resize(mutated.size() - random() % (mutated.size() / 4));
+				matroska_demuxer demuxer{};
+				audio_frame_data frame{};
+				uint64_t pieceSize{ 1 + random() % 512 };
+				for (uint64_t y = 0; y < mutated.size(); y += pieceSize) {
+					demuxer.writeData({ mutated.data() + y, std::min(pieceSize, mutated.size() - y) });
+					demuxer.proceedDemuxing();
+					while (demuxer.collectFrame(frame)) {
+						oversizedCount += frame.currentSize > 1275;
+					}
+				}
+				demuxer.endOfStream();
+				demuxer.proceedDemuxing();
+				while (demuxer.collectFrame(frame)) {
+					oversizedCount += frame.currentSize > 1275;
+				}
+				unfinishedCount += !demuxer.areWeDone();
+			}
+			returnValue &= check(unfinishedCount == 0, "every corrupted stream comes to an end");
+			returnValue &= check(oversizedCount == 0, "no oversized frame is emitted from a corrupted stream");
+			return returnValue;
+		}
+
+		/// Demuxes a stream as downloads deliver it, in 1 MiB pieces.
+		uint64_t demuxDownload(jsonifier::string_view_base<uint8_t> stream) {
+			static constexpr uint64_t pieceSize{ 1024 * 1024 };
+			matroska_demuxer demuxer{};
+			return demuxInPieces(demuxer, stream, pieceSize);
+		}
+
+		/// Measures the demuxer's throughput on a generated track of about 16 MiB - and on any local webm files named on the command line.
+		bool benchmarkMatroskaDemuxer(int32_t argc, char** argv) {
+			bool returnValue{ true };
+			// 4 minutes of 20 ms frames of 320 bytes - a high-bitrate track.
+			auto stream = buildMatroskaStream(240, 50, 320, true, 0);
+			uint64_t frameCount{};
+			double nsPerIteration{ benchmark("matroska demuxing", 10, [&](uint64_t) {
+				frameCount = demuxDownload({ stream.data(), stream.size() });
+			}) };
+			std::cout << "Benchmark matroska demuxing: " << static_cast<double>(stream.size()) / nsPerIteration * 1000.0 << " MB per second." << std::endl;
+			returnValue &= check(frameCount == 240 * 50, "the benchmarked track yields every frame");
+			for (int32_t x = 1; x < argc; ++x) {
+				std::ifstream file{ argv[x], std::ios::binary };
+				jsonifier::string_base<uint8_t> fileData{};
+				fileData.resize(std::filesystem::file_size(argv[x]));
+				file.read(reinterpret_cast<char*>(fileData.data()), static_cast<std::streamsize>(fileData.size()));
+				nsPerIteration = benchmark(argv[x], 10, [&](uint64_t) {
+					frameCount = demuxDownload({ fileData.data(), fileData.size() });
+				});
+				std::cout << "Benchmark " << argv[x] << ": " << static_cast<double>(fileData.size()) / nsPerIteration * 1000.0 << " MB per second, " << frameCount
+						  << " frames." << std::endl;
+			}
+			return returnValue;
+		}
+
+
+		/// The bitwise definition of the Ogg page checksum - polynomial 0x04C11DB7, unreflected, with no initial or final xor.
+		uint32_t computeOggCrcBitwise(const uint8_t* bytes, uint64_t length) {
+			uint32_t crc{};
+			for (uint64_t x = 0; x < length; ++x) {
+				crc ^= static_cast<uint32_t>(bytes[x]) << 24;
+				for (uint64_t y = 0; y < 8; ++y) {
+					crc = (crc & 0x80000000u) ? (crc << 1) ^ 0x04C11DB7u : crc << 1;
+				}
+			}
+			return crc;
+		}
+
+		/// The table-driven, byte-at-a-time checksum that the eight-byte version replaced, for comparison.
+		uint32_t computeOggCrcBytewise(const uint8_t* bytes, uint64_t length) {
+			uint32_t crc{};
+			for (uint64_t x = 0; x < length; ++x) {
+				crc = (crc << 8) ^ oggCrcTables[0][(crc >> 24) ^ bytes[x]];
+			}
+			return crc;
+		}
+
+		/// Builds an Ogg page holding whole packets, with its checksum filled in.
+		jsonifier::string_base<uint8_t> buildOggPage(const std::vector<jsonifier::string_base<uint8_t>>& packets, uint32_t sequence) {
+			jsonifier::string_base<uint8_t> page{ toBytes({ 'O', 'g', 'g', 'S', 0, 0 }) };
+			for (uint64_t x = 0; x < 8; ++x) {
+				page.push_back(0);
+			}
+			for (uint64_t x = 0; x < 4; ++x) {
+				page.push_back(static_cast<uint8_t>(0x5A));
+			}
+			for (uint64_t x = 0; x < 4; ++x) {
+				page.push_back(static_cast<uint8_t>(sequence >> (x * 8)));
+			}
+			for (uint64_t x = 0; x < 4; ++x) {
+				page.push_back(0);
+			}
+			jsonifier::string_base<uint8_t> lacingValues{};
+			for (auto& value: packets) {
+				for (uint64_t x = 0; x < value.size() / 255; ++x) {
+					lacingValues.push_back(255);
+				}
+				lacingValues.push_back(static_cast<uint8_t>(value.size() % 255));
+			}
+			page.push_back(static_cast<uint8_t>(lacingValues.size()));
+			for (auto& value: lacingValues) {
+				page.push_back(value);
+			}
+			for (auto& value: packets) {
+				for (auto& valueNew: value) {
+					page.push_back(valueNew);
+				}
+			}
+			uint32_t crc{ computeOggCrcBitwise(page.data(), page.size()) };
+			for (uint64_t x = 0; x < 4; ++x) {
+				page[22 + x] = static_cast<uint8_t>(crc >> (x * 8));
+			}
+			return page;
+		}
+
+		/// A packet whose bytes can't contain a capture pattern - each one is its index within the stream, plus 0x20, modulo 32.
+		jsonifier::string_base<uint8_t> buildOggPacket(uint64_t size, uint64_t index) {
+			jsonifier::string_base<uint8_t> packet{};
+			packet.resize(size);
+			for (auto& value: packet) {
+				value = static_cast<uint8_t>(0x20 + index % 32);
+			}
+			return packet;
+		}
+
+		/// Checks the eight-byte checksum against its bitwise definition, over every alignment and split of the input.
+		bool testOggCrc() {
+			bool returnValue{ true };
+			std::mt19937_64 random{ 29 };
+			std::vector<uint8_t> bytes(4096);
+			for (auto& value: bytes) {
+				value = static_cast<uint8_t>(random());
+			}
+			uint64_t mismatchCount{};
+			for (uint64_t x = 0; x < 2000; ++x) {
+				uint64_t offset{ random() % 64 };
+				uint64_t length{ random() % (bytes.size() - offset) };
+				uint64_t split{ length > 0 ? random() % length : 0 };
+				uint32_t expected{ computeOggCrcBitwise(bytes.data() + offset, length) };
+				uint32_t crc{ updateOggCrc(0, bytes.data() + offset, split) };
+				crc = updateOggCrc(crc, bytes.data() + offset + split, length - split);
+				mismatchCount += crc != expected;
+			}
+			returnValue &= check(mismatchCount == 0, "the eight-byte checksum matches the bitwise one, at every alignment and split");
+			returnValue &= check(updateOggCrc(0, bytes.data(), 0) == 0, "the checksum of nothing is zero");
+			return returnValue;
+		}
+
+		/// A page whose checksum doesn't match is skipped, while the pages around it are still demuxed.
+		bool testOggPageChecksums() {
+			bool returnValue{ true };
+			jsonifier::string_base<uint8_t> stream{};
+			for (uint32_t x = 0; x < 3; ++x) {
+				stream += buildOggPage({ buildOggPacket(100 + x * 500, x) }, x);
+			}
+			// Flips a byte in the middle page's body.
+			stream[buildOggPage({ buildOggPacket(100, 0) }, 0).size() + 200] ^= 0x01;
+			ogg_demuxer demuxer{};
+			demuxer.writeData({ reinterpret_cast<const char*>(stream.data()), stream.size() });
+			demuxer.proceedDemuxing();
+			std::vector<uint64_t> packetSizes{};
+			jsonifier::string_view_base<uint8_t> packet{};
+			while (demuxer.collectPacket(packet)) {
+				packetSizes.emplace_back(packet.size());
+			}
+			returnValue &= check(packetSizes == std::vector<uint64_t>{ 100, 1100 }, "the corrupted page is skipped, and the pages around it are kept");
+			return returnValue;
+		}
+
+		/// Measures the checksum against the byte-at-a-time version it replaced, and the ogg demuxer's throughput on about 4 MiB of pages.
+		bool benchmarkOggDemuxer() {
+			bool returnValue{ true };
+			static constexpr uint64_t bufferSize{ 1024 * 1024 };
+			std::mt19937_64 random{ 29 };
+			std::vector<uint8_t> bytes(bufferSize);
+			for (auto& value: bytes) {
+				value = static_cast<uint8_t>(random());
+			}
+			// Each iteration flips a byte, and the results land in a volatile, so that neither loop can be hoisted or optimized away.
+			volatile uint32_t crcSink{};
+			double nsPerIteration{ benchmark("ogg checksum, eight bytes at a time", 100, [&](uint64_t x) {
+				bytes[x] ^= 1;
+				crcSink = updateOggCrc(0, bytes.data(), bytes.size());
+			}) };
+			std::cout << "Benchmark ogg checksum, eight bytes at a time: " << static_cast<double>(bufferSize) / nsPerIteration * 1000.0 << " MB per second." << std::endl;
+			nsPerIteration = benchmark("ogg checksum, a byte at a time", 100, [&](uint64_t x) {
+				bytes[x] ^= 1;
+				crcSink = computeOggCrcBytewise(bytes.data(), bytes.size());
+			});
+			std::cout << "Benchmark ogg checksum, a byte at a time: " << static_cast<double>(bufferSize) / nsPerIteration * 1000.0 << " MB per second." << std::endl;
+			returnValue &= check(computeOggCrcBytewise(bytes.data(), bytes.size()) == updateOggCrc(0, bytes.data(), bytes.size()), "both checksums agree");
+			// 4 minutes of 20 ms packets of 320 bytes, 50 to a page.
+			jsonifier::string_base<uint8_t> stream{};
+			for (uint32_t x = 0; x < 240; ++x) {
+				std::vector<jsonifier::string_base<uint8_t>> packets{};
+				for (uint64_t y = 0; y < 50; ++y) {
+					packets.emplace_back(buildOggPacket(320, y));
+				}
+				stream += buildOggPage(packets, x);
+			}
+			uint64_t packetCount{};
+			nsPerIteration = benchmark("ogg demuxing", 10, [&](uint64_t) {
+				static constexpr uint64_t pieceSize{ 1024 * 1024 };
+				ogg_demuxer demuxer{};
+				jsonifier::string_view_base<uint8_t> packet{};
+				packetCount = 0;
+				for (uint64_t x = 0; x < stream.size(); x += pieceSize) {
+					demuxer.writeData({ reinterpret_cast<const char*>(stream.data()) + x, std::min(pieceSize, stream.size() - x) });
+					demuxer.proceedDemuxing();
+					while (demuxer.collectPacket(packet)) {
+						++packetCount;
+					}
+				}
+			});
+			std::cout << "Benchmark ogg demuxing: " << static_cast<double>(stream.size()) / nsPerIteration * 1000.0 << " MB per second." << std::endl;
+			returnValue &= check(packetCount == 240 * 50, "the benchmarked stream yields every packet");
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main(int32_t argc, char** argv) {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testMatroskaTruncation();
+	returnValue &= testMatroskaSeek();
+	returnValue &= fuzzMatroskaDemuxer();
+	returnValue &= benchmarkMatroskaDemuxer(argc, argv);
+	returnValue &= testOggCrc();
+	returnValue &= testOggPageChecksums();
+	returnValue &= benchmarkOggDemuxer();
+	return reportResults(returnValue);
+}
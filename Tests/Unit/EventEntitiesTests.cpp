@@ -0,0 +1,153 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// EventEntitiesTests.cpp - Tests for the event dispatch modes, and for handlers that throw.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file EventEntitiesTests.cpp
+
+#include "UnitTest.hpp"
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// Exposes the ordered lanes, so that the test can tell that none were left behind.
+		class test_event : public event<co_routine<void>, uint64_t> {
+		  public:
+			uint64_t getLaneCount() {
+				std::unique_lock lock{ laneMutex };
+				return lanes.size();
+			}
+		};
+
+		/// What the handlers saw, per ordering key.
+		struct dispatch_record {
+			std::map<uint64_t, std::vector<uint64_t>> values{};
+			std::condition_variable condition{};
+			std::mutex accessMutex{};
+			uint64_t count{};
+
+			void record(uint64_t value) {
+				std::unique_lock lock{ accessMutex };
+				values[value / 1000].emplace_back(value);
+				++count;
+				condition.notify_all();
+			}
+
+			bool waitForCount(uint64_t countNew) {
+				std::unique_lock lock{ accessMutex };
+				return condition.wait_for(lock, milliseconds{ 10000 }, [&] {
+					return count >= countNew;
+				});
+			}
+		};
+
+		static dispatch_record dispatchRecord{};
+
+		/// Throws a std::exception from every tenth dispatch, and something that isn't one from every tenth after that.
+		co_routine<void> throwingHandler(uint64_t value) {
+			co_await newThreadAwaitable<void>();
+			dispatchRecord.record(value);
+			if (value % 10 == 3) {
+				throw std::runtime_error{ "A handler's std::exception." };
+			} else if (value % 10 == 7) {
+				throw value;
+			}
+			co_return;
+		}
+
+		bool testOrderedDispatch() {
+			static constexpr uint64_t dispatchesPerKey{ 200 };
+			bool returnValue{ true };
+			test_event testEvent{};
+			testEvent.add(&throwingHandler);
+			// A handler that throws before it even returns a co_routine.
+			testEvent.add(std::function<co_routine<void>(uint64_t)>{ [](uint64_t value) -> co_routine<void> {
+				if (value % 10 == 5) {
+					throw std::logic_error{ "A handler that throws synchronously." };
+				}
+				return throwingHandler(value + 500);
+			} });
+			testEvent.setDispatchMode(event_dispatch_mode::ordered, [](const uint64_t& value) {
+				return value / 1000;
+			});
+			for (uint64_t x = 0; x < dispatchesPerKey; ++x) {
+				for (uint64_t key = 0; key < 4; ++key) {
+					testEvent(key * 1000 + x % 500);
+				}
+			}
+			// Every dispatch runs the first handler, and the second for 9 in 10 of them.
+			returnValue &= check(dispatchRecord.waitForCount(4 * dispatchesPerKey + 4 * dispatchesPerKey * 9 / 10), "every dispatch runs, despite the exceptions");
+			std::unique_lock lock{ dispatchRecord.accessMutex };
+			for (auto& [key, values]: dispatchRecord.values) {
+				// Within a dispatch the handlers overlap, so only the first handler's values are checked for order.
+				uint64_t lastValue{};
+				bool inOrder{ true };
+				for (auto& value: values) {
+					if (value % 1000 < 500) {
+						inOrder &= value >= lastValue;
+						lastValue = value;
+					}
+				}
+				returnValue &= check(inOrder, "dispatches with the same key run in order");
+			}
+			lock.unlock();
+			stop_watch<milliseconds> stopWatch{ milliseconds{ 5000 } };
+			while (testEvent.getLaneCount() > 0 && !stopWatch.hasTimeElapsed()) {
+				std::this_thread::sleep_for(milliseconds{ 1 });
+			}
+			returnValue &= check(testEvent.getLaneCount() == 0, "every lane is released, including after exceptions");
+			return returnValue;
+		}
+
+		bool testSequentialDispatch() {
+			bool returnValue{ true };
+			test_event testEvent{};
+			uint64_t completedCount{};
+			testEvent.add(std::function<co_routine<void>(uint64_t)>{ [&](uint64_t value) -> co_routine<void> {
+				if (value == 1) {
+					throw value;
+				}
+				++completedCount;
+				return throwingHandler(value + 10000);
+			} });
+			for (uint64_t x = 0; x < 10; ++x) {
+				testEvent(x);
+			}
+			returnValue &= check(completedCount == 9, "a sequential event survives handlers that throw anything");
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testOrderedDispatch();
+	returnValue &= testSequentialDispatch();
+	return reportResults(returnValue);
+}
@@ -0,0 +1,183 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GatewayEventExecutorTests.cpp - Tests for the gateway event executor, and a replay of a busy gateway through it.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file GatewayEventExecutorTests.cpp
+
+#include "UnitTest.hpp"
+#include <discordcoreapi/Utilities/GatewayEventExecutor.hpp>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		gateway_event makeEvent(jsonifier::string_view keyName, uint64_t key, uint64_t sequence) {
+			jsonifier::string payload{ "{\"op\":0,\"t\":\"MESSAGE_CREATE\",\"d\":{\"content\":\"\\\"guild_id\\\": 1\",\"member\":{\"guild_id\":\"1\"},\"" };
+			payload += keyName;
+			payload += "\":\"" + jsonifier::toString(key) + "\",\"n\":" + jsonifier::toString(sequence) + "},\"s\":2}";
+			gateway_event returnValue{};
+			returnValue.payload.resize(payload.size());
+			std::memcpy(returnValue.payload.data(), payload.data(), payload.size());
+			returnValue.receivedAt = hrclock::now();
+			returnValue.eventType  = 27;
+			return returnValue;
+		}
+
+		bool testFindDispatchValue() {
+			bool returnValue{ true };
+			auto eventNew = makeEvent("guild_id", 81384788765712384, 7);
+			jsonifier::string_view_base<uint8_t> payload{ eventNew.payload.data(), eventNew.payload.size() };
+			// The decoys - inside a string, and in a nested object - come before the real field.
+			returnValue &= check(gateway_event_executor::findDispatchValue(payload, "guild_id") == 81384788765712384, "a top-level field of d is found");
+			returnValue &= check(gateway_event_executor::findDispatchValue(payload, "n") == 7, "an unquoted number is found");
+			returnValue &= check(gateway_event_executor::findDispatchValue(payload, "s") == 0, "fields outside of d are ignored");
+			returnValue &= check(gateway_event_executor::findDispatchValue(payload, "channel_id") == 0, "a missing field is 0");
+			return returnValue;
+		}
+
+		/// Waits for the lanes to finish processing a number of events.
+		uint64_t waitForProcessed(gateway_event_executor& executor, uint64_t eventCount) {
+			stop_watch<milliseconds> stopWatch{ milliseconds{ 60000 } };
+			while (true) {
+				uint64_t processedCount{};
+				for (auto& value: executor.getLaneMetrics()) {
+					processedCount += value.eventsProcessed;
+				}
+				if (processedCount >= eventCount || stopWatch.hasTimeElapsed()) {
+					return processedCount;
+				}
+				std::this_thread::sleep_for(milliseconds{ 1 });
+			}
+		}
+
+		/// What the processor saw, in order, for each routing key.
+		struct replay_record {
+			static constexpr uint64_t stripeCount{ 64 };
+
+			std::array<std::unordered_map<uint64_t, std::vector<uint64_t>>, stripeCount> sequences{};
+			std::array<std::mutex, stripeCount> accessMutexes{};
+
+			void record(uint64_t key, uint64_t sequence) {
+				std::unique_lock lock{ accessMutexes[key % stripeCount] };
+				sequences[key % stripeCount][key].emplace_back(sequence);
+			}
+		};
+
+		/// Replays a busy gateway - guild events across many guilds, and direct messages - through the executor, with handlers that throw.
+		bool testGatewayReplay() {
+			static constexpr uint64_t guildCount{ 2000 };
+			static constexpr uint64_t channelCount{ 100 };
+			static constexpr uint64_t eventsPerKey{ 100 };
+			static constexpr uint64_t shardCount{ 4 };
+			bool returnValue{ true };
+			replay_record record{};
+			gateway_event_executor executor{ 8, [&](jsonifier::jsonifier_core<false>&, uint64_t, jsonifier::string_view_base<uint8_t> payload) {
+												uint64_t key{ gateway_event_executor::findDispatchValue(payload, "guild_id") };
+												key = key != 0 ? key : gateway_event_executor::findDispatchValue(payload, "channel_id");
+												uint64_t sequence{ gateway_event_executor::findDispatchValue(payload, "n") };
+												record.record(key, sequence);
+												if (sequence % 13 == 3) {
+													throw std::runtime_error{ "A handler's std::exception." };
+												} else if (sequence % 13 == 7) {
+													throw sequence;
+												}
+											} };
+			jsonifier::vector<uint32_t> groupCpus{};
+			groupCpus.emplace_back(0);
+			groupCpus.emplace_back(0);
+			executor.placeLanes(groupCpus, shardCount);
+			// The events are made up front, so that only the executor is timed.
+			std::vector<std::tuple<uint64_t, uint64_t, gateway_event>> events{};
+			events.reserve((guildCount + channelCount) * eventsPerKey);
+			for (uint64_t x = 0; x < eventsPerKey; ++x) {
+				for (uint64_t y = 0; y < guildCount; ++y) {
+					uint64_t guildId{ ((y + 1) << 22) | y };
+					events.emplace_back(guildId, (guildId >> 22) % shardCount, makeEvent("guild_id", guildId, x));
+				}
+				for (uint64_t y = 0; y < channelCount; ++y) {
+					// Direct messages arrive on shard 0, whatever their channel's id says - and the low bits keep the ids apart from the guilds'.
+					uint64_t channelId{ ((y * 2 + 1) << 22) | (guildCount + y) };
+					events.emplace_back(channelId, 0, makeEvent("channel_id", channelId, x));
+				}
+			}
+			uint64_t totalEvents{ events.size() };
+			auto startTime = hrclock::now();
+			for (auto& [key, shardId, eventNew]: events) {
+				executor.submit(key, shardId, std::move(eventNew));
+			}
+			uint64_t processedCount{ waitForProcessed(executor, totalEvents) };
+			auto totalTime = std::chrono::duration_cast<std::chrono::duration<double>>(hrclock::now() - startTime);
+			std::cout << "Benchmark gateway replay: " << static_cast<double>(totalEvents) / totalTime.count() << " events per second, over " << totalEvents << " events."
+					  << std::endl;
+			bool inOrder{ true };
+			uint64_t keyCount{};
+			for (auto& value: record.sequences) {
+				for (auto& [key, sequences]: value) {
+					++keyCount;
+					inOrder &= sequences.size() == eventsPerKey;
+					for (uint64_t x = 0; x < sequences.size(); ++x) {
+						inOrder &= sequences[x] == x;
+					}
+				}
+			}
+			returnValue &= check(keyCount == guildCount + channelCount && inOrder, "each guild's and channel's events are processed in order");
+			returnValue &= check(processedCount == totalEvents, "the lanes count every event, including those that threw");
+			return returnValue;
+		}
+
+		bool testDirectMessageRouting() {
+			bool returnValue{ true };
+			gateway_event_executor executor{ 4, [](jsonifier::jsonifier_core<false>&, uint64_t, jsonifier::string_view_base<uint8_t>) {
+											} };
+			jsonifier::vector<uint32_t> groupCpus{};
+			groupCpus.emplace_back(0);
+			groupCpus.emplace_back(0);
+			// Two groups of two lanes, one group per shard.
+			executor.placeLanes(groupCpus, 2);
+			for (uint64_t x = 0; x < 100; ++x) {
+				// Every one of these channel ids would map to shard 1, if the shard were derived from the id.
+				uint64_t channelId{ ((x * 2 + 1) << 22) | x };
+				executor.submit(channelId, 0, makeEvent("channel_id", channelId, x));
+			}
+			waitForProcessed(executor, 100);
+			auto metrics = executor.getLaneMetrics();
+			returnValue &= check(metrics[0].eventsProcessed + metrics[1].eventsProcessed == 100, "direct messages are handled by the receiving shard's lanes");
+			returnValue &= check(metrics[2].eventsProcessed + metrics[3].eventsProcessed == 0, "direct messages aren't routed by their channel's id");
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testFindDispatchValue();
+	returnValue &= testGatewayReplay();
+	returnValue &= testDirectMessageRouting();
+	return reportResults(returnValue);
+}
@@ -0,0 +1,117 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GuildMemberChunkTests.cpp - Tests and benchmarks for caching guild member chunks in bulk.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file GuildMemberChunkTests.cpp
+
+#include "UnitTest.hpp"
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// A chunk's worth of members of a guild - the gateway sends up to 1000 to a chunk.
+		jsonifier::vector<guild_member_data> buildChunk(uint64_t guildId, uint64_t chunkIndex, uint64_t memberCount) {
+			jsonifier::vector<guild_member_data> members{};
+			for (uint64_t x = 0; x < memberCount; ++x) {
+				guild_member_data member{};
+				member.user.id		 = uint64_t{ 1000000000000000000 } + chunkIndex * memberCount + x;
+				member.user.userName = "member" + jsonifier::toString(x);
+				member.guildId		 = guildId;
+				member.nick			 = "nick" + jsonifier::toString(x);
+				members.emplace_back(std::move(member));
+			}
+			return members;
+		}
+
+		bool testChunkCaching() {
+			bool returnValue{ true };
+			object_cache<guild_member_cache_data> cache{};
+			auto chunk = buildChunk(1, 0, 1000);
+			cache.emplaceRange(chunk, std::identity{});
+			returnValue &= check(cache.count() == 1000, "every member of a chunk is cached");
+			returnValue &= check(cache.contains(two_id_key{ chunk[500] }), "a cached member is found by its guild and user ids");
+			cache.emplaceRange(chunk, std::identity{});
+			returnValue &= check(cache.count() == 1000, "a chunk that arrives again replaces its members rather than adding them twice");
+			return returnValue;
+		}
+
+		/// Measures caching chunks in bulk against caching their members one at a time, as chunks used to be - with one guild's chunks arriving on a
+		/// single lane, and with four guilds' chunks arriving on four lanes at once. Each is the best of several runs, each into a fresh cache.
+		bool benchmarkChunkCaching() {
+			bool returnValue{ true };
+			static constexpr uint64_t chunkCount{ 50 };
+			static constexpr uint64_t memberCount{ 1000 };
+			static constexpr uint64_t laneCount{ 4 };
+			static constexpr uint64_t runCount{ 5 };
+			std::vector<jsonifier::vector<guild_member_data>> chunks{};
+			for (uint64_t x = 0; x < chunkCount * laneCount; ++x) {
+				chunks.emplace_back(buildChunk(x % laneCount + 1, x, memberCount));
+			}
+			for (bool bulk: { true, false }) {
+				jsonifier::string name{ bulk ? "in bulk" : "one member at a time" };
+				for (uint64_t threadCount: { uint64_t{ 1 }, laneCount }) {
+					double bestSeconds{ std::numeric_limits<double>::max() };
+					for (uint64_t x = 0; x < runCount; ++x) {
+						object_cache<guild_member_cache_data> cache{};
+						auto startTime = std::chrono::steady_clock::now();
+						std::vector<std::jthread> threads{};
+						for (uint64_t y = 0; y < threadCount; ++y) {
+							threads.emplace_back([&, y] {
+								for (uint64_t z = y; z < chunkCount * threadCount; z += threadCount) {
+									if (bulk) {
+										cache.emplaceRange(chunks[z], std::identity{});
+									} else {
+										for (auto& value: chunks[z]) {
+											cache.emplace(guild_member_cache_data{ value });
+										}
+									}
+								}
+							});
+						}
+						threads.clear();
+						bestSeconds = std::min(bestSeconds, std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - startTime).count());
+						returnValue &= check(cache.count() == chunkCount * threadCount * memberCount, "every benchmarked member is cached");
+					}
+					std::cout << "Benchmark caching chunks " << name << " on " << threadCount << " lanes: "
+							  << static_cast<uint64_t>(static_cast<double>(chunkCount * threadCount * memberCount) / bestSeconds) << " members per second, best of "
+							  << runCount << " runs." << std::endl;
+				}
+			}
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testChunkCaching();
+	returnValue &= benchmarkChunkCaching();
+	return reportResults(returnValue);
+}
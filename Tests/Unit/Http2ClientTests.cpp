@@ -0,0 +1,116 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// Http2ClientTests.cpp - Tests for the hpack encoder and decoder.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file Http2ClientTests.cpp
+
+#include "UnitTest.hpp"
+#include <discordcoreapi/Utilities/Http2Client.hpp>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		bool hasHeader(const jsonifier::vector<hpack_header>& headers, uint64_t index, jsonifier::string_view name, jsonifier::string_view value) {
+			return index < headers.size() && headers[index].name == name && headers[index].value == value;
+		}
+
+		bool testHpackRoundTrip() {
+			bool returnValue{ true };
+			hpack_encoder encoder{};
+			hpack_decoder decoder{};
+			// The second block repeats the first, so it decodes from the dynamic table that the first one built.
+			for (uint64_t x = 0; x < 2; ++x) {
+				jsonifier::string block{};
+				encoder.beginBlock(block);
+				encoder.encode(block, ":method", "POST", true);
+				encoder.encode(block, ":path", "/api/v10/interactions/1/token/callback", true);
+				encoder.encode(block, "authorization", "Bot token", false);
+				encoder.encode(block, "x-audit-log-reason", "testing", true);
+				jsonifier::vector<hpack_header> headers{};
+				returnValue &= check(decoder.decode(block, headers), "hpack block decodes");
+				returnValue &= check(headers.size() == 4, "hpack block has every header");
+				returnValue &= check(hasHeader(headers, 0, ":method", "POST"), "hpack :method round-trips");
+				returnValue &= check(hasHeader(headers, 1, ":path", "/api/v10/interactions/1/token/callback"), "hpack :path round-trips");
+				returnValue &= check(hasHeader(headers, 2, "authorization", "Bot token"), "hpack unindexed header round-trips");
+				returnValue &= check(hasHeader(headers, 3, "x-audit-log-reason", "testing"), "hpack literal name round-trips");
+				if (x == 1) {
+					// Indexed fields are a byte each; only the unindexed authorization header is spelled out again.
+					returnValue &= check(block.size() < 20, "a repeated block is encoded from the dynamic table");
+				}
+			}
+			return returnValue;
+		}
+
+		bool testHuffmanDecoding() {
+			bool returnValue{ true };
+			hpack_decoder decoder{};
+			// Rfc 7541, appendix c.4 - the same requests as c.3, with huffman-coded strings.
+			jsonifier::vector<hpack_header> headers{};
+			returnValue &= check(decoder.decode(fromBytes({ 0x82, 0x86, 0x84, 0x41, 0x8c, 0xf1, 0xe3, 0xc2, 0xe5, 0xf2, 0x3a, 0x6b, 0xa0, 0xab, 0x90, 0xf4, 0xff }), headers),
+				"huffman block c.4.1 decodes");
+			returnValue &= check(hasHeader(headers, 0, ":method", "GET"), "c.4.1 :method");
+			returnValue &= check(hasHeader(headers, 1, ":scheme", "http"), "c.4.1 :scheme");
+			returnValue &= check(hasHeader(headers, 2, ":path", "/"), "c.4.1 :path");
+			returnValue &= check(hasHeader(headers, 3, ":authority", "www.example.com"), "c.4.1 huffman-coded :authority");
+			headers.clear();
+			returnValue &= check(decoder.decode(fromBytes({ 0x82, 0x86, 0x84, 0xbe, 0x58, 0x86, 0xa8, 0xeb, 0x10, 0x64, 0x9c, 0xbf }), headers), "huffman block c.4.2 decodes");
+			returnValue &= check(hasHeader(headers, 3, ":authority", "www.example.com"), "c.4.2 :authority from the dynamic table");
+			returnValue &= check(hasHeader(headers, 4, "cache-control", "no-cache"), "c.4.2 huffman-coded cache-control");
+			headers.clear();
+			// A string padded with a zero bit, rather than the most significant bits of the end-of-string code, is malformed.
+			returnValue &= check(!decoder.decode(fromBytes({ 0x40, 0x81, 0x00, 0x81, 0x00 }), headers), "huffman padding that isn't all ones is rejected");
+			return returnValue;
+		}
+
+		bool testHpackTableEviction() {
+			bool returnValue{ true };
+			hpack_table table{};
+			table.setMaxSize(100);
+			// Each entry costs its name, its value and 32 bytes of overhead - so only the last two of these fit.
+			table.insert("a", "0123456789");
+			table.insert("b", "0123456789");
+			table.insert("c", "0123456789");
+			jsonifier::string_view name{};
+			jsonifier::string_view value{};
+			returnValue &= check(table.get(hpack_table::staticTableSize + 1, name, value) && name == "c", "the newest entry comes first in the dynamic table");
+			returnValue &= check(table.get(hpack_table::staticTableSize + 2, name, value) && name == "b", "older entries follow it");
+			returnValue &= check(!table.get(hpack_table::staticTableSize + 3, name, value), "the oldest entry is evicted when the table is full");
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testHpackRoundTrip();
+	returnValue &= testHuffmanDecoding();
+	returnValue &= testHpackTableEviction();
+	return reportResults(returnValue);
+}
@@ -0,0 +1,252 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// HttpsClientTests.cpp - Tests, fuzzing and benchmarks for the https request serializer and response parser.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file HttpsClientTests.cpp
+
+#include "UnitTest.hpp"
+#include <charconv>
+#include <random>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// Feeds a response to a connection's parser in pieces of the given size, returning the parsed response - the connection is reset first, as the
+		/// client resets a pooled connection for each request.
+		https_response_data parseInPieces(https_connection& connection, jsonifier::string_view response, uint64_t pieceSize) {
+			https_workload_data workload{};
+			workload.baseUrl = "https://discord.com/api/v10";
+			connection.resetValues(std::move(workload), nullptr);
+			for (uint64_t x = 0; x < response.size() && connection.data.currentState != https_state::complete; x += pieceSize) {
+				connection.inputBufferReal += response.substr(x, std::min(pieceSize, response.size() - x));
+				connection.parseResponse();
+			}
+			return std::move(connection.data);
+		}
+
+		https_response_data parseInPieces(jsonifier::string_view response, uint64_t pieceSize) {
+			https_connection connection{};
+			return parseInPieces(connection, response, pieceSize);
+		}
+
+		static constexpr jsonifier::string_view sizedResponse{ "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: 17\r\n\r\n{\"message\":\"hi\"}\n" };
+		static constexpr jsonifier::string_view chunkedResponse{
+			"HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n7\r\n{\"messa\r\na;ext=1\r\nge\":\"hi\"}\n\r\n0\r\nX-Trailer: 1\r\n\r\n"
+		};
+
+		bool testHttpParserSplits() {
+			bool returnValue{ true };
+			for (uint64_t pieceSize: { uint64_t{ 1 }, uint64_t{ 2 }, uint64_t{ 3 }, uint64_t{ 7 }, uint64_t{ 4096 } }) {
+				// Every piece size splits the header terminator, chunk-size lines and chunk bodies at different places.
+				auto sizedData = parseInPieces(sizedResponse, pieceSize);
+				returnValue &= check(sizedData.currentState == https_state::complete, "content-length response completes");
+				returnValue &= check(sizedData.responseCode == 200, "content-length response code");
+				returnValue &= check(sizedData.responseData == "{\"message\":\"hi\"}\n", "content-length body");
+				returnValue &= check(sizedData.responseHeaders.at("content-type") == "application/json", "headers ignore case");
+				auto chunkedData = parseInPieces(chunkedResponse, pieceSize);
+				returnValue &= check(chunkedData.currentState == https_state::complete, "chunked response completes");
+				returnValue &= check(chunkedData.responseData == "{\"message\":\"hi\"}\n", "chunked body, with an extension and a trailer");
+			}
+			return returnValue;
+		}
+
+		/// Feeds thousands of corrupted and truncated responses to the parser, in random pieces. Each has to be parsed without the parser running past
+		/// its input or stalling, and never with a body larger than what was received.
+		bool fuzzHttpParser() {
+			bool returnValue{ true };
+			std::mt19937_64 random{ 43 };
+			static constexpr jsonifier::string_view alphabet{ "0123456789abcdefABCDEF\r\n:; -HTTP/1.chunkedContent-LengthTransfer-Encoding" };
+			uint64_t oversizedCount{};
+			uint64_t completeCount{};
+			for (uint64_t x = 0; x < 20000; ++x) {
+				jsonifier::string response{ x % 2 == 0 ? sizedResponse : chunkedResponse };
+				uint64_t mutationCount{ 1 + random() % 4 };
+				for (uint64_t y = 0; y < mutationCount; ++y) {
+					uint64_t position{ random() % response.size() };
+					switch (random() % 4) {
+						case 0: {
+							response[position] = alphabet[random() % alphabet.size()];
+							break;
+						}
+						case 1: {
+							response[position] = static_cast<char>(random());
+							break;
+						}
+						case 2: {
+							response.insert(response.begin() + static_cast<int64_t>(position), alphabet[random() % alphabet.size()]);
+							break;
+						}
+						case 3: {
+							response.resize(position);
+							break;
+						}
+					}
+					if (response.size() == 0) {
+						response = sizedResponse;
+					}
+				}
+				auto data = parseInPieces(response, 1 + random() % 16);
+				oversizedCount += data.responseData.size() > response.size();
+				completeCount += data.currentState == https_state::complete;
+			}
+			returnValue &= check(oversizedCount == 0, "no corrupted response yields a body larger than its input");
+			std::cout << "Fuzzed the https parser with 20000 corrupted responses, " << completeCount << " of which completed." << std::endl;
+			return returnValue;
+		}
+
+		/// Measures the parser's throughput on typical rest responses - a 4 KiB body, sized and chunked - fed in the 16 KiB reads that tls delivers.
+		bool benchmarkHttpParser() {
+			bool returnValue{ true };
+			jsonifier::string body{};
+			for (uint64_t x = 0; body.size() < 4096; ++x) {
+				body += "{\"id\":\"" + jsonifier::toString(uint64_t{ 1000000000000000000 } + x) + "\",\"type\":0},";
+			}
+			jsonifier::string headers{ "HTTP/1.1 200 OK\r\nDate: Mon, 19 Oct 2026 12:00:00 GMT\r\nContent-Type: application/json\r\nConnection: keep-alive\r\nx-ratelimit-bucket: "
+									   "abcd1234\r\nx-ratelimit-limit: 5\r\nx-ratelimit-remaining: 4\r\nx-ratelimit-reset: 1760875200.000\r\nx-ratelimit-reset-after: "
+									   "1.000\r\nvia: 1.1 google\r\ncf-cache-status: DYNAMIC\r\nServer: cloudflare\r\n" };
+			jsonifier::string sizedBody{ headers + "Content-Length: " + jsonifier::toString(body.size()) + "\r\n\r\n" + body };
+			jsonifier::string chunkedBody{ headers + "Transfer-Encoding: chunked\r\n\r\n" };
+			for (uint64_t x = 0; x < body.size(); x += 1000) {
+				jsonifier::string chunk{ body.substr(x, std::min(uint64_t{ 1000 }, body.size() - x)) };
+				std::array<char, 16> digits{};
+				auto end = std::to_chars(digits.data(), digits.data() + digits.size(), chunk.size(), 16).ptr;
+				chunkedBody += jsonifier::string{ digits.data(), static_cast<uint64_t>(end - digits.data()) } + "\r\n" + chunk + "\r\n";
+			}
+			chunkedBody += "0\r\n\r\n";
+			https_connection connection{};
+			uint64_t bodySize{};
+			double nsPerIteration{ benchmark("https parsing, sized", 100000, [&](uint64_t) {
+				bodySize = parseInPieces(connection, sizedBody, 16384).responseData.size();
+			}) };
+			std::cout << "Benchmark https parsing, sized: " << static_cast<double>(sizedBody.size()) / nsPerIteration * 1000.0 << " MB per second." << std::endl;
+			returnValue &= check(bodySize == body.size(), "the sized benchmark response parses in full");
+			nsPerIteration = benchmark("https parsing, chunked", 100000, [&](uint64_t) {
+				bodySize = parseInPieces(connection, chunkedBody, 16384).responseData.size();
+			});
+			std::cout << "Benchmark https parsing, chunked: " << static_cast<double>(chunkedBody.size()) / nsPerIteration * 1000.0 << " MB per second." << std::endl;
+			returnValue &= check(bodySize == body.size(), "the chunked benchmark response parses in full");
+			return returnValue;
+		}
+
+
+		/// Exposes the buffer that a request is serialized into while its connection is down.
+		class test_https_connection : public https_connection {
+		  public:
+			using https_rnr_builder::requestBuffer;
+		};
+
+		static constexpr jsonifier::string_view testClientHeaders{ "Authorization: Bot token\r\nUser-Agent: DiscordCoreAPI (https://discordcoreapi.com/1.0)\r\n" };
+
+		void loadWorkload(test_https_connection& connection, rate_limit_data& rateLimitData, https_workload_class workloadClass, jsonifier::string_view relativePath,
+			jsonifier::string_view content) {
+			https_workload_data workload{ https_workload_type::Unset };
+			workload.workloadClass = workloadClass;
+			workload.relativePath  = relativePath;
+			workload.content	   = content;
+			workload.headersToInsert["X-Audit-Log-Reason"] = "testing";
+			connection.resetValues(std::move(workload), &rateLimitData);
+		}
+
+		/// The request that the template-based serializer replaced, built up by concatenation.
+		jsonifier::string buildRequestByConcatenation(const https_workload_data& workload) {
+			jsonifier::string returnString{ (workload.workloadClass == https_workload_class::Get ? "GET " : "POST ") + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n" };
+			for (auto& [key, value]: workload.headersToInsert) {
+				returnString += key + ": " + value + "\r\n";
+			}
+			returnString += testClientHeaders;
+			returnString += "Pragma: no-cache\r\n";
+			returnString += "Connection: keep-alive\r\n";
+			returnString += "Host: discord.com\r\n";
+			returnString += "Content-Type: application/json\r\n";
+			if (workload.workloadClass != https_workload_class::Get) {
+				returnString += "Content-Length: " + jsonifier::toString(workload.content.size()) + "\r\n\r\n";
+				returnString += workload.content;
+			} else {
+				returnString += "\r\n";
+			}
+			return returnString;
+		}
+
+		bool testRequestSerialization() {
+			bool returnValue{ true };
+			test_https_connection connection{};
+			rate_limit_data rateLimitData{};
+			loadWorkload(connection, rateLimitData, https_workload_class::Post, "/channels/1/messages", "{\"content\":\"hi\"}");
+			connection.writeRequest(testClientHeaders);
+			returnValue &= check(connection.requestBuffer ==
+					"POST https://discord.com/api/v10/channels/1/messages HTTP/1.1\r\nX-Audit-Log-Reason: testing\r\n" + static_cast<jsonifier::string>(testClientHeaders) +
+						"Pragma: no-cache\r\nConnection: keep-alive\r\nHost: discord.com\r\nContent-Type: application/json\r\nContent-Length: 16\r\n\r\n{\"content\":\"hi\"}",
+				"a request with a body is serialized with its exact length");
+			returnValue &= check(connection.requestBuffer == buildRequestByConcatenation(connection.workload), "the serializer matches the concatenated request");
+			// The same connection's next request, to another path and with another method, rebuilds the template.
+			loadWorkload(connection, rateLimitData, https_workload_class::Get, "/channels/2", "");
+			connection.writeRequest(testClientHeaders);
+			returnValue &= check(connection.requestBuffer == buildRequestByConcatenation(connection.workload), "a request without a body, after the method changes");
+			return returnValue;
+		}
+
+		/// Measures the serializer against the concatenation it replaced, for a typical get and for a message post with a 2 KiB body.
+		bool benchmarkRequestSerialization() {
+			bool returnValue{ true };
+			static constexpr uint64_t iterationCount{ 500000 };
+			jsonifier::string content{ "{\"content\":\"" };
+			while (content.size() < 2048) {
+				content.push_back('a');
+			}
+			content += "\"}";
+			test_https_connection connection{};
+			rate_limit_data rateLimitData{};
+			for (auto workloadClass: { https_workload_class::Get, https_workload_class::Post }) {
+				jsonifier::string name{ workloadClass == https_workload_class::Get ? "get" : "post" };
+				loadWorkload(connection, rateLimitData, workloadClass, "/channels/1/messages/2", workloadClass == https_workload_class::Get ? "" : content);
+				double nsTemplate{ benchmark("request serialization, " + name, iterationCount, [&](uint64_t) {
+					connection.writeRequest(testClientHeaders);
+				}) };
+				uint64_t size{};
+				double nsConcatenation{ benchmark("request concatenation, " + name, iterationCount, [&](uint64_t) {
+					size += buildRequestByConcatenation(connection.workload).size();
+				}) };
+				returnValue &= check(size == iterationCount * connection.requestBuffer.size(), "both serializers build requests of the same size");
+				std::cout << "Serializing a " << name << " request takes " << nsTemplate << " ns, against " << nsConcatenation << " ns by concatenation." << std::endl;
+			}
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testHttpParserSplits();
+	returnValue &= fuzzHttpParser();
+	returnValue &= benchmarkHttpParser();
+	returnValue &= testRequestSerialization();
+	returnValue &= benchmarkRequestSerialization();
+	return reportResults(returnValue);
+}
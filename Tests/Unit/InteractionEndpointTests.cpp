@@ -0,0 +1,228 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// InteractionEndpointTests.cpp - Load tests for the http interactions endpoint, from local http clients.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file InteractionEndpointTests.cpp
+
+#include "UnitTest.hpp"
+#include <discordcoreapi/Utilities/InteractionEndpoint.hpp>
+#include <sodium.h>
+#include <random>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+#if defined(MSG_NOSIGNAL)
+		static constexpr int32_t clientSendFlags{ MSG_NOSIGNAL };
+#else
+		static constexpr int32_t clientSendFlags{};
+#endif
+
+		/// A blocking http/1.1 client, that keeps its connection alive between requests.
+		struct test_http_client {
+			jsonifier::string buffer{};
+			socket_wrapper socket{};
+
+			bool connect(uint16_t port) {
+				sockaddr_in address{};
+				address.sin_family		= AF_INET;
+				address.sin_port		= htons(port);
+				address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+				socket					= ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+				return ::connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != SOCKET_ERROR;
+			}
+
+			bool sendAll(jsonifier::string_view data) {
+				uint64_t bytesWritten{};
+				while (bytesWritten < data.size()) {
+					auto result = send(socket, data.data() + bytesWritten, static_cast<int32_t>(data.size() - bytesWritten), clientSendFlags);
+					if (result <= 0) {
+						return false;
+					}
+					bytesWritten += static_cast<uint64_t>(result);
+				}
+				return true;
+			}
+
+			bool receiveMore(milliseconds timeout) {
+				pollfd readFd{};
+				readFd.fd	  = socket;
+				readFd.events = POLLIN;
+				if (poll(&readFd, 1, static_cast<int32_t>(timeout.count())) <= 0) {
+					return false;
+				}
+				uint64_t oldSize{ buffer.size() };
+				buffer.resize(oldSize + 4096);
+				auto bytesRead = recv(socket, buffer.data() + oldSize, 4096, 0);
+				buffer.resize(oldSize + static_cast<uint64_t>(std::max(static_cast<int64_t>(bytesRead), int64_t{ 0 })));
+				return bytesRead > 0;
+			}
+
+			/// Reads a single response, returning its body if its status is 200.
+			bool readResponse(jsonifier::string& body, milliseconds timeout = milliseconds{ 5000 }) {
+				uint64_t headerEnd{};
+				while ((headerEnd = buffer.find("\r\n\r\n")) == jsonifier::string::npos) {
+					if (!receiveMore(timeout)) {
+						return false;
+					}
+				}
+				uint64_t lengthStart{ buffer.find("Content-Length: ") };
+				if (lengthStart == jsonifier::string::npos || lengthStart > headerEnd) {
+					return false;
+				}
+				uint64_t contentLength{ jsonifier::strToUint64(buffer.data() + lengthStart + 16) };
+				while (buffer.size() < headerEnd + 4 + contentLength) {
+					if (!receiveMore(timeout)) {
+						return false;
+					}
+				}
+				bool isItOk{ buffer.find("HTTP/1.1 200") == 0 };
+				body   = buffer.substr(headerEnd + 4, contentLength);
+				buffer = buffer.substr(headerEnd + 4 + contentLength);
+				return isItOk;
+			}
+		};
+
+		/// The application's keys, and a ping signed with them - as discord would send it.
+		struct test_signer {
+			std::array<uint8_t, crypto_sign_SECRETKEYBYTES> secretKey{};
+			std::array<uint8_t, crypto_sign_PUBLICKEYBYTES> publicKey{};
+
+			test_signer() {
+				crypto_sign_keypair(publicKey.data(), secretKey.data());
+			}
+
+			jsonifier::string getPublicKeyHex() const {
+				jsonifier::string returnData(publicKey.size() * 2 + 1, '\0');
+				sodium_bin2hex(returnData.data(), returnData.size(), publicKey.data(), publicKey.size());
+				returnData.resize(publicKey.size() * 2);
+				return returnData;
+			}
+
+			jsonifier::string buildPing() const {
+				jsonifier::string body{ "{\"type\":1,\"id\":\"1\"}" };
+				jsonifier::string timestamp{ jsonifier::toString(
+					static_cast<uint64_t>(std::chrono::duration_cast<seconds>(sys_clock::now().time_since_epoch()).count())) };
+				jsonifier::string message{ timestamp + body };
+				std::array<uint8_t, crypto_sign_BYTES> signature{};
+				crypto_sign_detached(signature.data(), nullptr, reinterpret_cast<const uint8_t*>(message.data()), message.size(), secretKey.data());
+				jsonifier::string signatureHex(signature.size() * 2 + 1, '\0');
+				sodium_bin2hex(signatureHex.data(), signatureHex.size(), signature.data(), signature.size());
+				signatureHex.resize(signature.size() * 2);
+				return "POST /interactions HTTP/1.1\r\nHost: localhost\r\nContent-Type: application/json\r\nX-Signature-Ed25519: " + signatureHex +
+					"\r\nX-Signature-Timestamp: " + timestamp + "\r\nContent-Length: " + jsonifier::toString(body.size()) + "\r\n\r\n" + body;
+			}
+		};
+
+		/// An endpoint with only a couple of workers, along with the lanes it hands interactions to.
+		struct test_endpoint {
+			https_client_core client{ "token" };
+			interaction_response_lane lane{ client, 1, {} };
+			gateway_event_executor executor{ 1, [](jsonifier::jsonifier_core<false>&, uint64_t, jsonifier::string_view_base<uint8_t>) {
+											} };
+			uint16_t port{ static_cast<uint16_t>(40000 + std::random_device{}() % 20000) };
+			interaction_endpoint endpoint;
+
+			test_endpoint(const test_signer& signer, uint64_t workerCount)
+				: endpoint{ interaction_endpoint_options{ .bindAddress = "127.0.0.1", .publicKey = signer.getPublicKeyHex(), .port = port }, workerCount, lane, executor } {
+			}
+		};
+
+		/// Holds more idle connections open than there are workers - a new client has to be served regardless.
+		bool testIdleConnectionsDontHoldWorkers() {
+			bool returnValue{ true };
+			test_signer signer{};
+			test_endpoint endpoint{ signer, 2 };
+			returnValue &= check(endpoint.endpoint.isListening(), "the endpoint listens");
+			std::vector<test_http_client> idleClients(8);
+			jsonifier::string body{};
+			for (uint64_t x = 0; x < idleClients.size(); ++x) {
+				returnValue &= check(idleClients[x].connect(endpoint.port), "an idle client connects");
+				// Half of them go idle after a request, and the others never send one.
+				if (x % 2 == 0) {
+					returnValue &= check(idleClients[x].sendAll(signer.buildPing()) && idleClients[x].readResponse(body), "a kept-alive client is answered");
+				}
+			}
+			test_http_client client{};
+			hrclock::time_point startTime{ hrclock::now() };
+			returnValue &= check(client.connect(endpoint.port) && client.sendAll(signer.buildPing()) && client.readResponse(body, milliseconds{ 2000 }),
+				"a new client is answered while every worker's worth of connections sits idle");
+			returnValue &= check(body == "{\"type\":1}", "a ping is answered with a pong");
+			returnValue &= check(hrclock::now() - startTime < milliseconds{ 500 }, "the new client doesn't wait for the idle connections to time out");
+			returnValue &= check(idleClients[0].sendAll(signer.buildPing()) && idleClients[0].readResponse(body), "an idle connection is served again");
+			// Two requests written at once are both answered, in order, on the one connection.
+			returnValue &= check(client.sendAll(signer.buildPing() + signer.buildPing()) && client.readResponse(body) && client.readResponse(body),
+				"pipelined requests are answered");
+			return returnValue;
+		}
+
+		/// Many more keep-alive clients than workers, each making requests back to back.
+		bool benchmarkKeepAliveLoad() {
+			static constexpr uint64_t clientCount{ 32 };
+			static constexpr uint64_t requestCount{ 100 };
+			bool returnValue{ true };
+			test_signer signer{};
+			test_endpoint endpoint{ signer, 2 };
+			// The requests are signed up front, so that the clients measure the endpoint rather than the signing.
+			jsonifier::string ping{ signer.buildPing() };
+			std::atomic<uint64_t> answered{};
+			std::vector<std::jthread> clients{};
+			hrclock::time_point startTime{ hrclock::now() };
+			for (uint64_t x = 0; x < clientCount; ++x) {
+				clients.emplace_back([&] {
+					test_http_client client{};
+					jsonifier::string body{};
+					if (!client.connect(endpoint.port)) {
+						return;
+					}
+					for (uint64_t y = 0; y < requestCount; ++y) {
+						if (!client.sendAll(ping) || !client.readResponse(body)) {
+							return;
+						}
+						answered.fetch_add(1, std::memory_order_relaxed);
+					}
+				});
+			}
+			clients.clear();
+			double elapsedSeconds{ std::chrono::duration_cast<std::chrono::duration<double>>(hrclock::now() - startTime).count() };
+			std::cout << "Keep-alive load: " << answered.load() << " requests from " << clientCount << " clients on 2 workers, in " << elapsedSeconds << "s - "
+					  << static_cast<uint64_t>(static_cast<double>(answered.load()) / elapsedSeconds) << " requests per second." << std::endl;
+			returnValue &= check(answered.load() == clientCount * requestCount, "every client's every request is answered");
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testIdleConnectionsDontHoldWorkers();
+	returnValue &= benchmarkKeepAliveLoad();
+	return reportResults(returnValue);
+}
@@ -0,0 +1,184 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ShardStartupSchedulerTests.cpp - Tests for the shard startup scheduler, against a mock gateway.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file ShardStartupSchedulerTests.cpp
+
+#include "UnitTest.hpp"
+#include <discordcoreapi/Utilities/ShardStartupScheduler.hpp>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		bool testShardStartupScheduler() {
+			bool returnValue{ true };
+			jsonifier::vector<uint64_t> shardIds{};
+			for (uint64_t x = 8; x > 0; --x) {
+				shardIds.emplace_back(x - 1);
+			}
+			shard_startup_scheduler scheduler{ shardIds, 4 };
+			// Each bucket - shard_id % max_concurrency - releases its lowest queued shard first.
+			returnValue &= check(!scheduler.tryAcquire(4), "a shard waits for the lower shards of its bucket");
+			for (uint64_t x = 0; x < 4; ++x) {
+				returnValue &= check(scheduler.tryAcquire(x), "the first shard of every bucket identifies at once");
+			}
+			returnValue &= check(!scheduler.tryAcquire(4), "a bucket identifies one shard per interval");
+			returnValue &= check(!scheduler.tryAcquire(5), "buckets are assigned by shard_id % max_concurrency");
+			returnValue &= check(scheduler.tryAcquire(6, true), "a resuming shard skips its bucket");
+			auto progress = scheduler.getProgress();
+			returnValue &= check(progress.totalShards == 8 && progress.queuedShards == 3 && progress.connectingShards == 5, "startup progress");
+			returnValue &= check(scheduler.markReady(0) && !scheduler.markReady(0), "a shard becomes ready once");
+			returnValue &= check(scheduler.getProgress().readyShards == 1, "ready shards are counted");
+			// Keeps shards 7 and 6.
+			shardIds.resize(2);
+			shard_startup_scheduler singleBucket{ shardIds, 0 };
+			returnValue &= check(singleBucket.tryAcquire(6) && !singleBucket.tryAcquire(7), "a max_concurrency of zero is treated as one");
+			return returnValue;
+		}
+
+		/// Stands in for the gateway's side of the session start limit - an identify in a bucket that has identified within the interval is refused, as
+		/// the gateway would refuse it.
+		struct mock_gateway {
+			std::vector<hrclock::time_point> lastIdentifyTimes{};
+			uint64_t violations{};
+			uint64_t identifies{};
+			uint64_t resumes{};
+
+			mock_gateway(uint64_t maxConcurrency) : lastIdentifyTimes(maxConcurrency) {
+			}
+
+			bool identify(uint64_t shardId) {
+				auto& lastIdentifyTime = lastIdentifyTimes[shardId % lastIdentifyTimes.size()];
+				hrclock::time_point now{ hrclock::now() };
+				// The client starts its interval just before the identify reaches the gateway.
+				if (lastIdentifyTime != hrclock::time_point{} && now - lastIdentifyTime < shard_startup_scheduler::identifyInterval - milliseconds{ 10 }) {
+					++violations;
+					return false;
+				}
+				lastIdentifyTime = now;
+				++identifies;
+				return true;
+			}
+
+			void resume() {
+				++resumes;
+			}
+		};
+
+		/// A shard as a socket agent sees it.
+		struct mock_shard {
+			hrclock::time_point reconnectedAt{};
+			hrclock::time_point lostAt{};
+			bool connected{};
+			bool resuming{};
+			bool queued{ true };
+		};
+
+		/// Runs the socket agents' loop against the mock gateway - the shards start up, then two of them lose their connections, one to resume and one to
+		/// identify again, and every other shard has to keep being serviced while they wait.
+		bool testReconnectionAgainstMockGateway() {
+			static constexpr uint64_t maxConcurrency{ 4 };
+			static constexpr uint64_t shardCount{ 8 };
+			bool returnValue{ true };
+			jsonifier::vector<uint64_t> shardIds{};
+			for (uint64_t x = 0; x < shardCount; ++x) {
+				shardIds.emplace_back(x);
+			}
+			shard_startup_scheduler scheduler{ shardIds, maxConcurrency };
+			mock_gateway gateway{ maxConcurrency };
+			std::vector<mock_shard> shards(shardCount);
+			hrclock::time_point startTime{ hrclock::now() };
+			hrclock::time_point deadline{ startTime + seconds{ 30 } };
+			nanoseconds longestPass{};
+			uint64_t servicedPasses{};
+			bool dropped{};
+			while (hrclock::now() < deadline) {
+				hrclock::time_point passStart{ hrclock::now() };
+				for (uint64_t x = 0; x < shardCount; ++x) {
+					auto& shard = shards[x];
+					if (shard.connected) {
+						continue;
+					} else if (shard.queued) {
+						if (scheduler.tryAcquire(x) && gateway.identify(x)) {
+							shard.queued	= false;
+							shard.connected = true;
+							scheduler.markReady(x);
+						}
+					} else if (scheduler.tryReconnect(x, shard.resuming)) {
+						if (shard.resuming) {
+							gateway.resume();
+						} else if (!gateway.identify(x)) {
+							continue;
+						}
+						shard.connected		= true;
+						shard.reconnectedAt = hrclock::now();
+					}
+				}
+				if (!dropped && scheduler.getProgress().readyShards == shardCount) {
+					dropped = true;
+					for (uint64_t x: { uint64_t{ 1 }, uint64_t{ 6 } }) {
+						shards[x].connected = false;
+						shards[x].resuming	= x == 1;
+						shards[x].lostAt	= hrclock::now();
+					}
+				}
+				if (dropped) {
+					++servicedPasses;
+					longestPass = std::max(longestPass, std::chrono::duration_cast<nanoseconds>(hrclock::now() - passStart));
+					if (shards[1].connected && shards[6].connected) {
+						break;
+					}
+				}
+				std::this_thread::sleep_for(milliseconds{ 1 });
+			}
+			auto resumeDelay   = std::chrono::duration_cast<milliseconds>(shards[1].reconnectedAt - shards[1].lostAt);
+			auto identifyDelay = std::chrono::duration_cast<milliseconds>(shards[6].reconnectedAt - shards[6].lostAt);
+			std::cout << "Mock gateway: " << gateway.identifies << " identifies, " << gateway.resumes << " resumes, resumed after " << resumeDelay.count()
+					  << "ms, identified again after " << identifyDelay.count() << "ms, longest agent pass " << longestPass.count() / 1000 << "us, over "
+					  << servicedPasses << " passes." << std::endl;
+			returnValue &= check(dropped && shards[1].connected && shards[6].connected, "every shard starts up, and the lost shards reconnect");
+			returnValue &= check(gateway.violations == 0, "no bucket identifies twice within its interval");
+			returnValue &= check(gateway.identifies == shardCount + 1 && gateway.resumes == 1, "the resuming shard resumes, and the other identifies");
+			returnValue &= check(resumeDelay >= shard_startup_scheduler::reconnectBackoff && resumeDelay < shard_startup_scheduler::reconnectBackoff + milliseconds{ 500 },
+				"a resuming shard waits out the backoff, and no more");
+			returnValue &= check(identifyDelay >= shard_startup_scheduler::reconnectBackoff, "an identifying shard waits out the backoff, and its bucket's interval");
+			// The old loop slept for a second per lost shard, holding up every other shard of the agent.
+			returnValue &= check(longestPass < milliseconds{ 100 } && servicedPasses > 100, "the other shards keep being serviced while the lost ones back off");
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testShardStartupScheduler();
+	returnValue &= testReconnectionAgainstMockGateway();
+	return reportResults(returnValue);
+}
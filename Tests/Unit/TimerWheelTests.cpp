@@ -0,0 +1,171 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// TimerWheelTests.cpp - Tests and benchmarks for the timer wheel, and for the waits that now ride on it.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file TimerWheelTests.cpp
+
+#include "UnitTest.hpp"
+#include <random>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		bool testTimerWheel() {
+			bool returnValue{ true };
+			std::vector<uint64_t> firedTimers{};
+			std::condition_variable condition{};
+			std::mutex accessMutex{};
+			// Declared last, so that its thread is joined before anything its callbacks touch is destroyed.
+			timer_wheel wheel{};
+			auto record = [&](uint64_t value) {
+				return [&, value] {
+					std::unique_lock lock{ accessMutex };
+					firedTimers.emplace_back(value);
+					condition.notify_all();
+				};
+			};
+			// Scheduled out of order, and across the first level's 64 slots, so that the later ones cascade down.
+			wheel.schedule(milliseconds{ 90 }, record(3));
+			wheel.schedule(milliseconds{ 10 }, record(1));
+			uint64_t cancelledId{ wheel.schedule(milliseconds{ 50 }, record(0)) };
+			wheel.schedule(milliseconds{ 40 }, record(2));
+			returnValue &= check(wheel.cancel(cancelledId), "cancelling a pending timer succeeds");
+			returnValue &= check(!wheel.cancel(cancelledId), "cancelling a timer twice fails");
+			std::unique_lock lock{ accessMutex };
+			condition.wait_for(lock, milliseconds{ 5000 }, [&] {
+				return firedTimers.size() >= 3;
+			});
+			lock.unlock();
+			std::this_thread::sleep_for(milliseconds{ 100 });
+			lock.lock();
+			returnValue &= check(firedTimers == std::vector<uint64_t>{ 1, 2, 3 }, "timers fire in expiry order, without the cancelled one");
+			lock.unlock();
+			uint64_t firedId{ wheel.schedule(milliseconds{ 1 }, [] {}) };
+			std::this_thread::sleep_for(milliseconds{ 50 });
+			returnValue &= check(!wheel.cancel(firedId), "cancelling a timer that fired fails");
+			returnValue &= check(wheel.size() == 0, "no timers are left pending");
+			return returnValue;
+		}
+
+		/// A callback that throws must neither stop the timer thread nor the timers that are due after it.
+		bool testThrowingCallbacks() {
+			bool returnValue{ true };
+			std::atomic_uint64_t firedCount{};
+			timer_wheel wheel{};
+			wheel.schedule(milliseconds{ 5 }, [] {
+				throw std::runtime_error{ "a standard exception" };
+			});
+			wheel.schedule(milliseconds{ 5 }, [] {
+				throw 42;
+			});
+			wheel.schedule(milliseconds{ 20 }, [&] {
+				firedCount.fetch_add(1, std::memory_order_release);
+			});
+			std::this_thread::sleep_for(milliseconds{ 200 });
+			returnValue &= check(firedCount.load(std::memory_order_acquire) == 1, "a timer fires after earlier callbacks threw");
+			return returnValue;
+		}
+
+		/// Schedules 100k timers over two seconds, cancels a tenth of them, and checks that the rest all fire - and never early.
+		bool testTimerWheelAtScale() {
+			bool returnValue{ true };
+			static constexpr uint64_t timerCount{ 100000 };
+			static constexpr int64_t spreadInMs{ 2000 };
+			std::vector<hrclock::time_point> deadlines(timerCount);
+			std::vector<int64_t> latenessInMs(timerCount, -1);
+			std::atomic_uint64_t firedCount{};
+			std::atomic_uint64_t earlyCount{};
+			std::vector<uint64_t> ids(timerCount);
+			std::mt19937_64 random{ 36 };
+			timer_wheel wheel{};
+			double nsPerSchedule{ benchmark("timer wheel scheduling", timerCount, [&](uint64_t x) {
+				milliseconds delay{ static_cast<int64_t>(random() % spreadInMs) };
+				deadlines[x] = hrclock::now() + delay;
+				ids[x]		 = wheel.schedule(delay, [&, x] {
+					  auto now{ hrclock::now() };
+					  earlyCount.fetch_add(now < deadlines[x], std::memory_order_relaxed);
+					  latenessInMs[x] = std::chrono::duration_cast<milliseconds>(now - deadlines[x]).count();
+					  firedCount.fetch_add(1, std::memory_order_release);
+				  });
+			}) };
+			uint64_t cancelledCount{};
+			for (uint64_t x = 0; x < timerCount; x += 10) {
+				cancelledCount += wheel.cancel(ids[x]);
+			}
+			stop_watch<milliseconds> stopWatch{ milliseconds{ spreadInMs * 5 } };
+			stopWatch.reset();
+			while (wheel.size() > 0 && !stopWatch.hasTimeElapsed()) {
+				std::this_thread::sleep_for(milliseconds{ 10 });
+			}
+			std::this_thread::sleep_for(milliseconds{ 50 });
+			returnValue &= check(firedCount.load(std::memory_order_acquire) + cancelledCount == timerCount, "every timer that wasn't cancelled fires");
+			returnValue &= check(earlyCount.load(std::memory_order_acquire) == 0, "no timer fires before its deadline");
+			std::vector<int64_t> fired{};
+			for (auto& value: latenessInMs) {
+				if (value >= 0) {
+					fired.emplace_back(value);
+				}
+			}
+			std::sort(fired.begin(), fired.end());
+			if (fired.size() > 0) {
+				std::cout << "Timer wheel with " << timerCount << " timers: " << nsPerSchedule << " ns per schedule, lateness p50 " << fired[fired.size() / 2] << " ms, p99 "
+						  << fired[fired.size() * 99 / 100] << " ms, max " << fired.back() << " ms." << std::endl;
+			}
+			return returnValue;
+		}
+
+		/// The timed receive replaces a 1 ms polling loop - it has to wake as soon as a value is sent, and give up once its time has passed.
+		bool testTimedReceive() {
+			bool returnValue{ true };
+			unbounded_message_block<uint64_t> block{};
+			uint64_t value{};
+			auto startTime = hrclock::now();
+			returnValue &= check(!block.tryReceiveFor(value, milliseconds{ 50 }), "a timed receive on an empty block times out");
+			returnValue &= check(hrclock::now() - startTime >= milliseconds{ 50 }, "a timed receive waits out its whole timeout");
+			std::jthread sender{ [&] {
+				std::this_thread::sleep_for(milliseconds{ 20 });
+				block.send(uint64_t{ 7 });
+			} };
+			startTime = hrclock::now();
+			returnValue &= check(block.tryReceiveFor(value, milliseconds{ 5000 }) && value == 7, "a timed receive collects a value that's sent while it waits");
+			returnValue &= check(hrclock::now() - startTime < milliseconds{ 1000 }, "a timed receive wakes once the value is sent");
+			return returnValue;
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	bool returnValue{ true };
+	returnValue &= testTimerWheel();
+	returnValue &= testThrowingCallbacks();
+	returnValue &= testTimerWheelAtScale();
+	returnValue &= testTimedReceive();
+	return reportResults(returnValue);
+}
@@ -0,0 +1,83 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// UnitTest.hpp - Shared helpers for the library's unit tests and benchmarks.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file UnitTest.hpp
+#pragma once
+
+#include <discordcoreapi/Index.hpp>
+#include <initializer_list>
+#include <iostream>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// @brief Reports a failed expectation.
+		/// @param condition the expectation.
+		/// @param description what was expected, for the failure message.
+		/// @return bool the condition, so that results can be accumulated with &=.
+		template<typename string_type> inline bool check(bool condition, const string_type& description) {
+			if (!condition) {
+				std::cerr << "Failed: " << description << std::endl;
+			}
+			return condition;
+		}
+
+		/// @brief Builds a string from raw bytes, for the tests that feed in wire data.
+		inline jsonifier::string fromBytes(std::initializer_list<uint8_t> bytes) {
+			jsonifier::string returnValue{};
+			for (auto& value: bytes) {
+				returnValue.push_back(static_cast<char>(value));
+			}
+			return returnValue;
+		}
+
+		/// @brief Times a function over a number of iterations, and prints the mean time per iteration.
+		/// @param name the benchmark's name.
+		/// @param iterations how many times to call the function.
+		/// @param function the function to time - it's passed the iteration's index.
+		/// @return double the mean time per iteration, in nanoseconds.
+		template<typename string_type, typename function_type> inline double benchmark(const string_type& name, uint64_t iterations, function_type&& function) {
+			auto startTime = std::chrono::steady_clock::now();
+			for (uint64_t x = 0; x < iterations; ++x) {
+				function(x);
+			}
+			auto totalTime = std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(std::chrono::steady_clock::now() - startTime);
+			double nsPerIteration{ totalTime.count() / static_cast<double>(iterations > 0 ? iterations : 1) };
+			std::cout << "Benchmark " << name << ": " << nsPerIteration << " ns per iteration, over " << iterations << " iterations." << std::endl;
+			return nsPerIteration;
+		}
+
+		/// @brief Prints the overall result, and converts it into the exit code that ctest reads.
+		inline int32_t reportResults(bool passed) {
+			std::cout << (passed ? "All tests passed." : "Some tests failed.") << std::endl;
+			return passed ? 0 : 1;
+		}
+
+	}
+}
@@ -0,0 +1,127 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// VoiceConnectionTests.cpp - Tests and benchmarks for the voice transport encryption modes.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file VoiceConnectionTests.cpp
+
+#include "UnitTest.hpp"
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// The size of a typical 20 ms opus frame, at the default bitrate.
+		static constexpr uint64_t frameSize{ 160 };
+
+		jsonifier::vector<voice_encryption_mode> getAvailableModes() {
+			jsonifier::vector<voice_encryption_mode> returnValue{};
+			returnValue.emplace_back(voice_encryption_mode::xsalsa20_poly1305);
+			returnValue.emplace_back(voice_encryption_mode::aead_xchacha20_poly1305_rtpsize);
+			if (crypto_aead_aes256gcm_is_available()) {
+				returnValue.emplace_back(voice_encryption_mode::aead_aes256_gcm_rtpsize);
+			}
+			return returnValue;
+		}
+
+		jsonifier::string_base<uint8_t> makeBytes(uint64_t size, uint8_t seed) {
+			jsonifier::string_base<uint8_t> returnValue{};
+			for (uint64_t x = 0; x < size; ++x) {
+				returnValue.push_back(static_cast<uint8_t>(seed + x * 7));
+			}
+			return returnValue;
+		}
+
+		bool testEncryptionRoundTrip() {
+			bool returnValue{ true };
+			auto keys  = makeBytes(32, 1);
+			auto frame = makeBytes(frameSize, 3);
+			for (auto mode: getAvailableModes()) {
+				jsonifier::string modeName{ getEncryptionModeName(mode) };
+				rtppacket_encrypter encrypter{ 1234, keys, mode };
+				rtppacket_decrypter decrypter{ keys, mode };
+				jsonifier::string_base<uint8_t> previousPacket{};
+				for (uint64_t x = 0; x < 3; ++x) {
+					encoder_return_data audioData{ .data = { frame.data(), frame.size() }, .sampleCount = 960 };
+					auto packet = encrypter.encryptPacket(audioData);
+					returnValue &= check(packet.size() > frameSize && packet.size() <= rtppacket_encrypter::getMaxPacketSize(frameSize), modeName + " packet size");
+					// Each packet advances the sequence, and for the aead modes the nonce, so no two packets are alike.
+					jsonifier::string_base<uint8_t> currentPacket{ packet };
+					returnValue &= check(currentPacket != previousPacket, modeName + " packets differ from frame to frame");
+					previousPacket = std::move(currentPacket);
+					auto decrypted = decrypter.decryptPacket(packet);
+					returnValue &= check(decrypted == jsonifier::string_view_base<uint8_t>{ frame.data(), frame.size() }, modeName + " frame round-trips");
+				}
+				previousPacket[previousPacket.size() / 2] ^= 0x01;
+				returnValue &= check(decrypter.decryptPacket({ previousPacket.data(), previousPacket.size() }).size() == 0, modeName + " rejects a tampered packet");
+			}
+			return returnValue;
+		}
+
+		bool testEncryptionModeSelection() {
+			bool returnValue{ true };
+			jsonifier::vector<jsonifier::string> modes{};
+			modes.emplace_back("xsalsa20_poly1305");
+			returnValue &= check(selectEncryptionMode(modes) == voice_encryption_mode::xsalsa20_poly1305, "the legacy mode is the fallback");
+			modes.emplace_back("aead_xchacha20_poly1305_rtpsize");
+			returnValue &= check(selectEncryptionMode(modes) == voice_encryption_mode::aead_xchacha20_poly1305_rtpsize, "xchacha20 is preferred to the legacy mode");
+			modes.emplace_back("aead_aes256_gcm_rtpsize");
+			auto expectedMode = crypto_aead_aes256gcm_is_available() ? voice_encryption_mode::aead_aes256_gcm_rtpsize : voice_encryption_mode::aead_xchacha20_poly1305_rtpsize;
+			returnValue &= check(selectEncryptionMode(modes) == expectedMode, "aes256-gcm is preferred wherever the cpu supports it");
+			return returnValue;
+		}
+
+		/// Encrypts a connection's frames one at a time, as its send loop does, in each of the modes.
+		bool benchmarkEncryptionModes() {
+			static constexpr uint64_t iterations{ 100000 };
+			auto keys  = makeBytes(32, 5);
+			auto frame = makeBytes(frameSize, 9);
+			uint64_t failedPackets{};
+			for (auto mode: getAvailableModes()) {
+				rtppacket_encrypter encrypter{ 1234, keys, mode };
+				encoder_return_data audioData{ .data = { frame.data(), frame.size() }, .sampleCount = 960 };
+				benchmark(jsonifier::string{ "encryptPacket " } + getEncryptionModeName(mode), iterations, [&](uint64_t) {
+					failedPackets += encrypter.encryptPacket(audioData).size() == 0;
+				});
+			}
+			return check(failedPackets == 0, "every benchmarked frame encrypts");
+		}
+
+	}
+}
+
+int32_t main() {
+	using namespace discord_core_api::discord_core_internal;
+	if (sodium_init() < 0) {
+		std::cerr << "Failed to initialize libsodium." << std::endl;
+		return 1;
+	}
+	bool returnValue{ true };
+	returnValue &= testEncryptionRoundTrip();
+	returnValue &= testEncryptionModeSelection();
+	returnValue &= benchmarkEncryptionModes();
+	return reportResults(returnValue);
+}